@@ -108,16 +108,20 @@ LOCAL_SRC_FILES := \
         profiling/server/src/timelineDecoder/TimelineDirectoryCaptureCommandHandler.cpp \
         src/armnn/BackendHelper.cpp \
         src/armnn/BackendRegistry.cpp \
+        src/armnn/ConstantTensorStore.cpp \
         src/armnn/Descriptors.cpp \
         src/armnn/Exceptions.cpp \
+        src/armnn/FlatGraph.cpp \
         src/armnn/Graph.cpp \
         src/armnn/InternalTypes.cpp \
         src/armnn/JsonPrinter.cpp \
         src/armnn/Layer.cpp \
         src/armnn/LayerSupport.cpp \
+        src/armnn/LayerSupportCache.cpp \
         src/armnn/LoadedNetwork.cpp \
         src/armnn/Logging.cpp \
         src/armnn/Network.cpp \
+        src/armnn/NetworkPipeline.cpp \
         src/armnn/NetworkUtils.cpp \
         src/armnn/Observable.cpp \
         src/armnn/Optimizer.cpp \
@@ -208,6 +212,7 @@ LOCAL_SRC_FILES := \
         src/armnn/layers/StridedSliceLayer.cpp \
         src/armnn/layers/SubtractionLayer.cpp \
         src/armnn/layers/SwitchLayer.cpp \
+        src/armnn/layers/TensorStatsLayer.cpp \
         src/armnn/layers/TransposeConvolution2dLayer.cpp \
         src/armnn/layers/TransposeLayer.cpp \
         src/armnn/layers/UnmapLayer.cpp \
@@ -373,6 +378,7 @@ LOCAL_SRC_FILES := \
         src/armnn/test/EndToEndTest.cpp \
         src/armnn/ExecutionFrame.cpp \
         src/armnn/test/ExecutionFrameTest.cpp \
+        src/armnn/test/FlatGraphTests.cpp \
         src/armnn/test/FloatingPointConverterTest.cpp \
         src/armnn/test/FlowControl.cpp \
         src/armnn/test/GraphTests.cpp \
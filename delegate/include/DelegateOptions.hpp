@@ -28,6 +28,18 @@ public:
 
     const std::vector<armnn::BackendOptions>& GetBackendOptions() const { return m_BackendOptions; }
 
+    void SetBorrowConstantMemory(bool borrowConstantMemory) { m_BorrowConstantMemory = borrowConstantMemory; }
+
+    bool GetBorrowConstantMemory() const { return m_BorrowConstantMemory; }
+
+    void SetImportEnabled(bool importEnabled) { m_ImportEnabled = importEnabled; }
+
+    bool GetImportEnabled() const { return m_ImportEnabled; }
+
+    void SetExportEnabled(bool exportEnabled) { m_ExportEnabled = exportEnabled; }
+
+    bool GetExportEnabled() const { return m_ExportEnabled; }
+
 private:
     /// Which backend to run Delegate on.
     /// Examples of possible values are: CpuRef, CpuAcc, GpuAcc.
@@ -52,6 +64,22 @@ private:
     ///   "TuningFile" : string [filenameString]
     ///   "KernelProfilingEnabled" : bool [true | false]
     std::vector<armnn::BackendOptions> m_BackendOptions;
+
+    /// Let the constant tensors of the ArmNN network borrow the read-only (kTfLiteMmapRo) buffers of the TfLite
+    /// model instead of copying them, which avoids holding every weight twice in memory.
+    /// The TfLite model must then outlive every interpreter the delegate is applied to.
+    /// False as default.
+    bool m_BorrowConstantMemory = false;
+
+    /// Let the ArmNN network read its inputs straight from the TfLite input buffers (MemorySource::Malloc import)
+    /// instead of copying them on every Invoke. Buffers that are not suitably aligned are staged through an
+    /// aligned copy. False as default.
+    bool m_ImportEnabled = false;
+
+    /// Let the ArmNN network write its outputs straight into the TfLite output buffers (MemorySource::Malloc
+    /// export) instead of copying them on every Invoke. Buffers that are not suitably aligned are staged through
+    /// an aligned copy. False as default.
+    bool m_ExportEnabled = false;
 };
 
 } // namespace armnnDelegate
@@ -20,11 +20,16 @@ struct DelegateData
     DelegateData(const std::vector<armnn::BackendId>& backends)
         : m_Backends(backends)
         , m_Network(nullptr, nullptr)
+        , m_BorrowConstantMemory(false)
     {}
 
     const std::vector<armnn::BackendId>       m_Backends;
     armnn::INetworkPtr                        m_Network;
     std::vector<armnn::IOutputSlot*>          m_OutputSlotForNode;
+    /// Whether the network borrows the memory of its constant tensors instead of copying it
+    bool                                      m_BorrowConstantMemory;
+    /// Constant data created while parsing (e.g. permuted filters) which the network borrows
+    std::vector<std::vector<uint8_t>>         m_ConstantStorage;
 };
 
 // Forward decleration for functions initializing the ArmNN Delegate
@@ -85,9 +90,9 @@ private:
     ArmnnSubgraph(armnn::NetworkId networkId,
                   armnn::IRuntime* runtime,
                   std::vector<armnn::BindingPointInfo>& inputBindings,
-                  std::vector<armnn::BindingPointInfo>& outputBindings)
-        : m_NetworkId(networkId), m_Runtime(runtime), m_InputBindings(inputBindings), m_OutputBindings(outputBindings)
-    {}
+                  std::vector<armnn::BindingPointInfo>& outputBindings,
+                  std::vector<std::vector<uint8_t>>&& constantStorage,
+                  const armnn::INetworkProperties& networkProperties);
 
     static TfLiteStatus AddInputLayer(DelegateData& delegateData,
                                       TfLiteContext* tfLiteContext,
@@ -109,6 +114,20 @@ private:
     std::vector<armnn::BindingPointInfo> m_InputBindings;
     std::vector<armnn::BindingPointInfo> m_OutputBindings;
 
+    /// Constant data borrowed by the loaded network that is not owned by the TfLite model
+    std::vector<std::vector<uint8_t>> m_ConstantStorage;
+
+    /// Whether the network imports its inputs and exports its outputs
+    bool m_ImportEnabled;
+    bool m_ExportEnabled;
+
+    /// Tensors passed to EnqueueWorkload. They are kept across invokes and only updated when a buffer moves.
+    armnn::InputTensors m_InputTensors;
+    armnn::OutputTensors m_OutputTensors;
+
+    /// Aligned copies of the TfLite buffers that are too misaligned to be imported or exported
+    std::vector<std::vector<uint8_t>> m_InputStaging;
+    std::vector<std::vector<uint8_t>> m_OutputStaging;
 };
 
 } // armnnDelegate namespace
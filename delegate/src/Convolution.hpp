@@ -365,6 +365,13 @@ TfLiteStatus VisitDepthwiseConv2dOperator(DelegateData& delegateData,
 
     armnn::IConnectableLayer* layer = nullptr;
 
+    if (delegateData.m_BorrowConstantMemory)
+    {
+        // The network borrows the permuted filter, so it has to live as long as the network.
+        // Moving the vector keeps its buffer, and with it the memory the filter points to.
+        delegateData.m_ConstantStorage.push_back(std::move(swizzledData));
+    }
+
     if(biasEnabled)
     {
         auto biases =
@@ -33,11 +33,38 @@
 #include <tensorflow/lite/context_util.h>
 
 #include <algorithm>
+#include <cstring>
 #include <sstream>
 
 namespace armnnDelegate
 {
 
+namespace
+{
+
+// Memory handed to the ArmNN tensor handles for MemorySource::Malloc import must be aligned to this
+constexpr uintptr_t g_ImportAlignment = sizeof(size_t);
+
+bool IsImportAligned(const void* memory)
+{
+    return reinterpret_cast<uintptr_t>(memory) % g_ImportAlignment == 0;
+}
+
+// Returns memory that can be imported in place of data: data itself when it is aligned,
+// otherwise staging, grown to the size of the tensor when needed.
+void* GetImportableMemory(void* data, size_t numBytes, std::vector<uint8_t>& staging)
+{
+    if (IsImportAligned(data))
+    {
+        return data;
+    }
+
+    staging.resize(numBytes);
+    return staging.data();
+}
+
+} // anonymous namespace
+
 DelegateOptions TfLiteArmnnDelegateOptionsDefault()
 {
     DelegateOptions options(armnn::Compute::CpuRef);
@@ -272,9 +299,15 @@ ArmnnSubgraph* ArmnnSubgraph::Create(TfLiteContext* tfLiteContext,
 
     // Initialize DelegateData holds network and output slots information
     DelegateData delegateData(delegate->m_Options.GetBackends());
+    delegateData.m_BorrowConstantMemory = delegate->m_Options.GetBorrowConstantMemory();
 
     // Build ArmNN Network
     armnn::NetworkOptions networkOptions = {};
+    if (delegateData.m_BorrowConstantMemory)
+    {
+        // Constant tensors borrow the kTfLiteMmapRo buffers, which live as long as the TfLite model
+        networkOptions.push_back(armnn::BackendOptions("BorrowConstantMemory", {{ "BorrowConstantMemory", true }}));
+    }
     armnn::NetworkId networkId;
     delegateData.m_Network = armnn::INetwork::Create(networkOptions);
 
@@ -337,14 +370,20 @@ ArmnnSubgraph* ArmnnSubgraph::Create(TfLiteContext* tfLiteContext,
         throw armnn::Exception("TfLiteArmnnDelegate: Unable to optimize the network!");
     }
 
+    const armnn::INetworkProperties networkProperties(delegate->m_Options.GetImportEnabled(),
+                                                      delegate->m_Options.GetExportEnabled());
     try
     {
         // Load graph into runtime
-        auto loadingStatus = delegate->m_Runtime->LoadNetwork(networkId, std::move(optNet));
+        std::string errorMessage;
+        auto loadingStatus = delegate->m_Runtime->LoadNetwork(networkId,
+                                                              std::move(optNet),
+                                                              errorMessage,
+                                                              networkProperties);
         if (loadingStatus != armnn::Status::Success)
         {
             // Optimize failed
-            throw armnn::Exception("TfLiteArmnnDelegate: Network could not be loaded!");;
+            throw armnn::Exception("TfLiteArmnnDelegate: Network could not be loaded: " + errorMessage);
         }
     }
     catch (std::exception& ex)
@@ -355,7 +394,39 @@ ArmnnSubgraph* ArmnnSubgraph::Create(TfLiteContext* tfLiteContext,
     }
 
     // Create a new SubGraph with networkId and runtime
-    return new ArmnnSubgraph(networkId, delegate->m_Runtime.get(), inputBindings, outputBindings);
+    return new ArmnnSubgraph(networkId,
+                             delegate->m_Runtime.get(),
+                             inputBindings,
+                             outputBindings,
+                             std::move(delegateData.m_ConstantStorage),
+                             networkProperties);
+}
+
+ArmnnSubgraph::ArmnnSubgraph(armnn::NetworkId networkId,
+                             armnn::IRuntime* runtime,
+                             std::vector<armnn::BindingPointInfo>& inputBindings,
+                             std::vector<armnn::BindingPointInfo>& outputBindings,
+                             std::vector<std::vector<uint8_t>>&& constantStorage,
+                             const armnn::INetworkProperties& networkProperties)
+    : m_NetworkId(networkId)
+    , m_Runtime(runtime)
+    , m_InputBindings(inputBindings)
+    , m_OutputBindings(outputBindings)
+    , m_ConstantStorage(std::move(constantStorage))
+    , m_ImportEnabled(networkProperties.m_ImportEnabled)
+    , m_ExportEnabled(networkProperties.m_ExportEnabled)
+    , m_InputStaging(inputBindings.size())
+    , m_OutputStaging(outputBindings.size())
+{
+    // The memory of the tensors is set by the first Invoke
+    for (const armnn::BindingPointInfo& inputBinding : m_InputBindings)
+    {
+        m_InputTensors.emplace_back(inputBinding.first, armnn::ConstTensor(inputBinding.second, nullptr));
+    }
+    for (const armnn::BindingPointInfo& outputBinding : m_OutputBindings)
+    {
+        m_OutputTensors.emplace_back(outputBinding.first, armnn::Tensor(outputBinding.second, nullptr));
+    }
 }
 
 TfLiteStatus ArmnnSubgraph::Prepare(TfLiteContext* tfLiteContext)
@@ -366,37 +437,70 @@ TfLiteStatus ArmnnSubgraph::Prepare(TfLiteContext* tfLiteContext)
 
 TfLiteStatus ArmnnSubgraph::Invoke(TfLiteContext* tfLiteContext, TfLiteNode* tfLiteNode)
 {
-    // Prepare inputs
-    armnn::InputTensors inputTensors;
+    // Prepare inputs, only rebuilding the tensors whose TfLite buffer has moved since the last invoke
     size_t inputIndex = 0;
     for (auto inputIdx : tflite::TfLiteIntArrayView(tfLiteNode->inputs))
     {
         TfLiteTensor* tensor = &tfLiteContext->tensors[inputIdx];
         if (tensor->allocation_type != kTfLiteMmapRo)
         {
-            const armnn::BindingPointInfo& inputBinding = m_InputBindings[inputIndex];
-            const armnn::ConstTensor inputTensor(inputBinding.second, tensor->data.data);
-            inputTensors.emplace_back(inputIdx, inputTensor);
+            void* data = tensor->data.data;
+            if (m_ImportEnabled)
+            {
+                data = GetImportableMemory(data, tensor->bytes, m_InputStaging[inputIndex]);
+                if (data != tensor->data.data)
+                {
+                    std::memcpy(data, tensor->data.data, tensor->bytes);
+                }
+            }
+
+            armnn::ConstTensor& inputTensor = m_InputTensors[inputIndex].second;
+            if (inputTensor.GetMemoryArea() != data)
+            {
+                inputTensor = armnn::ConstTensor(m_InputBindings[inputIndex].second, data);
+            }
 
             ++inputIndex;
         }
     }
 
     // Prepare outputs
-    armnn::OutputTensors outputTensors;
     size_t outputIndex = 0;
     for (auto outputIdx : tflite::TfLiteIntArrayView(tfLiteNode->outputs))
     {
-        const armnn::BindingPointInfo& outputBinding = m_OutputBindings[outputIndex];
         TfLiteTensor* tensor = &tfLiteContext->tensors[outputIdx];
-        const armnn::Tensor outputTensor(outputBinding.second, tensor->data.data);
-        outputTensors.emplace_back(outputIdx, outputTensor);
+        void* data = tensor->data.data;
+        if (m_ExportEnabled)
+        {
+            data = GetImportableMemory(data, tensor->bytes, m_OutputStaging[outputIndex]);
+        }
+
+        armnn::Tensor& outputTensor = m_OutputTensors[outputIndex].second;
+        if (outputTensor.GetMemoryArea() != data)
+        {
+            outputTensor = armnn::Tensor(m_OutputBindings[outputIndex].second, data);
+        }
 
         ++outputIndex;
     }
 
     // Run graph
-    auto status = m_Runtime->EnqueueWorkload(m_NetworkId, inputTensors, outputTensors);
+    auto status = m_Runtime->EnqueueWorkload(m_NetworkId, m_InputTensors, m_OutputTensors);
+
+    // Copy back the outputs that were written to a staging buffer
+    outputIndex = 0;
+    for (auto outputIdx : tflite::TfLiteIntArrayView(tfLiteNode->outputs))
+    {
+        TfLiteTensor* tensor = &tfLiteContext->tensors[outputIdx];
+        const void* data = m_OutputTensors[outputIndex].second.GetMemoryArea();
+        if (data != tensor->data.data)
+        {
+            std::memcpy(tensor->data.data, data, tensor->bytes);
+        }
+
+        ++outputIndex;
+    }
+
     return (status == armnn::Status::Success) ? kTfLiteOk : kTfLiteError;
 }
 
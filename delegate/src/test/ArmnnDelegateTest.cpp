@@ -56,6 +56,55 @@ TEST_CASE ("ArmnnDelegate Registered")
     CHECK(tfLiteInterpreter != nullptr);
 }
 
+TEST_CASE ("ArmnnDelegate Import Export")
+{
+    using namespace tflite;
+    auto tfLiteInterpreter =  std::make_unique<Interpreter>();
+
+    tfLiteInterpreter->AddTensors(3);
+    tfLiteInterpreter->SetInputs({0, 1});
+    tfLiteInterpreter->SetOutputs({2});
+
+    tfLiteInterpreter->SetTensorParametersReadWrite(0, kTfLiteFloat32, "input1", {1,2,2,1}, TfLiteQuantization());
+    tfLiteInterpreter->SetTensorParametersReadWrite(1, kTfLiteFloat32, "input2", {1,2,2,1}, TfLiteQuantization());
+    tfLiteInterpreter->SetTensorParametersReadWrite(2, kTfLiteFloat32, "output", {1,2,2,1}, TfLiteQuantization());
+
+    tflite::ops::builtin::BuiltinOpResolver opResolver;
+    const TfLiteRegistration* opRegister = opResolver.FindOp(BuiltinOperator_ADD, 1);
+    tfLiteInterpreter->AddNodeWithParameters({0, 1}, {2}, "", 0, nullptr, opRegister);
+
+    // Create the Armnn Delegate with the TfLite buffers imported and exported
+    armnnDelegate::DelegateOptions delegateOptions(armnn::Compute::CpuRef);
+    delegateOptions.SetImportEnabled(true);
+    delegateOptions.SetExportEnabled(true);
+    std::unique_ptr<TfLiteDelegate, decltype(&armnnDelegate::TfLiteArmnnDelegateDelete)>
+                       theArmnnDelegate(armnnDelegate::TfLiteArmnnDelegateCreate(delegateOptions),
+                                        armnnDelegate::TfLiteArmnnDelegateDelete);
+
+    CHECK(tfLiteInterpreter->ModifyGraphWithDelegate(theArmnnDelegate.get()) == kTfLiteOk);
+    CHECK(tfLiteInterpreter->AllocateTensors() == kTfLiteOk);
+
+    // Invoke several times, the bindings created by the first invoke are reused by the others
+    for (int invoke = 0; invoke < 3; ++invoke)
+    {
+        float* input1 = tfLiteInterpreter->typed_tensor<float>(0);
+        float* input2 = tfLiteInterpreter->typed_tensor<float>(1);
+        for (int i = 0; i < 4; ++i)
+        {
+            input1[i] = static_cast<float>(i);
+            input2[i] = static_cast<float>(invoke * 10);
+        }
+
+        CHECK(tfLiteInterpreter->Invoke() == kTfLiteOk);
+
+        const float* output = tfLiteInterpreter->typed_tensor<float>(2);
+        for (int i = 0; i < 4; ++i)
+        {
+            CHECK(output[i] == doctest::Approx(static_cast<float>(i + invoke * 10)));
+        }
+    }
+}
+
 }
 
 } // namespace armnnDelegate
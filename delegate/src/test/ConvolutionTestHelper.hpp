@@ -198,7 +198,8 @@ void ConvolutionTest(tflite::BuiltinOperator convolutionOperatorCode,
                      int outputQuantOffset = 0,
                      float quantScale = 1.0f,
                      int quantOffset = 0,
-                     int32_t depth_multiplier = 1)
+                     int32_t depth_multiplier = 1,
+                     bool borrowConstantMemory = false)
 
 {
     using namespace tflite;
@@ -243,6 +244,7 @@ void ConvolutionTest(tflite::BuiltinOperator convolutionOperatorCode,
 
     // Create the ArmNN Delegate
     armnnDelegate::DelegateOptions delegateOptions(backends);
+    delegateOptions.SetBorrowConstantMemory(borrowConstantMemory);
     std::unique_ptr<TfLiteDelegate, decltype(&armnnDelegate::TfLiteArmnnDelegateDelete)>
                         theArmnnDelegate(armnnDelegate::TfLiteArmnnDelegateCreate(delegateOptions),
                                          armnnDelegate::TfLiteArmnnDelegateDelete);
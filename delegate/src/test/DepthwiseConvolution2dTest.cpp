@@ -19,7 +19,7 @@
 namespace armnnDelegate
 {
 
-void DepthwiseConv2dValidReluFp32Test(std::vector<armnn::BackendId>& backends)
+void DepthwiseConv2dValidReluFp32Test(std::vector<armnn::BackendId>& backends, bool borrowConstantMemory = false)
 {
     // Set input data
     std::vector<int32_t> inputShape { 1, 3, 2, 2 };
@@ -76,7 +76,8 @@ void DepthwiseConv2dValidReluFp32Test(std::vector<armnn::BackendId>& backends)
                            0,    // outputQuantOffset
                            1.0f, // quantScale
                            0,    // quantOffset
-                           depth_multiplier);
+                           depth_multiplier,
+                           borrowConstantMemory);
 }
 
 void DepthwiseConv2dSameUint8Test(std::vector<armnn::BackendId>& backends)
@@ -141,6 +142,13 @@ TEST_CASE ("DepthwiseConv2d_Same_Uint8_CpuRef_Test")
     DepthwiseConv2dSameUint8Test(backends);
 }
 
+TEST_CASE ("DepthwiseConv2d_Valid_Relu_Fp32_BorrowConstantMemory_CpuRef_Test")
+{
+    // The permuted filter is borrowed from the delegate, the bias from the TfLite model
+    std::vector<armnn::BackendId> backends = {armnn::Compute::CpuRef};
+    DepthwiseConv2dValidReluFp32Test(backends, true);
+}
+
 }//End of TEST_SUITE("DepthwiseConv2d_CpuRef_Tests")
 
 TEST_SUITE("DepthwiseConv2d_CpuAcc_Tests")
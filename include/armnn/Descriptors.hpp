@@ -1286,4 +1286,32 @@ struct LogicalBinaryDescriptor
     LogicalBinaryOperation m_Operation;
 };
 
+/// A TensorStatsDescriptor for the TensorStatsLayer.
+struct TensorStatsDescriptor
+{
+    TensorStatsDescriptor()
+        : TensorStatsDescriptor(0, 0.0f, 0.0f)
+    {}
+
+    TensorStatsDescriptor(uint32_t numBins, float histogramMin, float histogramMax)
+        : m_NumBins(numBins)
+        , m_HistogramMin(histogramMin)
+        , m_HistogramMax(histogramMax)
+    {}
+
+    bool operator ==(const TensorStatsDescriptor &rhs) const
+    {
+        return m_NumBins      == rhs.m_NumBins &&
+               m_HistogramMin == rhs.m_HistogramMin &&
+               m_HistogramMax == rhs.m_HistogramMax;
+    }
+
+    /// Number of bins of the histogram of the finite values, 0 to not compute a histogram.
+    uint32_t m_NumBins;
+    /// Lower bound of the first bin. Smaller values are counted in the first bin.
+    float m_HistogramMin;
+    /// Upper bound of the last bin. Larger values are counted in the last bin.
+    float m_HistogramMax;
+};
+
 } // namespace armnn
@@ -43,6 +43,7 @@ struct SliceDescriptor;
 struct StackDescriptor;
 struct StandInDescriptor;
 struct StridedSliceDescriptor;
+struct TensorStatsDescriptor;
 struct TransposeConvolution2dDescriptor;
 struct TransposeDescriptor;
 struct ViewsDescriptor;
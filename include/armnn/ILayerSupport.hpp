@@ -406,6 +406,10 @@ public:
                                    const TensorInfo& output1,
                                    Optional<std::string&> reasonIfUnsupported = EmptyOptional()) const = 0;
 
+    virtual bool IsTensorStatsSupported(const TensorInfo& input,
+                                        const TensorStatsDescriptor& descriptor,
+                                        Optional<std::string&> reasonIfUnsupported = EmptyOptional()) const = 0;
+
     virtual bool IsTransposeConvolution2dSupported(
         const TensorInfo& input,
         const TensorInfo& output,
@@ -105,6 +105,11 @@ using INetworkPtr = std::unique_ptr<INetwork, void(*)(INetwork* network)>;
 class INetwork
 {
 public:
+    /// The following network options are available, each passed as a BackendOptions named after the option:
+    ///   "ShapeInferenceMethod" : bool - infer and validate output shapes instead of only validating them.
+    ///   "BorrowConstantMemory" : bool - constant tensors added to the network borrow the memory they are given
+    ///                                   instead of copying it. That memory must then stay alive and unchanged
+    ///                                   for as long as the network, or any network optimized from it, is in use.
     static INetwork* CreateRaw(NetworkOptions networkOptions = {});
     static INetworkPtr Create(NetworkOptions networkOptions = {});
     static void Destroy(INetwork* network);
@@ -622,6 +627,10 @@ struct OptimizerOptions
         , m_shapeInferenceMethod(armnn::ShapeInferenceMethod::ValidateOnly)
         , m_ImportEnabled(false)
         , m_ModelOptions()
+        , m_TensorStats(false)
+        , m_TensorStatsHistogramBins(0)
+        , m_TensorStatsHistogramMin(0.0f)
+        , m_TensorStatsHistogramMax(0.0f)
     {}
 
     OptimizerOptions(bool reduceFp32ToFp16, bool debug, bool reduceFp32ToBf16, bool importEnabled,
@@ -632,6 +641,10 @@ struct OptimizerOptions
         , m_shapeInferenceMethod(armnn::ShapeInferenceMethod::ValidateOnly)
         , m_ImportEnabled(importEnabled)
         , m_ModelOptions(modelOptions)
+        , m_TensorStats(false)
+        , m_TensorStatsHistogramBins(0)
+        , m_TensorStatsHistogramMin(0.0f)
+        , m_TensorStatsHistogramMax(0.0f)
     {
         if (m_ReduceFp32ToFp16 && m_ReduceFp32ToBf16)
         {
@@ -648,6 +661,10 @@ struct OptimizerOptions
         , m_shapeInferenceMethod(shapeInferenceMethod)
         , m_ImportEnabled(importEnabled)
         , m_ModelOptions(modelOptions)
+        , m_TensorStats(false)
+        , m_TensorStatsHistogramBins(0)
+        , m_TensorStatsHistogramMin(0.0f)
+        , m_TensorStatsHistogramMax(0.0f)
     {
         if (m_ReduceFp32ToFp16 && m_ReduceFp32ToBf16)
         {
@@ -672,6 +689,15 @@ struct OptimizerOptions
 
     // Enable Model Options
     ModelOptions m_ModelOptions;
+
+    // Add a TensorStats layer after each layer, to monitor intermediate tensors through
+    // IRuntime::RegisterTensorStatsCallback at a fraction of the cost of m_Debug
+    bool m_TensorStats;
+
+    // Number of bins and range of the histogram computed by the TensorStats layers, 0 bins for no histogram
+    unsigned int m_TensorStatsHistogramBins;
+    float m_TensorStatsHistogramMin;
+    float m_TensorStatsHistogramMax;
 };
 
 /// Create an optimized version of the network
@@ -7,18 +7,24 @@
 #include "BackendOptions.hpp"
 #include "INetwork.hpp"
 #include "IProfiler.hpp"
+#include "MemorySources.hpp"
 #include "Tensor.hpp"
 #include "Types.hpp"
 #include "TypesUtils.hpp"
 #include "profiling/ILocalPacketHandler.hpp"
 
+#include <map>
 #include <memory>
+#include <string>
 
 namespace armnn
 {
 
 using NetworkId = int;
 
+/// Identifies the tensors bound to a network by IRuntime::RegisterTensors.
+using BoundTensorsId = int;
+
 class IGpuAccTunedParameters;
 
 class IRuntime;
@@ -26,13 +32,34 @@ using IRuntimePtr = std::unique_ptr<IRuntime, void(*)(IRuntime* runtime)>;
 
 struct INetworkProperties
 {
-    INetworkProperties(bool importEnabled = false, bool exportEnabled = false)
+    INetworkProperties(bool importEnabled = false,
+                       bool exportEnabled = false,
+                       bool dynamicInputShapes = false,
+                       unsigned int numPipelineStages = 0,
+                       MemorySource inputSource = MemorySource::Malloc)
         : m_ImportEnabled(importEnabled),
-          m_ExportEnabled(exportEnabled) {}
+          m_ExportEnabled(exportEnabled),
+          m_DynamicInputShapesEnabled(dynamicInputShapes),
+          m_NumPipelineStages(numPipelineStages),
+          m_InputSource(inputSource) {}
 
     const bool m_ImportEnabled;
     const bool m_ExportEnabled;
 
+    /// Setting this flag lets EnqueueWorkload take inputs whose shapes differ from the ones the network was loaded
+    /// with. The shapes of the other tensors are inferred again and the workloads recreated for them, once for each
+    /// distinct set of input shapes. The output tensors must have the shapes inferred for the given inputs.
+    const bool m_DynamicInputShapesEnabled;
+
+    /// Setting this above 1 splits the network into up to this many stages of about equal cost, which
+    /// IRuntime::EnqueueWorkloads runs on a thread each so that consecutive inferences overlap.
+    const unsigned int m_NumPipelineStages;
+
+    /// Where the input tensors given to EnqueueWorkload are allocated when import is enabled. With
+    /// MemorySource::DmaBuf or MemorySource::PosixShm each input tensor points to a FileDescriptorMemory, which
+    /// is mapped once and then imported without a copy. Not supported together with pipeline stages.
+    const MemorySource m_InputSource;
+
     virtual ~INetworkProperties() {}
 };
 
@@ -141,14 +168,60 @@ public:
                                std::string& errorMessage,
                                const INetworkProperties& networkProperties) = 0;
 
+    /// Optimizes several networks for the given backends and loads them into the IRuntime. The networks are
+    /// optimized and loaded concurrently, only their registration in the IRuntime is serialized.
+    /// The time spent optimizing and loading each network is recorded in its profiler (see GetProfiler()).
+    /// @param [out] networkIdsOut Unique identifier of each network, in the order of networks.
+    /// @param [in] networks Networks to optimize and load. They are not modified and must outlive the call.
+    /// @param [in] backendPreferences Backends to optimize the networks for, in order of preference.
+    /// @param [out] errorMessages Error message of each network, empty for the networks that were loaded.
+    /// @param [in] options Options used to optimize every network.
+    /// @param [in] networkProperties Properties used to load every network.
+    /// @param [in] numThreads Maximum number of networks processed at once, 0 for one per hardware thread.
+    /// @return Status of each network, in the order of networks.
+    virtual std::vector<Status> LoadNetworks(std::vector<NetworkId>& networkIdsOut,
+                                             const std::vector<const INetwork*>& networks,
+                                             const std::vector<BackendId>& backendPreferences,
+                                             std::vector<std::string>& errorMessages,
+                                             const OptimizerOptions& options = OptimizerOptions(),
+                                             const INetworkProperties& networkProperties = INetworkProperties(),
+                                             unsigned int numThreads = 0) = 0;
+
     virtual TensorInfo GetInputTensorInfo(NetworkId networkId, LayerBindingId layerId) const = 0;
     virtual TensorInfo GetOutputTensorInfo(NetworkId networkId, LayerBindingId layerId) const = 0;
 
+    /// Lists the outputs of a network that are copied to the buffers given to EnqueueWorkload rather than written
+    /// there directly by the layers producing them, with the reason why. Outputs are only written directly when
+    /// export is enabled in the INetworkProperties the network was loaded with.
+    virtual std::map<LayerBindingId, std::string> GetOutputCopyReasons(NetworkId networkId) const = 0;
+
     /// Evaluates a network using input in inputTensors and outputs filled into outputTensors
     virtual Status EnqueueWorkload(NetworkId networkId,
                                    const InputTensors& inputTensors,
                                    const OutputTensors& outputTensors) = 0;
 
+    /// Evaluates a network once for each element of inputTensors, filling the outputs into the matching element of
+    /// outputTensors. When the network was loaded with pipeline stages (see INetworkProperties) the inferences run
+    /// through them concurrently, otherwise one after the other.
+    virtual Status EnqueueWorkloads(NetworkId networkId,
+                                    const std::vector<InputTensors>& inputTensors,
+                                    const std::vector<OutputTensors>& outputTensors) = 0;
+
+    /// Binds the memory of inputTensors and outputTensors to a network once, for Execute to run inferences on it
+    /// without the validation, tensor info copies and allocations EnqueueWorkload goes through on every call.
+    /// The memory must stay valid until the tensors are unregistered or the network unloaded, and the input
+    /// tensors must have the shapes the network was loaded with.
+    /// @param [out] boundTensorsId Identifies the bound tensors in later calls to Execute.
+    virtual Status RegisterTensors(NetworkId networkId,
+                                   const InputTensors& inputTensors,
+                                   const OutputTensors& outputTensors,
+                                   BoundTensorsId& boundTensorsId) = 0;
+
+    /// Evaluates a network on the tensors bound by RegisterTensors, reading whatever their inputs hold at the time.
+    virtual Status Execute(BoundTensorsId boundTensorsId) = 0;
+
+    virtual Status UnregisterTensors(BoundTensorsId boundTensorsId) = 0;
+
     /// Unloads a network from the IRuntime.
     /// At the moment this only removes the network from the m_Impl->m_Network.
     /// This might need more work in the future to be AndroidNN compliant.
@@ -168,6 +241,12 @@ public:
     /// @param func callback function to pass to the debug layer.
     virtual void RegisterDebugCallback(NetworkId networkId, const DebugCallbackFunction& func) = 0;
 
+    /// Registers a callback function to the TensorStats layers of a network, to receive the stats they compute on
+    /// intermediate tensors. The layers are added by Optimize when OptimizerOptions::m_TensorStats is set.
+    /// @param networkId The id of the network to register the callback.
+    /// @param func callback function to pass to the TensorStats layers.
+    virtual void RegisterTensorStatsCallback(NetworkId networkId, const TensorStatsCallbackFunction& func) = 0;
+
 protected:
     ~IRuntime() {}
 };
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <type_traits>
 
 namespace armnn
@@ -15,7 +16,24 @@ enum class MemorySource
     Undefined = 0,
     Malloc = 1,
     DmaBuf = 2,
-    DmaBufProtected = 4
+    DmaBufProtected = 4,
+    PosixShm = 8
+};
+
+/// Memory held by a file descriptor, such as a dma-buf or a POSIX shared memory object opened with shm_open().
+/// Its address is what ITensorHandle::Import and the tensors given to a network importing from
+/// MemorySource::DmaBuf or MemorySource::PosixShm point to, instead of the data itself.
+struct FileDescriptorMemory
+{
+    FileDescriptorMemory(int fd = -1, size_t offset = 0)
+        : m_Fd(fd)
+        , m_Offset(offset)
+    {}
+
+    /// The descriptor only has to stay open until the tensor is imported.
+    int m_Fd;
+    /// Where the tensor data starts in the file, in bytes.
+    size_t m_Offset;
 };
 
 using MemorySourceFlags = unsigned int;
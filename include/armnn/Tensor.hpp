@@ -12,6 +12,7 @@
 
 #include <array>
 #include <initializer_list>
+#include <memory>
 #include <vector>
 
 namespace armnn
@@ -178,8 +179,10 @@ public:
                unsigned int quantizationDim);
 
     TensorInfo(const TensorInfo& other);
+    TensorInfo(TensorInfo&& other) noexcept;
 
     TensorInfo& operator=(const TensorInfo& other);
+    TensorInfo& operator=(TensorInfo&& other) noexcept;
 
     bool operator==(const TensorInfo& other) const;
     bool operator!=(const TensorInfo& other) const;
@@ -194,12 +197,17 @@ public:
     DataType GetDataType() const                     { return m_DataType; }
     void SetDataType(DataType type)                  { m_DataType = type; }
 
-    bool HasMultipleQuantizationScales() const       { return m_Quantization.m_Scales.size() > 1; }
+    bool HasMultipleQuantizationScales() const       { return m_Quantization.m_NumScales > 1; }
 
     bool HasPerAxisQuantization() const;
 
     std::vector<float> GetQuantizationScales() const;
     void SetQuantizationScales(const std::vector<float>& scales);
+    void SetQuantizationScales(std::vector<float>&& scales);
+
+    /// The scales without a copy, valid as long as they are not set again.
+    unsigned int GetNumQuantizationScales() const    { return m_Quantization.m_NumScales; }
+    const float* GetQuantizationScalesData() const   { return m_Quantization.GetScales(); }
 
     float GetQuantizationScale() const;
     void SetQuantizationScale(float scale);
@@ -221,39 +229,26 @@ private:
     TensorShape m_Shape;
     DataType    m_DataType;
 
-    /// Vectors of scale and offset are used for per-axis quantization.
+    /// Several scales are used for per-axis quantization. A single scale is held inline, and several are held in
+    /// storage shared by the copies of the TensorInfo and replaced rather than modified, so that copying a
+    /// TensorInfo does not allocate.
     struct Quantization
     {
         Quantization()
-            : m_Scales{}
+            : m_Scale(0.0f)
+            , m_NumScales(0)
             , m_Offset(EmptyOptional())
             , m_QuantizationDim(EmptyOptional()) {}
 
-        Quantization(const Quantization& other)
-            : m_Scales(other.m_Scales)
-            , m_Offset(other.m_Offset)
-            , m_QuantizationDim(other.m_QuantizationDim) {}
-
-        bool operator==(const Quantization& other) const
-        {
-            return ((m_Scales == other.m_Scales) && (m_Offset == other.m_Offset) &&
-                (m_QuantizationDim == other.m_QuantizationDim));
-        }
+        bool operator==(const Quantization& other) const;
 
-        Quantization& operator=(const Quantization& other)
-        {
-            if(this != &other)
-            {
-                m_Scales = other.m_Scales;
-                m_Offset = other.m_Offset;
-                m_QuantizationDim = other.m_QuantizationDim;
-            }
-            return *this;
-        }
+        const float* GetScales() const { return m_NumScales > 1 ? m_Scales->data() : &m_Scale; }
 
-        std::vector<float>     m_Scales;
-        Optional<int32_t>      m_Offset;
-        Optional<unsigned int> m_QuantizationDim;
+        float                                     m_Scale;
+        unsigned int                              m_NumScales;
+        std::shared_ptr<const std::vector<float>> m_Scales;
+        Optional<int32_t>                         m_Offset;
+        Optional<unsigned int>                    m_QuantizationDim;
 
     } m_Quantization;
 };
@@ -8,6 +8,7 @@
 #include <functional>
 #include <memory>
 #include <stdint.h>
+#include <vector>
 #include "BackendId.hpp"
 #include "Exceptions.hpp"
 #include "Deprecated.hpp"
@@ -274,6 +275,29 @@ class ITensorHandle;
 /// @param tensorHandle - TensorHandle for the input tensor to the Debug layer
 using DebugCallbackFunction = std::function<void(LayerGuid guid, unsigned int slotIndex, ITensorHandle* tensorHandle)>;
 
+/// Summary of the values of a tensor, computed by a TensorStats layer
+struct TensorStats
+{
+    /// Smallest and largest values, ignoring NaNs. NaN when all the values are NaNs.
+    float m_Min = 0.0f;
+    float m_Max = 0.0f;
+    /// Mean of the finite values, 0 when there are none.
+    float m_Mean = 0.0f;
+    unsigned int m_NumElements = 0;
+    unsigned int m_NumNaNs = 0;
+    /// Number of positive and negative infinities.
+    unsigned int m_NumInfs = 0;
+    /// Number of finite values in each bin of the histogram, when one was asked for.
+    std::vector<unsigned int> m_Histogram;
+};
+
+/// Define the type of callback for the TensorStats layer to call
+/// @param guid - guid of layer connected to the input of the TensorStats layer
+/// @param slotIndex - index of the output slot connected to the input of the TensorStats layer
+/// @param stats - Stats of the input tensor to the TensorStats layer, only valid during the call
+using TensorStatsCallbackFunction =
+    std::function<void(LayerGuid guid, unsigned int slotIndex, const TensorStats& stats)>;
+
 
 namespace profiling
 {
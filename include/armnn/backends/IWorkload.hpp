@@ -21,6 +21,8 @@ public:
     virtual profiling::ProfilingGuid GetGuid() const = 0;
 
     virtual void RegisterDebugCallback(const DebugCallbackFunction & /*func*/) {}
+
+    virtual void RegisterTensorStatsCallback(const TensorStatsCallbackFunction & /*func*/) {}
 };
 
 } //namespace armnn
@@ -37,6 +37,15 @@ public:
     /// Create an input network from a binary input stream
     virtual armnn::INetworkPtr CreateNetworkFromBinary(std::istream& binaryContent) = 0;
 
+    /// Create an optimized network from binary file contents written by ISerializer from an IOptimizedNetwork.
+    /// The network keeps the backend assignment of the serialized one, so it can be passed to
+    /// IRuntime::LoadNetwork without calling Optimize again.
+    virtual armnn::IOptimizedNetworkPtr CreateOptimizedNetworkFromBinary(
+        const std::vector<uint8_t>& binaryContent) = 0;
+
+    /// Create an optimized network from a binary input stream written by ISerializer from an IOptimizedNetwork.
+    virtual armnn::IOptimizedNetworkPtr CreateOptimizedNetworkFromBinary(std::istream& binaryContent) = 0;
+
     /// Retrieve binding info (layer id and tensor info) for the network input identified by
     /// the given layer name and layers id
     virtual BindingPointInfo GetNetworkInputBindingInfo(unsigned int layerId,
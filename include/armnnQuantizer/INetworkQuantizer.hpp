@@ -47,6 +47,11 @@ public:
     /// Refine input network with a set of refinement data for specified LayerBindingId
     virtual void Refine(const InputTensors& inputTensors) = 0;
 
+    /// Refine input network with a batch of refinement data, running the inferences on numThreads threads,
+    /// each with its own copy of the network. Zero threads means one per hardware thread.
+    /// The ranges found are the same as those of calling Refine for each entry of the batch in turn.
+    virtual void RefineBatch(const std::vector<InputTensors>& inputTensorsBatch, unsigned int numThreads = 0) = 0;
+
     /// Extract final quantized network
     virtual INetworkPtr ExportNetwork() = 0;
 
@@ -25,6 +25,12 @@ public:
     /// @param [in] inNetwork The network to be serialized.
     virtual void Serialize(const armnn::INetwork& inNetwork) = 0;
 
+    /// Serializes the optimized network to ArmNN SerializedGraph. Besides the layers, this stores the backend
+    /// assigned to each layer, the layers inserted by the optimizer and the tensor handle factories it chose, so
+    /// that the network can be loaded without optimizing it again.
+    /// @param [in] inNetwork The optimized network to be serialized.
+    virtual void Serialize(const armnn::IOptimizedNetwork& inNetwork) = 0;
+
     /// Serializes the SerializedGraph to the stream.
     /// @param [stream] the stream to save to
     /// @return true if graph is Serialized to the Stream, false otherwise
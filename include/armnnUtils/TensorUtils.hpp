@@ -24,6 +24,8 @@ armnn::TensorInfo GetTensorInfo(unsigned int numberOfBatches,
 
 std::pair<float, float> FindMinMax(armnn::ITensorHandle* tensorHandle);
 
+std::pair<float, float> FindMinMax(const float* data, unsigned int numElements);
+
 armnn::TensorShape ExpandDims(const armnn::TensorShape& tensorShape, int axis);
 
 unsigned int GetNumElementsBetween(const armnn::TensorShape& shape,
@@ -7,6 +7,8 @@
 #include <armnn/Exceptions.hpp>
 #include <ProfilingService.hpp>
 
+#include "LayerSupportCache.hpp"
+
 namespace armnn
 {
 
@@ -26,6 +28,9 @@ void BackendRegistry::Register(const BackendId& id, BackendRegistry::FactoryFunc
     }
     m_Factories[id] = factory;
 
+    // A backend registered under a previous id may support different layers
+    LayerSupportCache::GetInstance().Clear();
+
     if (m_ProfilingService.has_value())
     {
         if (m_ProfilingService.has_value() && m_ProfilingService.value().IsProfilingEnabled())
@@ -39,6 +44,7 @@ void BackendRegistry::Register(const BackendId& id, BackendRegistry::FactoryFunc
 void BackendRegistry::Deregister(const BackendId& id)
 {
     m_Factories.erase(id);
+    LayerSupportCache::GetInstance().Clear();
 
     if (m_ProfilingService.has_value() && m_ProfilingService.value().IsProfilingEnabled())
     {
@@ -0,0 +1,79 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "ConstantTensorStore.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+namespace armnn
+{
+
+namespace
+{
+
+// FNV-1a
+size_t HashContents(const void* data, unsigned int numBytes)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned int i = 0; i < numBytes; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return static_cast<size_t>(hash);
+}
+
+} // anonymous namespace
+
+std::shared_ptr<const void> ConstantTensorStore::GetSharedMemory(const void* data, unsigned int numBytes)
+{
+    const size_t hash = HashContents(data, numBytes);
+
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+    auto range = m_Entries.equal_range(hash);
+    for (auto it = range.first; it != range.second;)
+    {
+        std::shared_ptr<const void> memory = it->second.m_Memory.lock();
+        if (!memory)
+        {
+            // All the networks using this memory have been unloaded
+            it = m_Entries.erase(it);
+            continue;
+        }
+
+        if (it->second.m_NumBytes == numBytes && std::memcmp(memory.get(), data, numBytes) == 0)
+        {
+            return memory;
+        }
+        ++it;
+    }
+
+    void* copy = ::operator new(numBytes);
+    std::memcpy(copy, data, numBytes);
+    std::shared_ptr<const void> memory(copy, [](const void* mem) { ::operator delete(const_cast<void*>(mem)); });
+
+    m_Entries.emplace(hash, Entry{ memory, numBytes });
+    return memory;
+}
+
+size_t ConstantTensorStore::GetNumSharedMemoryBlocks() const
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+    size_t numBlocks = 0;
+    for (const auto& entry : m_Entries)
+    {
+        if (!entry.second.m_Memory.expired())
+        {
+            ++numBlocks;
+        }
+    }
+    return numBlocks;
+}
+
+} // namespace armnn
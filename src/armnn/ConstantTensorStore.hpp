@@ -0,0 +1,38 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace armnn
+{
+
+/// Content addressed store of constant tensor data, shared by all the networks loaded into a runtime.
+/// Networks holding identical weights (e.g. variants of one model) get the same memory instead of a copy each.
+class ConstantTensorStore
+{
+public:
+    /// Returns memory holding the given data. Every caller asking for identical contents while that memory is
+    /// still referenced gets the same memory, which is freed once the last returned pointer is released.
+    std::shared_ptr<const void> GetSharedMemory(const void* data, unsigned int numBytes);
+
+    /// Number of distinct blocks of memory currently referenced.
+    size_t GetNumSharedMemoryBlocks() const;
+
+private:
+    struct Entry
+    {
+        std::weak_ptr<const void> m_Memory;
+        unsigned int m_NumBytes;
+    };
+
+    mutable std::mutex m_Mutex;
+    std::unordered_multimap<size_t, Entry> m_Entries;
+};
+
+} // namespace armnn
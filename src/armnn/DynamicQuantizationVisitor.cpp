@@ -50,34 +50,29 @@ void DynamicQuantizationVisitor::AddToNonCalibratedLayers(const IConnectableLaye
 
 void DynamicQuantizationVisitor::FinishVisit()
 {
+    // Only the range of the tensors is needed, so no histogram
+    const TensorStatsDescriptor descriptor;
     for (const IConnectableLayer* layer : m_LayersToCalibrate)
     {
-        std::vector<DebugLayer*> newDebugLayers = InsertDebugLayerAfter(
-            m_Graph, *PolymorphicDowncast<Layer*>(const_cast<IConnectableLayer*>(layer)));
+        std::vector<TensorStatsLayer*> newStatsLayers = AddTensorStatsLayersAfter(
+            m_Graph, *PolymorphicDowncast<Layer*>(const_cast<IConnectableLayer*>(layer)), descriptor);
         // record them so we can take them out again efficiently afterward
-        m_DebugLayers.insert(std::end(m_DebugLayers), std::begin(newDebugLayers), std::end(newDebugLayers));
+        m_TensorStatsLayers.insert(std::end(m_TensorStatsLayers), std::begin(newStatsLayers), std::end(newStatsLayers));
     }
 }
 
-void DynamicQuantizationVisitor::RemoveDebugLayers()
+void DynamicQuantizationVisitor::RemoveTensorStatsLayers()
 {
-    for (DebugLayer* debugLayer : m_DebugLayers)
+    for (TensorStatsLayer* statsLayer : m_TensorStatsLayers)
     {
-        OutputSlot& proceedingOutputSlot = *debugLayer->GetInputSlot(0).GetConnectedOutputSlot();
-        proceedingOutputSlot.Disconnect(debugLayer->GetInputSlot(0));
-
-        for (InputSlot* succeedingInputSlot : debugLayer->GetOutputSlot(0).GetConnections())
-        {
-            debugLayer->GetOutputSlot(0).Disconnect(*succeedingInputSlot);
-            proceedingOutputSlot.Connect(*succeedingInputSlot);
-        }
-        m_Graph.EraseLayer(debugLayer);
+        // The stats layers only consume the tensors, so erasing them leaves the rest of the graph as it was
+        m_Graph.EraseLayer(statsLayer);
     }
-    m_DebugLayers.clear();
+    m_TensorStatsLayers.clear();
 }
 
 void DynamicQuantizationVisitor::VisitNonCalibratedLayers() {
-    RemoveDebugLayers();
+    RemoveTensorStatsLayers();
     for (const IConnectableLayer* layer : m_LayersNotToCalibrate)
     {
         ForwardParentParameters(layer);
@@ -7,7 +7,7 @@
 
 #include "armnn/LayerVisitorBase.hpp"
 #include "RangeTracker.hpp"
-#include "layers/DebugLayer.hpp"
+#include "layers/TensorStatsLayer.hpp"
 
 #include <armnn/INetwork.hpp>
 #include <armnnQuantizer/INetworkQuantizer.hpp>
@@ -137,13 +137,13 @@ private:
 
     std::vector<const IConnectableLayer*> m_LayersToCalibrate;
     std::vector<const IConnectableLayer*> m_LayersNotToCalibrate;
-    std::vector<DebugLayer*> m_DebugLayers;
+    std::vector<TensorStatsLayer*> m_TensorStatsLayers;
 
     std::vector<armnn::LayerBindingId> m_OutputLayers;
 
     void AddToCalibratedLayers(const IConnectableLayer* layer);
     void AddToNonCalibratedLayers(const IConnectableLayer* layer);
-    void RemoveDebugLayers();
+    void RemoveTensorStatsLayers();
 };
 
 } //namespace armnn
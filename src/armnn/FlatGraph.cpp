@@ -0,0 +1,154 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "FlatGraph.hpp"
+#include "Graph.hpp"
+
+#include <armnn/Exceptions.hpp>
+#include <armnn/utility/NumericCast.hpp>
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace armnn
+{
+
+constexpr FlatGraph::Index FlatGraph::Unconnected;
+
+FlatGraph::FlatGraph(const Graph& graph)
+{
+    const size_t numLayers = graph.GetNumLayers();
+    m_Layers.reserve(numLayers);
+    m_InputSlotOffsets.reserve(numLayers + 1);
+    m_OutputSlotOffsets.reserve(numLayers + 1);
+
+    std::unordered_map<const Layer*, Index> layerIndices;
+    layerIndices.reserve(numLayers);
+
+    m_InputSlotOffsets.push_back(0);
+    m_OutputSlotOffsets.push_back(0);
+    for (const Layer* layer : graph)
+    {
+        layerIndices.emplace(layer, GetNumLayers());
+        m_Layers.push_back(layer);
+        m_InputSlotOffsets.push_back(m_InputSlotOffsets.back() + layer->GetNumInputSlots());
+        m_OutputSlotOffsets.push_back(m_OutputSlotOffsets.back() + layer->GetNumOutputSlots());
+    }
+
+    m_ConnectedOutputSlots.reserve(m_InputSlotOffsets.back());
+    m_OutputSlots.reserve(m_OutputSlotOffsets.back());
+    m_OutputSlotOwners.reserve(m_OutputSlotOffsets.back());
+    m_ConsumerOffsets.reserve(m_OutputSlotOffsets.back() + 1);
+    m_ConsumerOffsets.push_back(0);
+
+    for (Index layerIndex = 0; layerIndex < GetNumLayers(); ++layerIndex)
+    {
+        const Layer* layer = m_Layers[layerIndex];
+
+        for (const InputSlot& inputSlot : layer->GetInputSlots())
+        {
+            const OutputSlot* connectedSlot = inputSlot.GetConnectedOutputSlot();
+            if (connectedSlot == nullptr)
+            {
+                m_ConnectedOutputSlots.push_back(Unconnected);
+                continue;
+            }
+            const Index owner = layerIndices.at(&connectedSlot->GetOwningLayer());
+            m_ConnectedOutputSlots.push_back(m_OutputSlotOffsets[owner] + connectedSlot->CalculateIndexOnOwner());
+        }
+
+        for (const OutputSlot& outputSlot : layer->GetOutputSlots())
+        {
+            m_OutputSlots.push_back(&outputSlot);
+            m_OutputSlotOwners.push_back(layerIndex);
+            for (const InputSlot* connection : outputSlot.GetConnections())
+            {
+                m_ConsumingLayers.push_back(layerIndices.at(&connection->GetOwningLayer()));
+            }
+            m_ConsumerOffsets.push_back(armnn::numeric_cast<Index>(m_ConsumingLayers.size()));
+        }
+    }
+}
+
+std::vector<FlatGraph::Index> FlatGraph::GetTopologicalOrder(std::vector<LayerPriority>& priorities) const
+{
+    constexpr LayerPriority inputPriority = std::numeric_limits<LayerPriority>::lowest();
+    constexpr LayerPriority outputPriority = std::numeric_limits<LayerPriority>::max();
+
+    // Visits each layer once all of its connected inputs have been visited, which gives each layer the length of
+    // the longest path to it without recursing along that path
+    std::vector<Index> numPendingInputs(GetNumLayers());
+    std::vector<Index> ready;
+    ready.reserve(GetNumLayers());
+    for (Index layer = 0; layer < GetNumLayers(); ++layer)
+    {
+        for (Index inputSlot = GetFirstInputSlot(layer); inputSlot < GetEndInputSlot(layer); ++inputSlot)
+        {
+            if (GetConnectedOutputSlot(inputSlot) != Unconnected)
+            {
+                ++numPendingInputs[layer];
+            }
+        }
+        if (numPendingInputs[layer] == 0)
+        {
+            ready.push_back(layer);
+        }
+    }
+
+    // Parents only ever raise the priority of a layer, starting from no parent at all
+    priorities.assign(GetNumLayers(), 0);
+    for (size_t next = 0; next < ready.size(); ++next)
+    {
+        const Index layer = ready[next];
+        switch (m_Layers[layer]->GetType())
+        {
+            case LayerType::Input:
+                priorities[layer] = inputPriority;
+                break;
+            case LayerType::Output:
+                priorities[layer] = outputPriority;
+                break;
+            default:
+                if (priorities[layer] >= outputPriority)
+                {
+                    throw GraphValidationException("Graph has too many edges");
+                }
+                ++priorities[layer];
+                break;
+        }
+
+        for (Index outputSlot = GetFirstOutputSlot(layer); outputSlot < GetEndOutputSlot(layer); ++outputSlot)
+        {
+            for (Index consumer = GetFirstConsumer(outputSlot); consumer < GetEndConsumer(outputSlot); ++consumer)
+            {
+                const Index consumingLayer = GetConsumingLayer(consumer);
+                priorities[consumingLayer] = std::max(priorities[consumingLayer], priorities[layer]);
+                if (--numPendingInputs[consumingLayer] == 0)
+                {
+                    ready.push_back(consumingLayer);
+                }
+            }
+        }
+    }
+
+    if (ready.size() != GetNumLayers())
+    {
+        throw GraphValidationException("Graph has circular dependencies: cannot walk");
+    }
+
+    std::vector<Index> order(GetNumLayers());
+    for (Index layer = 0; layer < GetNumLayers(); ++layer)
+    {
+        order[layer] = layer;
+    }
+    std::stable_sort(order.begin(), order.end(), [&priorities](Index layerA, Index layerB)
+    {
+        return priorities[layerA] < priorities[layerB];
+    });
+
+    return order;
+}
+
+} // namespace armnn
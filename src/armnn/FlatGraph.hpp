@@ -0,0 +1,78 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "Layer.hpp"
+
+#include <limits>
+#include <vector>
+
+namespace armnn
+{
+
+class Graph;
+
+///
+/// The FlatGraph class is an index-based snapshot of the connectivity of a Graph. The layers, their slots and their
+/// connections are stored in flat arrays and refer to each other by index, so that walking them does not chase
+/// pointers through the heap. The snapshot becomes invalid when layers or connections are added to or removed from
+/// the Graph.
+///
+/// Layers are indexed in the order of the Graph. The slots of each layer are numbered consecutively, starting at
+/// GetFirstInputSlot() and GetFirstOutputSlot(), and the consumers of each output slot likewise.
+///
+class FlatGraph
+{
+public:
+    using Index = unsigned int;
+
+    /// Index of the output slot connected to an unconnected input slot.
+    static constexpr Index Unconnected = std::numeric_limits<Index>::max();
+
+    explicit FlatGraph(const Graph& graph);
+
+    Index GetNumLayers() const { return static_cast<Index>(m_Layers.size()); }
+    Index GetNumOutputSlots() const { return static_cast<Index>(m_OutputSlots.size()); }
+
+    const Layer& GetLayer(Index layer) const { return *m_Layers[layer]; }
+    const OutputSlot& GetOutputSlot(Index outputSlot) const { return *m_OutputSlots[outputSlot]; }
+
+    Index GetFirstInputSlot(Index layer) const { return m_InputSlotOffsets[layer]; }
+    Index GetEndInputSlot(Index layer) const { return m_InputSlotOffsets[layer + 1]; }
+
+    Index GetFirstOutputSlot(Index layer) const { return m_OutputSlotOffsets[layer]; }
+    Index GetEndOutputSlot(Index layer) const { return m_OutputSlotOffsets[layer + 1]; }
+
+    /// Returns the output slot connected to an input slot, or Unconnected.
+    Index GetConnectedOutputSlot(Index inputSlot) const { return m_ConnectedOutputSlots[inputSlot]; }
+
+    Index GetOwningLayer(Index outputSlot) const { return m_OutputSlotOwners[outputSlot]; }
+
+    Index GetFirstConsumer(Index outputSlot) const { return m_ConsumerOffsets[outputSlot]; }
+    Index GetEndConsumer(Index outputSlot) const { return m_ConsumerOffsets[outputSlot + 1]; }
+
+    /// Returns the layer owning the input slot of a connection.
+    Index GetConsumingLayer(Index consumer) const { return m_ConsumingLayers[consumer]; }
+
+    /// Returns the layers in topological order: inputs first, outputs last and every other layer after all of its
+    /// ancestors, ordered by the length of the longest path to it and otherwise kept in the order of the Graph.
+    /// The length of that path, which the layers are sorted by, is written to priorities.
+    /// Throws GraphValidationException if the Graph has a cycle.
+    std::vector<Index> GetTopologicalOrder(std::vector<LayerPriority>& priorities) const;
+
+private:
+    std::vector<const Layer*> m_Layers;
+    std::vector<const OutputSlot*> m_OutputSlots;
+
+    std::vector<Index> m_InputSlotOffsets;
+    std::vector<Index> m_OutputSlotOffsets;
+    std::vector<Index> m_ConnectedOutputSlots;
+    std::vector<Index> m_OutputSlotOwners;
+    std::vector<Index> m_ConsumerOffsets;
+    std::vector<Index> m_ConsumingLayers;
+};
+
+} // namespace armnn
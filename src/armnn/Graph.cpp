@@ -4,6 +4,7 @@
 //
 
 #include "Graph.hpp"
+#include "FlatGraph.hpp"
 #include "SubgraphView.hpp"
 #include "LayersFwd.hpp"
 
@@ -202,15 +203,25 @@ Status Graph::AllocateDynamicBuffers()
         return tensorHandle && preallocatedTensors.find(tensorHandle) != preallocatedTensors.end();
     };
 
+    // Walks the flat copy of the graph, which is in the same topological order, and looks up the buffer of each
+    // output slot once rather than again for each of its consumers
+    const FlatGraph flatGraph(*this);
+    std::vector<ITensorHandle*> outputSlotHandles(flatGraph.GetNumOutputSlots());
+    for (FlatGraph::Index outputSlot = 0; outputSlot < flatGraph.GetNumOutputSlots(); ++outputSlot)
+    {
+        outputSlotHandles[outputSlot] =
+            TraceSubTensorHandleAncestry(flatGraph.GetOutputSlot(outputSlot).GetOutputHandler().GetData());
+    }
+
     // Constant tensor handles need to last from the beginning of execution till the end,
     // therefore we pre-allocate them upfront
-    for (auto&& layer : m_Layers)
+    for (FlatGraph::Index layer = 0; layer < flatGraph.GetNumLayers(); ++layer)
     {
-        if (layer->GetType() == LayerType::Constant)
+        if (flatGraph.GetLayer(layer).GetType() == LayerType::Constant)
         {
-            for (auto&& slot = layer->BeginOutputSlots(); slot != layer->EndOutputSlots(); ++slot)
+            for (auto slot = flatGraph.GetFirstOutputSlot(layer); slot < flatGraph.GetEndOutputSlot(layer); ++slot)
             {
-                ITensorHandle *tensorHandle = TraceSubTensorHandleAncestry(slot->GetOutputHandler().GetData());
+                ITensorHandle *tensorHandle = outputSlotHandles[slot];
 
                 if (tensorHandle && !IsPreallocated(tensorHandle))
                 {
@@ -222,17 +233,17 @@ Status Graph::AllocateDynamicBuffers()
     }
 
     // Iterate over the network in topological order
-    for (auto&& layer : m_Layers)
+    for (FlatGraph::Index layer = 0; layer < flatGraph.GetNumLayers(); ++layer)
     {
         // Count the amount of times each output slot references a certain buffer (ITensorHandle).
         // The first time we encounter a new tensor handle, we start managing its lifetime.
-        for (auto&& slot = layer->BeginOutputSlots(); slot != layer->EndOutputSlots(); ++slot)
+        for (auto slot = flatGraph.GetFirstOutputSlot(layer); slot < flatGraph.GetEndOutputSlot(layer); ++slot)
         {
-            ITensorHandle *tensorHandle = TraceSubTensorHandleAncestry(slot->GetOutputHandler().GetData());
+            ITensorHandle *tensorHandle = outputSlotHandles[slot];
 
             if (tensorHandle && !IsPreallocated(tensorHandle))
             {
-                unsigned int numConnections = slot->GetNumConnections();
+                unsigned int numConnections = flatGraph.GetEndConsumer(slot) - flatGraph.GetFirstConsumer(slot);
                 if (handleReferenceCounts.find(tensorHandle) == handleReferenceCounts.end())
                 {
                     handleReferenceCounts[tensorHandle] = numConnections;
@@ -252,10 +263,14 @@ Status Graph::AllocateDynamicBuffers()
 
         // Loop through the input slots in the same layer and decrement the reference counter associated
         // to each tensor handle we encounter. Once it reaches zero, we end the lifetime of the tensor handle
-        for (auto&& slot = layer->BeginInputSlots(); slot != layer->EndInputSlots(); ++slot)
+        for (auto slot = flatGraph.GetFirstInputSlot(layer); slot < flatGraph.GetEndInputSlot(layer); ++slot)
         {
-            ITensorHandle *tensorHandle = TraceSubTensorHandleAncestry(
-                slot->GetConnectedOutputSlot()->GetOutputHandler().GetData());
+            const FlatGraph::Index connectedSlot = flatGraph.GetConnectedOutputSlot(slot);
+            if (connectedSlot == FlatGraph::Unconnected)
+            {
+                continue;
+            }
+            ITensorHandle *tensorHandle = outputSlotHandles[connectedSlot];
 
             if (tensorHandle && !IsPreallocated(tensorHandle))
             {
@@ -278,18 +293,24 @@ const Graph& Graph::TopologicalSort() const
 {
     if (!m_LayersInOrder)
     {
-        // Resets layer order.
-        for (auto&& it : m_Layers)
+        // Orders the layers on a flat copy of the graph, which walks it without recursion, then moves them into
+        // that order. Splicing keeps the iterators to the layers valid.
+        std::vector<LayerPriority> priorities;
+        const FlatGraph flatGraph(*this);
+        const std::vector<FlatGraph::Index> order = flatGraph.GetTopologicalOrder(priorities);
+
+        std::vector<LayerList::iterator> positions;
+        positions.reserve(m_Layers.size());
+        for (auto it = m_Layers.begin(); it != m_Layers.end(); ++it)
         {
-            it->ResetPriority();
+            positions.push_back(it);
         }
 
-        auto compareLayerPriority = [](const LayerList::value_type& layerA, const LayerList::value_type& layerB)
-            {
-                return layerA->GetPriority() < layerB->GetPriority();
-            };
-
-        m_Layers.sort(compareLayerPriority);
+        for (FlatGraph::Index layer : order)
+        {
+            (*positions[layer])->SetPriority(priorities[layer]);
+            m_Layers.splice(m_Layers.end(), m_Layers, positions[layer]);
+        }
 
         m_LayersInOrder = true;
     }
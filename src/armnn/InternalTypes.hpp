@@ -74,6 +74,7 @@
     X(StridedSlice) \
     X(Subtraction) \
     X(Switch) \
+    X(TensorStats) \
     X(Transpose) \
     X(TransposeConvolution2d) \
     X(Unmap)
@@ -295,6 +295,12 @@ void Layer::ResetPriority() const
     m_Visiting = false;
 }
 
+void Layer::SetPriority(LayerPriority priority) const
+{
+    m_Priority = priority;
+    m_Visiting = false;
+}
+
 LayerPriority Layer::GetPriority() const
 {
     constexpr LayerPriority inputPrio = std::numeric_limits<LayerPriority>::lowest();
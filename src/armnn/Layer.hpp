@@ -257,6 +257,7 @@ public:
 
     // Used for sorting.
     void ResetPriority() const;
+    void SetPriority(LayerPriority priority) const;
     LayerPriority GetPriority() const;
 
     LayerType GetType() const { return m_Type; }
@@ -0,0 +1,156 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "LayerSupportCache.hpp"
+
+#include "Layer.hpp"
+
+#include <armnn/BackendRegistry.hpp>
+#include <armnn/TypesUtils.hpp>
+#include <backendsCommon/CpuTensorHandle.hpp>
+#include <backendsCommon/WorkloadFactory.hpp>
+
+#include <sstream>
+
+namespace armnn
+{
+
+namespace
+{
+
+void AppendTensorInfo(std::ostream& key, const TensorInfo& info)
+{
+    key << info.GetShape() << GetDataTypeName(info.GetDataType());
+    if (info.IsQuantized())
+    {
+        key << "(";
+        for (float scale : info.GetQuantizationScales())
+        {
+            key << scale << ",";
+        }
+        key << info.GetQuantizationOffset();
+        if (info.GetQuantizationDim().has_value())
+        {
+            key << ",dim" << info.GetQuantizationDim().value();
+        }
+        key << ")";
+    }
+    key << ";";
+}
+
+/// Describes everything IWorkloadFactory::IsLayerSupported looks at for this layer
+std::string MakeKey(Layer& layer, Optional<DataType> dataType)
+{
+    std::stringstream key;
+    key.precision(9);
+    key << layer.GetBackendId().Get() << "|" << GetLayerTypeAsCString(layer.GetType()) << "|";
+    if (dataType.has_value())
+    {
+        key << GetDataTypeName(dataType.value());
+    }
+
+    key << "|params:";
+    ParameterStringifyFunction appendParameter = [&key](const std::string& name, const std::string& value)
+    {
+        // The identity of the layer does not affect its support
+        if (name != "Guid" && name != "LayerName")
+        {
+            key << name << "=" << value << ";";
+        }
+    };
+    layer.SerializeLayerParameters(appendParameter);
+
+    key << "|inputs:";
+    for (const InputSlot& inputSlot : layer.GetInputSlots())
+    {
+        const OutputSlot* connection = inputSlot.GetConnectedOutputSlot();
+        if (connection != nullptr)
+        {
+            AppendTensorInfo(key, connection->GetTensorInfo());
+        }
+        else
+        {
+            key << "none;";
+        }
+    }
+
+    key << "|outputs:";
+    for (const OutputSlot& outputSlot : layer.GetOutputSlots())
+    {
+        AppendTensorInfo(key, outputSlot.GetTensorInfo());
+    }
+
+    key << "|constants:";
+    layer.OperateOnConstantTensors([&key](std::unique_ptr<ScopedCpuTensorHandle>& constant)
+    {
+        AppendTensorInfo(key, constant->GetTensorInfo());
+    });
+
+    return key.str();
+}
+
+} // anonymous namespace
+
+LayerSupportCache& LayerSupportCache::GetInstance()
+{
+    static LayerSupportCache instance;
+    return instance;
+}
+
+bool LayerSupportCache::IsLayerSupported(Layer& layer,
+                                         Optional<DataType> dataType,
+                                         std::string& outReasonIfUnsupported)
+{
+    // Support queries for these layers depend on more than their configuration: the reason given for an
+    // unregistered backend names the layer, and precompiled and stand-in layers carry backend specific objects
+    if (!BackendRegistryInstance().IsBackendRegistered(layer.GetBackendId()) ||
+        layer.GetType() == LayerType::PreCompiled ||
+        layer.GetType() == LayerType::StandIn)
+    {
+        return IWorkloadFactory::IsLayerSupported(layer, dataType, outReasonIfUnsupported);
+    }
+
+    const std::string key = MakeKey(layer, dataType);
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto it = m_Results.find(key);
+        if (it != m_Results.end())
+        {
+            if (!it->second.m_IsSupported)
+            {
+                outReasonIfUnsupported = it->second.m_ReasonIfUnsupported;
+            }
+            return it->second.m_IsSupported;
+        }
+    }
+
+    // Queried without holding the lock, so concurrent Optimize calls do not wait on each other. Two threads
+    // may query the same configuration, which yields the same result.
+    std::string reasonIfUnsupported;
+    const bool isSupported = IWorkloadFactory::IsLayerSupported(layer, dataType, reasonIfUnsupported);
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Results.emplace(key, Result{ isSupported, reasonIfUnsupported });
+    }
+
+    if (!isSupported)
+    {
+        outReasonIfUnsupported = reasonIfUnsupported;
+    }
+    return isSupported;
+}
+
+void LayerSupportCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Results.clear();
+}
+
+size_t LayerSupportCache::GetNumEntries() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Results.size();
+}
+
+} // namespace armnn
@@ -0,0 +1,48 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/Optional.hpp>
+#include <armnn/Types.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace armnn
+{
+
+class Layer;
+
+/// Process-wide memo of IWorkloadFactory::IsLayerSupported, used when assigning backends to layers.
+/// Results are keyed by the backend, the layer type, the serialized layer parameters and the infos of the input,
+/// output and constant tensors of the layer, so layers with the same configuration only query the backend once.
+/// The cache is cleared whenever a backend is registered or deregistered.
+class LayerSupportCache
+{
+public:
+    static LayerSupportCache& GetInstance();
+
+    /// Same as IWorkloadFactory::IsLayerSupported for the backend assigned to layer.
+    bool IsLayerSupported(Layer& layer, Optional<DataType> dataType, std::string& outReasonIfUnsupported);
+
+    void Clear();
+
+    /// Number of distinct layer configurations whose support is cached.
+    size_t GetNumEntries() const;
+
+private:
+    struct Result
+    {
+        bool m_IsSupported;
+        std::string m_ReasonIfUnsupported;
+    };
+
+    mutable std::mutex m_Mutex;
+    std::unordered_map<std::string, Result> m_Results;
+};
+
+} // namespace armnn
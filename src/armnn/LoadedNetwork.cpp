@@ -7,6 +7,7 @@
 #include "Layer.hpp"
 #include "Graph.hpp"
 #include "Network.hpp"
+#include "NetworkUtils.hpp"
 #include <Processes.hpp>
 #include "Profiling.hpp"
 #include "HeapProfiling.hpp"
@@ -14,6 +15,7 @@
 #include <armnn/BackendRegistry.hpp>
 #include <armnn/Logging.hpp>
 #include <armnn/utility/Assert.hpp>
+#include <armnn/utility/PolymorphicDowncast.hpp>
 
 #include <backendsCommon/CpuTensorHandle.hpp>
 #include <armnn/backends/IMemoryManager.hpp>
@@ -78,12 +80,57 @@ void AddWorkloadStructure(std::unique_ptr<TimelineUtilityMethods>& timelineUtils
                                       LabelsAndEventClasses::CHILD_GUID);
 }
 
+const ConstTensor& GetInputTensor(LayerBindingId id, const InputTensors& inputTensors)
+{
+    auto it = std::find_if(inputTensors.begin(), inputTensors.end(),
+                           [id](const std::pair<LayerBindingId, ConstTensor>& input) { return input.first == id; });
+    if (it == inputTensors.end())
+    {
+        throw InvalidArgumentException(fmt::format("No tensor supplied for input {}", id));
+    }
+    return it->second;
+}
+
+/// Gives the inputs of graph the shapes of inputTensors and infers the shapes of the other tensors from them.
+void InferShapesFromInputs(Graph& graph, const InputTensors& inputTensors)
+{
+    for (Layer* layer : graph.TopologicalSort())
+    {
+        if (layer->GetType() == LayerType::Input)
+        {
+            const auto inputLayer = PolymorphicDowncast<const InputLayer*>(layer);
+            TensorInfo info = layer->GetOutputSlot(0).GetTensorInfo();
+            info.SetShape(GetInputTensor(inputLayer->GetBindingId(), inputTensors).GetShape());
+            layer->GetOutputSlot(0).SetTensorInfo(info);
+            continue;
+        }
+
+        // The shapes of layers without inputs, like constants, do not depend on the input shapes
+        if (layer->GetNumInputSlots() == 0)
+        {
+            continue;
+        }
+
+        // Forget the loaded shapes so that they are not validated against the new ones
+        layer->SetShapeInferenceMethod(ShapeInferenceMethod::InferAndValidate);
+        for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
+        {
+            TensorInfo info = layer->GetOutputSlot(i).GetTensorInfo();
+            info.SetShape(TensorShape(Dimensionality::NotSpecified));
+            layer->GetOutputSlot(i).SetTensorInfo(info);
+        }
+        layer->ValidateTensorShapesFromInputs();
+    }
+}
+
 } // anonymous
 
 std::unique_ptr<LoadedNetwork> LoadedNetwork::MakeLoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
                                                                 std::string& errorMessage,
                                                                 const INetworkProperties& networkProperties,
-                                                                profiling::ProfilingService&  profilingService)
+                                                                profiling::ProfilingService&  profilingService,
+                                                                ConstantTensorStore& constantTensorStore,
+                                                                std::shared_ptr<Profiler> profiler)
 {
     std::unique_ptr<LoadedNetwork> loadedNetwork;
 
@@ -97,7 +144,8 @@ std::unique_ptr<LoadedNetwork> LoadedNetwork::MakeLoadedNetwork(std::unique_ptr<
 
     try
     {
-        loadedNetwork.reset(new LoadedNetwork(std::move(net), networkProperties, profilingService));
+        loadedNetwork.reset(new LoadedNetwork(std::move(net), networkProperties, profilingService,
+                                              constantTensorStore, std::move(profiler)));
     }
     catch (const armnn::RuntimeException& error)
     {
@@ -117,15 +165,19 @@ std::unique_ptr<LoadedNetwork> LoadedNetwork::MakeLoadedNetwork(std::unique_ptr<
 
 LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
                              const INetworkProperties& networkProperties,
-                             profiling::ProfilingService&  profilingService) :
+                             profiling::ProfilingService&  profilingService,
+                             ConstantTensorStore& constantTensorStore,
+                             std::shared_ptr<Profiler> profiler) :
                              m_OptimizedNetwork(std::move(net)),
                              m_IsImportEnabled(networkProperties.m_ImportEnabled),
                              m_IsExportEnabled(networkProperties.m_ExportEnabled),
+                             m_InputSource(networkProperties.m_InputSource),
                              m_TensorHandleFactoryRegistry(),
-                             m_ProfilingService(profilingService)
+                             m_ProfilingService(profilingService),
+                             m_ConstantTensorStore(constantTensorStore)
 {
-    // Create a profiler and register it for the current thread.
-    m_Profiler = std::make_shared<Profiler>();
+    // Create a profiler, unless one was given, and register it for the current thread.
+    m_Profiler = profiler ? std::move(profiler) : std::make_shared<Profiler>();
     ProfilerManager::GetInstance().RegisterProfiler(m_Profiler.get());
 
     Graph& order = m_OptimizedNetwork->GetGraph().TopologicalSort();
@@ -171,19 +223,19 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
         case LayerType::Input:
         case LayerType::MemImport:
             {
-                // If IsImportEnabled is true then we need to set IsMemoryManaged to false when creating TensorHandles
-                layer->CreateTensorHandles(m_TensorHandleFactoryRegistry, workloadFactory, !m_IsImportEnabled);
+                // If IsImportEnabled is true then we need to set IsMemoryManaged to false when creating TensorHandles.
+                // The same goes for inputs passed straight to an output which gets exported.
+                layer->CreateTensorHandles(m_TensorHandleFactoryRegistry, workloadFactory,
+                                           !m_IsImportEnabled && !IsExportable(*layer));
                 break;
             }
         default:
             {
-                // Look for the layer with 1 OutputSlot which has 1 connection and that connection is an Output Layer
+                // Look for the layer whose output is also an output of the network
                 // If Export is enabled disable memory management so we can export, otherwise we do a copy
-                if((layer->GetNumOutputSlots() == 1) &&
-                   (layer->GetOutputSlots()[0].GetNumConnections() == 1) &&
-                   (layer->GetOutputSlots()[0].GetConnection(0)->GetOwningLayer().GetType() == LayerType::Output))
+                if (IsExportable(*layer))
                 {
-                    layer->CreateTensorHandles(m_TensorHandleFactoryRegistry, workloadFactory, !m_IsExportEnabled);
+                    layer->CreateTensorHandles(m_TensorHandleFactoryRegistry, workloadFactory, false);
                 }
                 else
                 {
@@ -208,6 +260,46 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
         timelineUtils->MarkEntityWithLabel(networkGuid, ss.str(), LabelsAndEventClasses::PROCESS_ID_GUID);
     }
 
+    // Share the constant tensors with the other networks of the runtime holding identical data, so that the
+    // workloads, which take their constants from the layers, borrow a single copy of them.
+    for (auto&& layer : order)
+    {
+        layer->OperateOnConstantTensors([&](std::unique_ptr<ScopedCpuTensorHandle>& handle)
+        {
+            const void* data = handle->GetConstTensor<void>();
+            if (handle->IsMemoryBorrowed() || data == nullptr)
+            {
+                return;
+            }
+
+            const TensorInfo& tensorInfo = handle->GetTensorInfo();
+            m_SharedConstants.push_back(constantTensorStore.GetSharedMemory(data, tensorInfo.GetNumBytes()));
+            handle = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(tensorInfo, m_SharedConstants.back().get()),
+                                                             true);
+        });
+    }
+
+    // Keep the constants, which the workloads release, for the workloads of the shape plans
+    if (networkProperties.m_DynamicInputShapesEnabled)
+    {
+        m_ShapePlanGraph = CloneOptimizedGraph(m_OptimizedNetwork->GetGraph());
+    }
+
+    // The stages load their own copies of the layers, so they are created while the constants are still there
+    if (networkProperties.m_NumPipelineStages > 1)
+    {
+        if (m_IsImportEnabled && m_InputSource != MemorySource::Malloc)
+        {
+            throw InvalidArgumentException("Pipeline stages can only import inputs allocated with malloc");
+        }
+        m_Pipeline = std::make_unique<NetworkPipeline>(m_OptimizedNetwork->GetGraph(),
+                                                       m_OptimizedNetwork->GetModelOptions(),
+                                                       networkProperties.m_NumPipelineStages,
+                                                       networkProperties,
+                                                       m_ProfilingService,
+                                                       constantTensorStore);
+    }
+
     //Then create workloads.
     for (auto&& layer : order)
     {
@@ -260,6 +352,15 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
         workloadFactory.second.first->AfterWorkloadsCreated();
     }
 
+    if (m_IsExportEnabled)
+    {
+        for (auto&& outputReason : GetOutputCopyReasons())
+        {
+            ARMNN_LOG(info) << "Output " << outputReason.first << " is copied rather than exported because "
+                            << outputReason.second;
+        }
+    }
+
     if (timelineUtils)
     {
         // Commit to send the post-optimisation network structure
@@ -347,6 +448,79 @@ TensorInfo LoadedNetwork::GetOutputTensorInfo(LayerBindingId layerId) const
     throw InvalidArgumentException(fmt::format("No output layer is associated with id {}", layerId));
 }
 
+std::map<LayerBindingId, std::string> LoadedNetwork::GetOutputCopyReasons() const
+{
+    std::map<LayerBindingId, std::string> reasons;
+    for (auto&& outputLayer : m_OptimizedNetwork->GetGraph().GetOutputLayers())
+    {
+        const char* reason = GetOutputCopyReason(*outputLayer);
+        if (reason)
+        {
+            reasons.emplace(outputLayer->GetBindingId(), reason);
+        }
+    }
+    return reasons;
+}
+
+namespace
+{
+
+/// The Output layer the tensor of slot gets exported to, i.e. the first one reading it, if any.
+const Layer* GetExportingOutputLayer(const OutputSlot& slot)
+{
+    for (auto&& connection : slot.GetConnections())
+    {
+        if (connection->GetOwningLayer().GetType() == LayerType::Output)
+        {
+            return &connection->GetOwningLayer();
+        }
+    }
+    return nullptr;
+}
+
+} // anonymous
+
+bool LoadedNetwork::IsExportable(const Layer& layer) const
+{
+    // The tensor handles of a layer are either all memory managed or none are, so layers with several outputs keep
+    // theirs managed. The other layers reading an exported tensor read it from the output buffer.
+    return m_IsExportEnabled &&
+           layer.GetNumOutputSlots() == 1 &&
+           !(layer.GetType() == LayerType::Input && m_IsImportEnabled) &&
+           GetExportingOutputLayer(layer.GetOutputSlot(0)) != nullptr;
+}
+
+const char* LoadedNetwork::GetOutputCopyReason(const Layer& outputLayer) const
+{
+    const OutputSlot* producer = outputLayer.GetInputSlot(0).GetConnectedOutputSlot();
+    const Layer& producerLayer = producer->GetOwningLayer();
+
+    if (!m_IsExportEnabled)
+    {
+        return "export is disabled";
+    }
+    if (producerLayer.GetNumOutputSlots() != 1)
+    {
+        return "it comes from a layer with several outputs";
+    }
+    if (producerLayer.GetType() == LayerType::Input && m_IsImportEnabled)
+    {
+        return "it comes straight from an input, which gets imported";
+    }
+    if (GetExportingOutputLayer(*producer) != &outputLayer)
+    {
+        return "another output is exported from the same tensor";
+    }
+
+    // Sub-tensors, for instance, cannot import
+    const ITensorHandle* handle = producer->GetOutputHandler().GetData();
+    if (!handle || !CheckFlag(handle->GetImportFlags(), MemorySource::Malloc))
+    {
+        return "its tensor handle cannot import memory";
+    }
+    return nullptr;
+}
+
 const IWorkloadFactory& LoadedNetwork::GetWorkloadFactory(const Layer& layer) const
 {
     const IWorkloadFactory* workloadFactory = nullptr;
@@ -417,8 +591,10 @@ static const TensorPin& GetTensorPin(LayerBindingId id,
     }
 }
 
+} // anonymous
+
 // Stores data that needs to be kept accessible for the entire execution of a workload.
-class WorkloadData
+class LoadedNetwork::WorkloadData
 {
 public:
     WorkloadData(const InputTensors& inputTensors, const OutputTensors& outputTensors)
@@ -426,9 +602,9 @@ public:
         m_InputTensorPins.reserve(inputTensors.size());
         m_OutputTensorPins.reserve(outputTensors.size());
 
-        for (auto inputTensorPair : inputTensors)
+        for (auto&& inputTensorPair : inputTensors)
         {
-            auto inputTensor = inputTensorPair.second;
+            const ConstTensor& inputTensor = inputTensorPair.second;
 
             std::unique_ptr<ITensorHandle> tensorHandle =
                 std::make_unique<ConstPassthroughCpuTensorHandle>(inputTensor.GetInfo(),inputTensor.GetMemoryArea());
@@ -437,9 +613,9 @@ public:
             m_InputTensorPins.emplace_back(std::move(tensorHandle), inputTensor.GetInfo(), layerId);
         }
 
-        for (auto outputTensorPair : outputTensors)
+        for (auto&& outputTensorPair : outputTensors)
         {
-            auto outputTensor = outputTensorPair.second;
+            const Tensor& outputTensor = outputTensorPair.second;
 
             std::unique_ptr<ITensorHandle> tensorHandle =
                 std::make_unique<PassthroughCpuTensorHandle>(outputTensor.GetInfo(), outputTensor.GetMemoryArea());
@@ -459,14 +635,14 @@ public:
         return GetTensorPin(id, m_OutputTensorPins, "output");
     }
 
+    size_t GetNumInputs() const { return m_InputTensorPins.size(); }
+
 private:
 
     std::vector<TensorPin> m_InputTensorPins;
     std::vector<TensorPin> m_OutputTensorPins;
 };
 
-}
-
 Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
                                       const OutputTensors& outputTensors)
 {
@@ -479,10 +655,44 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
         return Status::Failure;
     }
 
+    if (m_ShapePlanGraph)
+    {
+        LoadedNetwork* shapePlan = GetShapePlan(inputTensors);
+        if (shapePlan)
+        {
+            for (auto&& outputTensor : outputTensors)
+            {
+                const TensorShape& shape = shapePlan->GetOutputTensorInfo(outputTensor.first).GetShape();
+                if (outputTensor.second.GetShape() != shape)
+                {
+                    throw InvalidArgumentException(
+                        fmt::format("Output {0} has {1} elements but {2} are produced for the given input shapes",
+                                    outputTensor.first,
+                                    outputTensor.second.GetNumElements(),
+                                    shape.GetNumElements()));
+                }
+            }
+            return shapePlan->EnqueueWorkload(inputTensors, outputTensors);
+        }
+    }
+
     // Data that must be kept alive for the entire execution of the workload.
     WorkloadData workloadData(inputTensors, outputTensors);
 
-    if (graph.GetNumInputs() != inputTensors.size())
+    std::vector<TensorImport> imports;
+    PrepareTensors(workloadData, m_InputQueue, m_OutputQueue, imports);
+
+    return RunInference(m_InputQueue, m_OutputQueue);
+}
+
+void LoadedNetwork::PrepareTensors(const WorkloadData& workloadData,
+                                   WorkloadQueue& inputQueue,
+                                   WorkloadQueue& outputQueue,
+                                   std::vector<TensorImport>& imports)
+{
+    const Graph& graph = m_OptimizedNetwork->GetGraph();
+
+    if (graph.GetNumInputs() != workloadData.GetNumInputs())
     {
         throw InvalidArgumentException("Number of inputs provided does not match network.");
     }
@@ -490,27 +700,30 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
     // For each input to the network, call EnqueueInput with the data passed by the user.
     {
         ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "PrepareInputs");
-        m_InputQueue.clear();
-        m_InputQueue.reserve(graph.GetNumInputs());
+        inputQueue.clear();
+        inputQueue.reserve(graph.GetNumInputs());
         for (const BindableLayer* inputLayer : graph.GetInputLayers())
         {
             const TensorPin& pin = workloadData.GetInputTensorPin(inputLayer->GetBindingId());
-            EnqueueInput(*inputLayer, pin.GetTensorHandle(), pin.GetTensorInfo());
+            EnqueueInput(*inputLayer, pin.GetTensorHandle(), pin.GetTensorInfo(), inputQueue, imports);
         }
     }
 
     // For each output to the network, call EnqueueOutput with the data passed by the user.
     {
         ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "PrepareOutputs");
-        m_OutputQueue.clear();
-        m_OutputQueue.reserve(graph.GetNumOutputs());
+        outputQueue.clear();
+        outputQueue.reserve(graph.GetNumOutputs());
         for (const BindableLayer* outputLayer : graph.GetOutputLayers())
         {
             const TensorPin& pin = workloadData.GetOutputTensorPin(outputLayer->GetBindingId());
-            EnqueueOutput(*outputLayer, pin.GetTensorHandle(), pin.GetTensorInfo());
+            EnqueueOutput(*outputLayer, pin.GetTensorHandle(), pin.GetTensorInfo(), outputQueue, imports);
         }
     }
+}
 
+Status LoadedNetwork::RunInference(WorkloadQueue& inputQueue, WorkloadQueue& outputQueue)
+{
     std::unique_ptr<TimelineUtilityMethods> timelineUtils =
                         TimelineUtilityMethods::GetTimelineUtils(m_ProfilingService);
     ProfilingGuid inferenceGuid = m_ProfilingService.GetNextGuid();
@@ -535,7 +748,7 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
         }
         ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "Execute");
         ARMNN_SCOPED_HEAP_PROFILING("Executing");
-        executionSucceeded = Execute(timelineUtils, inferenceGuid);
+        executionSucceeded = Execute(inputQueue, outputQueue, timelineUtils, inferenceGuid);
     }
 
     if (timelineUtils)
@@ -547,7 +760,171 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
     return executionSucceeded ? Status::Success : Status::Failure;
 }
 
-void LoadedNetwork::EnqueueInput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo)
+/// Tensors bound by RegisterTensors, with the input and output workloads created for them.
+struct LoadedNetwork::BoundTensors
+{
+    BoundTensors(const InputTensors& inputTensors, const OutputTensors& outputTensors)
+        : m_WorkloadData(inputTensors, outputTensors)
+    {}
+
+    WorkloadData m_WorkloadData;
+    WorkloadQueue m_InputQueue;
+    WorkloadQueue m_OutputQueue;
+    std::vector<TensorImport> m_Imports;
+};
+
+void LoadedNetwork::RegisterTensors(BoundTensorsId boundTensorsId,
+                                    const InputTensors& inputTensors,
+                                    const OutputTensors& outputTensors)
+{
+    if (m_ShapePlanGraph && GetShapePlan(inputTensors))
+    {
+        throw InvalidArgumentException("Only tensors of the input shapes the network was loaded with can be bound");
+    }
+
+    auto boundTensors = std::make_unique<BoundTensors>(inputTensors, outputTensors);
+    PrepareTensors(boundTensors->m_WorkloadData,
+                   boundTensors->m_InputQueue,
+                   boundTensors->m_OutputQueue,
+                   boundTensors->m_Imports);
+
+    std::lock_guard<std::mutex> lockGuard(m_BoundTensorsMutex);
+    m_BoundTensors[boundTensorsId] = std::move(boundTensors);
+}
+
+void LoadedNetwork::UnregisterTensors(BoundTensorsId boundTensorsId)
+{
+    std::lock_guard<std::mutex> lockGuard(m_BoundTensorsMutex);
+    m_BoundTensors.erase(boundTensorsId);
+}
+
+Status LoadedNetwork::Execute(BoundTensorsId boundTensorsId)
+{
+    BoundTensors* boundTensors = nullptr;
+    {
+        std::lock_guard<std::mutex> lockGuard(m_BoundTensorsMutex);
+        auto it = m_BoundTensors.find(boundTensorsId);
+        if (it == m_BoundTensors.end())
+        {
+            throw InvalidArgumentException(fmt::format("No tensors are bound with id {}", boundTensorsId));
+        }
+        boundTensors = it->second.get();
+    }
+
+    // Other inferences may have imported other memory into the same tensor handles since
+    for (auto&& import : boundTensors->m_Imports)
+    {
+        if (!import.m_TensorHandle->Import(import.m_Memory, import.m_Source))
+        {
+            throw MemoryImportException("Execute: Memory Import failed");
+        }
+    }
+
+    return RunInference(boundTensors->m_InputQueue, boundTensors->m_OutputQueue);
+}
+
+Status LoadedNetwork::EnqueueWorkloads(const std::vector<InputTensors>& inputTensors,
+                                       const std::vector<OutputTensors>& outputTensors)
+{
+    if (m_Pipeline)
+    {
+        return m_Pipeline->Run(inputTensors, outputTensors);
+    }
+
+    if (inputTensors.size() != outputTensors.size())
+    {
+        throw InvalidArgumentException("There must be as many sets of output tensors as of input tensors");
+    }
+    for (size_t i = 0; i < inputTensors.size(); ++i)
+    {
+        if (EnqueueWorkload(inputTensors[i], outputTensors[i]) != Status::Success)
+        {
+            return Status::Failure;
+        }
+    }
+    return Status::Success;
+}
+
+LoadedNetwork* LoadedNetwork::GetShapePlan(const InputTensors& inputTensors)
+{
+    ShapeSignature signature;
+    bool isLoadedShape = true;
+    for (const BindableLayer* inputLayer : m_OptimizedNetwork->GetGraph().GetInputLayers())
+    {
+        const TensorShape& shape = GetInputTensor(inputLayer->GetBindingId(), inputTensors).GetShape();
+        isLoadedShape = isLoadedShape && shape == inputLayer->GetOutputSlot(0).GetTensorInfo().GetShape();
+
+        signature.push_back(shape.GetNumDimensions());
+        for (unsigned int i = 0; i < shape.GetNumDimensions(); ++i)
+        {
+            signature.push_back(shape[i]);
+        }
+    }
+
+    std::lock_guard<std::mutex> lockGuard(m_ShapePlansMutex);
+
+    LoadedNetwork* shapePlan = nullptr;
+    if (!isLoadedShape)
+    {
+        auto it = m_ShapePlans.find(signature);
+        if (it == m_ShapePlans.end())
+        {
+            ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "CreateShapePlan");
+
+            std::unique_ptr<Graph> graph = CloneOptimizedGraph(*m_ShapePlanGraph);
+            try
+            {
+                InferShapesFromInputs(*graph, inputTensors);
+            }
+            catch (const LayerValidationException& error)
+            {
+                throw InvalidArgumentException(ToErrorMessage("The network does not support the given input shapes:",
+                                                              error));
+            }
+
+            auto net = std::make_unique<OptimizedNetwork>(std::move(graph), m_OptimizedNetwork->GetModelOptions());
+            INetworkProperties networkProperties(m_IsImportEnabled, m_IsExportEnabled, false, 0, m_InputSource);
+            std::unique_ptr<LoadedNetwork> loadedNetwork(new LoadedNetwork(std::move(net),
+                                                                           networkProperties,
+                                                                           m_ProfilingService,
+                                                                           m_ConstantTensorStore,
+                                                                           m_Profiler));
+            if (m_DebugCallback)
+            {
+                loadedNetwork->RegisterDebugCallback(m_DebugCallback);
+            }
+            if (m_TensorStatsCallback)
+            {
+                loadedNetwork->RegisterTensorStatsCallback(m_TensorStatsCallback);
+            }
+            it = m_ShapePlans.emplace(std::move(signature), std::move(loadedNetwork)).first;
+        }
+        shapePlan = it->second.get();
+    }
+
+    // Like the runtime does between networks, only the plan in use keeps its working memory
+    if (shapePlan != m_LastShapePlan)
+    {
+        if (m_LastShapePlan)
+        {
+            m_LastShapePlan->FreeWorkingMemory();
+        }
+        else
+        {
+            std::lock_guard<std::mutex> workingMemLockGuard(m_WorkingMemMutex);
+            FreeWorkingMemory(workingMemLockGuard);
+        }
+        m_LastShapePlan = shapePlan;
+    }
+
+    return shapePlan;
+}
+
+void LoadedNetwork::EnqueueInput(const BindableLayer& layer,
+                                 ITensorHandle* tensorHandle,
+                                 const TensorInfo& tensorInfo,
+                                 WorkloadQueue& inputQueue,
+                                 std::vector<TensorImport>& imports)
 {
     if (layer.GetType() != LayerType::Input)
     {
@@ -578,19 +955,26 @@ void LoadedNetwork::EnqueueInput(const BindableLayer& layer, ITensorHandle* tens
     bool needMemCopy = true;
     if (m_IsImportEnabled)  // Try import the input tensor
     {
-        if(CheckFlag(importFlags, MemorySource::Malloc) )
+        if(CheckFlag(importFlags, m_InputSource) )
         {
             needMemCopy = false;
-            // This assumes a CPU Tensor handle
+            // This assumes a CPU Tensor handle. For file descriptor sources it holds a FileDescriptorMemory.
             void* mem = tensorHandle->Map(false);
-            if (outputTensorHandle->Import(mem, MemorySource::Malloc))
+            if (outputTensorHandle->Import(mem, m_InputSource))
             {
                 tensorHandle->Unmap();
+                imports.push_back({ outputTensorHandle, mem, m_InputSource });
                 return; // No need for a workload since the import has been done.
             }
             tensorHandle->Unmap();
             throw MemoryImportException("EnqueueInput: Memory Import failed");
         }
+        else if (m_InputSource != MemorySource::Malloc)
+        {
+            // The tensor does not hold the data, so it cannot be copied instead
+            throw MemoryImportException("EnqueueInput: The backend of the input layer cannot import memory from "
+                                        "file descriptors");
+        }
     }
     if (needMemCopy)
     {
@@ -608,11 +992,20 @@ void LoadedNetwork::EnqueueInput(const BindableLayer& layer, ITensorHandle* tens
             timelineUtils->Commit();
         }
 
-        m_InputQueue.push_back(move(inputWorkload));
+        inputQueue.push_back(move(inputWorkload));
     }
 }
 
-void LoadedNetwork::EnqueueOutput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo)
+LoadedNetwork::~LoadedNetwork()
+{
+    FreeWorkingMemory();
+}
+
+void LoadedNetwork::EnqueueOutput(const BindableLayer& layer,
+                                  ITensorHandle* tensorHandle,
+                                  const TensorInfo& tensorInfo,
+                                  WorkloadQueue& outputQueue,
+                                  std::vector<TensorImport>& imports)
 {
     if (layer.GetType() != LayerType::Output)
     {
@@ -639,41 +1032,35 @@ void LoadedNetwork::EnqueueOutput(const BindableLayer& layer, ITensorHandle* ten
     ITensorHandle* inputTensorHandle = outputHandler.GetData();
     ARMNN_ASSERT_MSG(inputTensorHandle != nullptr, "Data should have been allocated.");
 
-    // Try import the output tensor.
+    // Try import the output tensor, so that the producing workload writes straight into the output buffer.
     // Note: We can only import the output pointer if all of the following  hold true:
     // a) The imported pointer is aligned sufficiently
     // b) The tensor has zero padding
-    // c) There is only one connection to the OutputSlot and it is to an OutputLayer.
+    // c) GetOutputCopyReason() gives no reason to copy it instead, see GetOutputCopyReasons().
     // d) The output pointer is allocated via malloc. (Other types will be supported in a later release)
-    // e) m_IsExportEnabled must be set to true
     bool needMemCopy = true;
-    if (m_IsExportEnabled && (layer.GetInputSlots()[0].GetConnectedOutputSlot()->GetNumConnections() == 1))
+    if (!GetOutputCopyReason(layer))
     {
-        if(layer.GetInputSlots()[0].GetConnectedOutputSlot()->GetOwningLayer().GetType() != LayerType::Input)
-        {
-            MemorySourceFlags importFlags = inputTensorHandle->GetImportFlags();
-            if (CheckFlag(importFlags, MemorySource::Malloc))
-            {
-                needMemCopy = false;
-                void *mem = tensorHandle->Map(false);
-                bool importOk = inputTensorHandle->Import(mem, MemorySource::Malloc);
-                tensorHandle->Unmap();
+        needMemCopy = false;
+        void *mem = tensorHandle->Map(false);
+        bool importOk = inputTensorHandle->Import(mem, MemorySource::Malloc);
+        tensorHandle->Unmap();
 
-                if (importOk)
-                {
-                    // Insert synchronization workload
-                    MemSyncQueueDescriptor syncDesc;
-                    syncDesc.m_Inputs.push_back(inputTensorHandle);
-                    info.m_InputTensorInfos.push_back(inputTensorInfo);
-                    auto syncWorkload = std::make_unique<SyncMemGenericWorkload>(syncDesc, info);
-                    ARMNN_ASSERT_MSG(syncWorkload, "No sync workload created");
-                    m_OutputQueue.push_back(move(syncWorkload));
-                }
-                else
-                {
-                    throw MemoryExportException("EnqueueOutput: Memory Export failed");
-                }
-            }
+        if (importOk)
+        {
+            imports.push_back({ inputTensorHandle, mem, MemorySource::Malloc });
+
+            // Insert synchronization workload
+            MemSyncQueueDescriptor syncDesc;
+            syncDesc.m_Inputs.push_back(inputTensorHandle);
+            info.m_InputTensorInfos.push_back(inputTensorInfo);
+            auto syncWorkload = std::make_unique<SyncMemGenericWorkload>(syncDesc, info);
+            ARMNN_ASSERT_MSG(syncWorkload, "No sync workload created");
+            outputQueue.push_back(move(syncWorkload));
+        }
+        else
+        {
+            throw MemoryExportException("EnqueueOutput: Memory Export failed");
         }
     }
     if (needMemCopy)
@@ -695,7 +1082,7 @@ void LoadedNetwork::EnqueueOutput(const BindableLayer& layer, ITensorHandle* ten
             timelineUtils->Commit();
         }
 
-        m_OutputQueue.push_back(move(outputWorkload));
+        outputQueue.push_back(move(outputWorkload));
     }
 }
 
@@ -724,7 +1111,28 @@ void LoadedNetwork::AllocateWorkingMemory(std::lock_guard<std::mutex>& lock)
 
 void LoadedNetwork::FreeWorkingMemory()
 {
-    std::lock_guard<std::mutex> lockGuard(m_WorkingMemMutex);
+    {
+        std::lock_guard<std::mutex> lockGuard(m_WorkingMemMutex);
+        FreeWorkingMemory(lockGuard);
+    }
+
+    if (m_Pipeline)
+    {
+        m_Pipeline->FreeWorkingMemory();
+    }
+
+    std::lock_guard<std::mutex> lockGuard(m_ShapePlansMutex);
+    for (auto&& shapePlan : m_ShapePlans)
+    {
+        shapePlan.second->FreeWorkingMemory();
+    }
+}
+
+void LoadedNetwork::FreeWorkingMemory(std::lock_guard<std::mutex>& lock)
+{
+    // this unused parameter makes sure we can only call this function with a valid lock
+    IgnoreUnused(lock);
+
     if (!m_IsWorkingMemAllocated)
     {
         return;
@@ -742,7 +1150,9 @@ void LoadedNetwork::FreeWorkingMemory()
     m_IsWorkingMemAllocated = false;
 }
 
-bool LoadedNetwork::Execute(std::unique_ptr<TimelineUtilityMethods>& timelineUtils,
+bool LoadedNetwork::Execute(WorkloadQueue& inputQueue,
+                            WorkloadQueue& outputQueue,
+                            std::unique_ptr<TimelineUtilityMethods>& timelineUtils,
                             profiling::ProfilingGuid inferenceGuid)
 {
     bool success = true;
@@ -776,9 +1186,9 @@ bool LoadedNetwork::Execute(std::unique_ptr<TimelineUtilityMethods>& timelineUti
             }
         };
 
-        ExecuteQueue(m_InputQueue);
+        ExecuteQueue(inputQueue);
         ExecuteQueue(m_WorkloadQueue);
-        ExecuteQueue(m_OutputQueue);
+        ExecuteQueue(outputQueue);
     }
     catch (const RuntimeException& error)
     {
@@ -798,6 +1208,36 @@ void LoadedNetwork::RegisterDebugCallback(const DebugCallbackFunction& func)
     {
         workloadPtr.get()->RegisterDebugCallback(func);
     }
+
+    std::lock_guard<std::mutex> lockGuard(m_ShapePlansMutex);
+    m_DebugCallback = func;
+    for (auto&& shapePlan : m_ShapePlans)
+    {
+        shapePlan.second->RegisterDebugCallback(func);
+    }
+    if (m_Pipeline)
+    {
+        m_Pipeline->RegisterDebugCallback(func);
+    }
+}
+
+void LoadedNetwork::RegisterTensorStatsCallback(const TensorStatsCallbackFunction& func)
+{
+    for (auto&& workloadPtr: m_WorkloadQueue)
+    {
+        workloadPtr.get()->RegisterTensorStatsCallback(func);
+    }
+
+    std::lock_guard<std::mutex> lockGuard(m_ShapePlansMutex);
+    m_TensorStatsCallback = func;
+    for (auto&& shapePlan : m_ShapePlans)
+    {
+        shapePlan.second->RegisterTensorStatsCallback(func);
+    }
+    if (m_Pipeline)
+    {
+        m_Pipeline->RegisterTensorStatsCallback(func);
+    }
 }
 
 }
@@ -7,8 +7,10 @@
 #include <armnn/Tensor.hpp>
 #include <armnn/Types.hpp>
 
+#include "ConstantTensorStore.hpp"
 #include "Network.hpp"
 #include "LayerFwd.hpp"
+#include "NetworkPipeline.hpp"
 #include "Profiling.hpp"
 
 #include <armnn/backends/IBackendInternal.hpp>
@@ -18,6 +20,7 @@
 #include <ProfilingService.hpp>
 #include <TimelineUtilityMethods.hpp>
 
+#include <map>
 #include <mutex>
 #include <unordered_map>
 
@@ -35,17 +38,34 @@ class LoadedNetwork
 {
 public:
     using WorkloadQueue = std::vector< std::unique_ptr<IWorkload> >;
-    ~LoadedNetwork(){ FreeWorkingMemory(); }
+    ~LoadedNetwork();
 
     TensorInfo GetInputTensorInfo(LayerBindingId layerId) const;
     TensorInfo GetOutputTensorInfo(LayerBindingId layerId) const;
 
+    /// The outputs copied rather than exported, with the reason why.
+    std::map<LayerBindingId, std::string> GetOutputCopyReasons() const;
+
     Status EnqueueWorkload(const InputTensors& inputTensors, const OutputTensors& outputTensors);
 
+    /// Prepares the input and output workloads for the tensors once, for Execute to run them under boundTensorsId.
+    void RegisterTensors(BoundTensorsId boundTensorsId,
+                         const InputTensors& inputTensors,
+                         const OutputTensors& outputTensors);
+    void UnregisterTensors(BoundTensorsId boundTensorsId);
+    Status Execute(BoundTensorsId boundTensorsId);
+
+    /// Runs the inferences through the pipeline stages of the network if it has some, otherwise one after the other.
+    Status EnqueueWorkloads(const std::vector<InputTensors>& inputTensors,
+                            const std::vector<OutputTensors>& outputTensors);
+
+    /// The loaded network records its events in profiler when one is given, and in a new profiler otherwise
     static std::unique_ptr<LoadedNetwork> MakeLoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
                                                             std::string & errorMessage,
                                                             const INetworkProperties& networkProperties,
-                                                            profiling::ProfilingService& profilingService);
+                                                            profiling::ProfilingService& profilingService,
+                                                            ConstantTensorStore& constantTensorStore,
+                                                            std::shared_ptr<Profiler> profiler = nullptr);
 
     // NOTE we return by reference as the purpose of this method is only to provide
     // access to the private m_Profiler and in theory we should not need to increment
@@ -54,7 +74,9 @@ public:
 
     void FreeWorkingMemory();
 
+    /// The callbacks also reach the shape plans and pipeline stages of the network, including later ones.
     void RegisterDebugCallback(const DebugCallbackFunction& func);
+    void RegisterTensorStatsCallback(const TensorStatsCallbackFunction& func);
 
     void SendNetworkStructure();
 
@@ -63,15 +85,62 @@ public:
 private:
     void AllocateWorkingMemory(std::lock_guard<std::mutex>& lock);
 
-    LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
-                  const INetworkProperties& networkProperties,
-                  profiling::ProfilingService& profilingService);
-
-    void EnqueueInput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo);
+    /// Frees the working memory of this network only, not the one of its shape plans.
+    void FreeWorkingMemory(std::lock_guard<std::mutex>& lock);
 
-    void EnqueueOutput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo);
+    /// Returns the network to run inputTensors with: nullptr when they have the shapes the network was loaded with,
+    /// otherwise the shape plan created for their shapes on first use.
+    LoadedNetwork* GetShapePlan(const InputTensors& inputTensors);
 
-    bool Execute(std::unique_ptr<profiling::TimelineUtilityMethods>& timelineUtils,
+    LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
+                  const INetworkProperties& networkProperties,
+                  profiling::ProfilingService& profilingService,
+                  ConstantTensorStore& constantTensorStore,
+                  std::shared_ptr<Profiler> profiler);
+
+    class WorkloadData;
+    struct BoundTensors;
+
+    /// Memory given by the user that a tensor handle of the network imports. Before an inference on bound tensors
+    /// it gets imported again, as other inferences may have imported other memory into the same handle.
+    struct TensorImport
+    {
+        ITensorHandle* m_TensorHandle;
+        void* m_Memory;
+        MemorySource m_Source;
+    };
+
+    /// Fills inputQueue and outputQueue with the workloads passing the tensors of workloadData in and out of the
+    /// network, importing the memory recorded in imports.
+    void PrepareTensors(const WorkloadData& workloadData,
+                        WorkloadQueue& inputQueue,
+                        WorkloadQueue& outputQueue,
+                        std::vector<TensorImport>& imports);
+
+    void EnqueueInput(const BindableLayer& layer,
+                      ITensorHandle* tensorHandle,
+                      const TensorInfo& tensorInfo,
+                      WorkloadQueue& inputQueue,
+                      std::vector<TensorImport>& imports);
+
+    void EnqueueOutput(const BindableLayer& layer,
+                       ITensorHandle* tensorHandle,
+                       const TensorInfo& tensorInfo,
+                       WorkloadQueue& outputQueue,
+                       std::vector<TensorImport>& imports);
+
+    /// Whether the output of the layer may get exported to an Output layer, in which case its tensor handle is
+    /// created without memory management.
+    bool IsExportable(const Layer& layer) const;
+
+    /// Why the tensor read by the Output layer gets copied to the output buffer, or nullptr if it gets exported.
+    const char* GetOutputCopyReason(const Layer& outputLayer) const;
+
+    Status RunInference(WorkloadQueue& inputQueue, WorkloadQueue& outputQueue);
+
+    bool Execute(WorkloadQueue& inputQueue,
+                 WorkloadQueue& outputQueue,
+                 std::unique_ptr<profiling::TimelineUtilityMethods>& timelineUtils,
                  profiling::ProfilingGuid inferenceGuid);
 
 
@@ -87,6 +156,10 @@ private:
     BackendPtrMap       m_Backends;
     WorkloadFactoryMap  m_WorkloadFactories;
 
+    /// Constant data obtained from the runtime's ConstantTensorStore, borrowed by the layers and workloads.
+    /// Declared first so it outlives them.
+    std::vector<std::shared_ptr<const void>> m_SharedConstants;
+
     std::unique_ptr<OptimizedNetwork> m_OptimizedNetwork;
     WorkloadQueue m_InputQueue;
     WorkloadQueue m_WorkloadQueue;
@@ -98,10 +171,35 @@ private:
     bool m_IsWorkingMemAllocated=false;
     bool m_IsImportEnabled=false;
     bool m_IsExportEnabled=false;
+    MemorySource m_InputSource=MemorySource::Malloc;
 
     TensorHandleFactoryRegistry m_TensorHandleFactoryRegistry;
 
     profiling::ProfilingService&  m_ProfilingService;
+    ConstantTensorStore& m_ConstantTensorStore;
+
+    /// Copy of the optimized graph, still holding its constants, which the shape plans are created from.
+    /// Only set when dynamic input shapes are enabled. Its constants borrow m_SharedConstants.
+    std::unique_ptr<Graph> m_ShapePlanGraph;
+
+    /// The dimensions of the inputs, in the order of the input layers, preceded by their number.
+    using ShapeSignature = std::vector<unsigned int>;
+
+    /// Networks loaded for the input shapes met so far that differ from the loaded ones.
+    std::map<ShapeSignature, std::unique_ptr<LoadedNetwork>> m_ShapePlans;
+    LoadedNetwork* m_LastShapePlan = nullptr;
+    std::mutex m_ShapePlansMutex;
+
+    /// Only set when pipeline stages were requested.
+    std::unique_ptr<NetworkPipeline> m_Pipeline;
+
+    /// The tensors bound by RegisterTensors.
+    std::unordered_map<BoundTensorsId, std::unique_ptr<BoundTensors>> m_BoundTensors;
+    std::mutex m_BoundTensorsMutex;
+
+    /// The registered callbacks, passed on to the shape plans created later.
+    DebugCallbackFunction m_DebugCallback;
+    TensorStatsCallbackFunction m_TensorStatsCallback;
 };
 
 }
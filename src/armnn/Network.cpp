@@ -6,6 +6,7 @@
 #include "Network.hpp"
 #include "Graph.hpp"
 #include "Layer.hpp"
+#include "LayerSupportCache.hpp"
 #include "DeviceSpec.hpp"
 #include "Optimizer.hpp"
 #include "SubgraphViewSelector.hpp"
@@ -188,11 +189,11 @@ OptimizationResult AttemptBackendAssignment(BackendSettings& backendSettings,
     // need to set the compute device on the layer
     // before we can check if it is supported
     layer->SetBackendId(backend);
-    if (!IWorkloadFactory::IsLayerSupported(*layer, EmptyOptional(), reasonIfUnsupported))
+    if (!LayerSupportCache::GetInstance().IsLayerSupported(*layer, EmptyOptional(), reasonIfUnsupported))
     {
         if (dataTypeIn == DataType::Float16 || dataTypeOut == DataType::Float16)
         {
-            if (IWorkloadFactory::IsLayerSupported(*layer, DataType::Float32, reasonIfUnsupported)
+            if (LayerSupportCache::GetInstance().IsLayerSupported(*layer, DataType::Float32, reasonIfUnsupported)
                 && layer->GetType() != LayerType::ConvertFp32ToFp16
                 && layer->GetType() != LayerType::ConvertFp16ToFp32)
             {
@@ -220,9 +221,9 @@ OptimizationResult AttemptBackendAssignment(BackendSettings& backendSettings,
 
                         // Try preferred backend first
                         layer->SetBackendId(preferredBackend);
-                        if (IWorkloadFactory::IsLayerSupported(*layer,
-                                                               EmptyOptional(),
-                                                               reasonIfUnsupported))
+                        if (LayerSupportCache::GetInstance().IsLayerSupported(*layer,
+                                                                              EmptyOptional(),
+                                                                              reasonIfUnsupported))
                         {
                             supportedBackendFound = true;
                         }
@@ -237,9 +238,9 @@ OptimizationResult AttemptBackendAssignment(BackendSettings& backendSettings,
                                 }
 
                                 layer->SetBackendId(backend);
-                                if (IWorkloadFactory::IsLayerSupported(*layer,
-                                                                       EmptyOptional(),
-                                                                       reasonIfUnsupported))
+                                if (LayerSupportCache::GetInstance().IsLayerSupported(*layer,
+                                                                                      EmptyOptional(),
+                                                                                      reasonIfUnsupported))
                                 {
                                     supportedBackendFound = true;
                                     break;
@@ -271,7 +272,7 @@ OptimizationResult AttemptBackendAssignment(BackendSettings& backendSettings,
         }
         else if (dataTypeIn == DataType::BFloat16 || dataTypeOut == DataType::BFloat16)
         {
-            if (IWorkloadFactory::IsLayerSupported(*layer, DataType::Float32, reasonIfUnsupported)
+            if (LayerSupportCache::GetInstance().IsLayerSupported(*layer, DataType::Float32, reasonIfUnsupported)
                 && layer->GetType() != LayerType::ConvertFp32ToBf16
                 && layer->GetType() != LayerType::ConvertBf16ToFp32)
             {
@@ -307,9 +308,9 @@ OptimizationResult AttemptBackendAssignment(BackendSettings& backendSettings,
 
                         // Try preferred backend first
                         layer->SetBackendId(preferredBackend);
-                        if (IWorkloadFactory::IsLayerSupported(*layer,
-                                                               EmptyOptional(),
-                                                               reasonIfUnsupported))
+                        if (LayerSupportCache::GetInstance().IsLayerSupported(*layer,
+                                                                              EmptyOptional(),
+                                                                              reasonIfUnsupported))
                         {
                             supportedBackendFound = true;
                         }
@@ -324,9 +325,9 @@ OptimizationResult AttemptBackendAssignment(BackendSettings& backendSettings,
                                 }
 
                                 layer->SetBackendId(backend);
-                                if (IWorkloadFactory::IsLayerSupported(*layer,
-                                                                       EmptyOptional(),
-                                                                       reasonIfUnsupported))
+                                if (LayerSupportCache::GetInstance().IsLayerSupported(*layer,
+                                                                                      EmptyOptional(),
+                                                                                      reasonIfUnsupported))
                                 {
                                     supportedBackendFound = true;
                                     break;
@@ -1127,6 +1128,15 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
         Optimizer::Pass(optGraph, MakeOptimizations(InsertDebugLayer()));
     }
 
+    // If the tensor stats flag is set, then add a TensorStatsLayer after each layer
+    if (options.m_TensorStats)
+    {
+        TensorStatsDescriptor statsDescriptor(options.m_TensorStatsHistogramBins,
+                                              options.m_TensorStatsHistogramMin,
+                                              options.m_TensorStatsHistogramMax);
+        Optimizer::Pass(optGraph, MakeOptimizations(InsertTensorStatsLayer(statsDescriptor)));
+    }
+
     // Calculate the compatibility strategies for tensor handles
     OptimizationResult strategyResult = SelectTensorHandleStrategy(optGraph,
                                                                    backends,
@@ -1165,17 +1175,43 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
 
     return optNet;
 }
-bool Network::GetShapeInferenceMethod()
+namespace
+{
+
+// Network options are passed as BackendOptions named after the option, holding its value as their first option.
+bool GetBoolNetworkOption(const NetworkOptions& networkOptions, const std::string& name)
 {
-    if (m_NetworkOptions.size() > 0 && m_NetworkOptions[0].GetBackendId().Get() == "ShapeInferenceMethod")
+    for (const BackendOptions& option : networkOptions)
     {
-        return m_NetworkOptions[0].GetOption(0).GetValue().AsBool();
+        if (option.GetBackendId().Get() == name && option.GetOptionCount() > 0)
+        {
+            return option.GetOption(0).GetValue().AsBool();
+        }
     }
 
     return false;
 }
+
+} // anonymous namespace
+
+bool Network::GetShapeInferenceMethod()
+{
+    return GetBoolNetworkOption(m_NetworkOptions, "ShapeInferenceMethod");
+}
+
+bool Network::GetBorrowConstantMemory()
+{
+    return GetBoolNetworkOption(m_NetworkOptions, "BorrowConstantMemory");
+}
+
+std::unique_ptr<ScopedCpuTensorHandle> Network::CreateConstantHandle(const ConstTensor& tensor) const
+{
+    return std::make_unique<ScopedCpuTensorHandle>(tensor, m_BorrowConstantMemory);
+}
+
 Network::Network(NetworkOptions networkOptions)
 : m_NetworkOptions(networkOptions),
+  m_BorrowConstantMemory(GetBorrowConstantMemory()),
   m_Graph(std::make_unique<Graph>(GetShapeInferenceMethod()))
 {}
 
@@ -1230,11 +1266,11 @@ IConnectableLayer* Network::AddFullyConnectedLayerImpl(const FullyConnectedDescr
 
     const auto layer = m_Graph->AddLayer<FullyConnectedLayer>(fullyConnectedDescriptor, name);
 
-    layer->m_Weight = std::make_unique<ScopedCpuTensorHandle>(weights);
+    layer->m_Weight = CreateConstantHandle(weights);
 
     if (fullyConnectedDescriptor.m_BiasEnabled)
     {
-        layer->m_Bias = std::make_unique<ScopedCpuTensorHandle>(biases.value());
+        layer->m_Bias = CreateConstantHandle(biases.value());
     }
 
     return layer;
@@ -1283,11 +1319,11 @@ IConnectableLayer* Network::AddConvolution2dLayerImpl(const Convolution2dDescrip
 
     const auto layer = m_Graph->AddLayer<Convolution2dLayer>(convolution2dDescriptor, name);
 
-    layer->m_Weight = std::make_unique<ScopedCpuTensorHandle>(weights);
+    layer->m_Weight = CreateConstantHandle(weights);
 
     if (convolution2dDescriptor.m_BiasEnabled)
     {
-        layer->m_Bias = std::make_unique<ScopedCpuTensorHandle>(biases.value());
+        layer->m_Bias = CreateConstantHandle(biases.value());
     }
 
     return layer;
@@ -1331,11 +1367,11 @@ IConnectableLayer* Network::AddDepthwiseConvolution2dLayerImpl(
 
     const auto layer = m_Graph->AddLayer<DepthwiseConvolution2dLayer>(convolution2dDescriptor, name);
 
-    layer->m_Weight = std::make_unique<ScopedCpuTensorHandle>(weights);
+    layer->m_Weight = CreateConstantHandle(weights);
 
     if (convolution2dDescriptor.m_BiasEnabled)
     {
-        layer->m_Bias = std::make_unique<ScopedCpuTensorHandle>(biases.value());
+        layer->m_Bias = CreateConstantHandle(biases.value());
     }
 
     return layer;
@@ -1380,7 +1416,7 @@ IConnectableLayer* Network::AddDetectionPostProcessLayer(const armnn::DetectionP
 {
     const auto layer = m_Graph->AddLayer<DetectionPostProcessLayer>(descriptor, name);
 
-    layer->m_Anchors = std::make_unique<ScopedCpuTensorHandle>(anchors);
+    layer->m_Anchors = CreateConstantHandle(anchors);
 
     return layer;
 }
@@ -1478,10 +1514,10 @@ IConnectableLayer* Network::AddBatchNormalizationLayer(const BatchNormalizationD
 {
     const auto layer = m_Graph->AddLayer<BatchNormalizationLayer>(desc, name);
 
-    layer->m_Mean = std::make_unique<ScopedCpuTensorHandle>(mean);
-    layer->m_Variance = std::make_unique<ScopedCpuTensorHandle>(variance);
-    layer->m_Beta = std::make_unique<ScopedCpuTensorHandle>(beta);
-    layer->m_Gamma = std::make_unique<ScopedCpuTensorHandle>(gamma);
+    layer->m_Mean = CreateConstantHandle(mean);
+    layer->m_Variance = CreateConstantHandle(variance);
+    layer->m_Beta = CreateConstantHandle(beta);
+    layer->m_Gamma = CreateConstantHandle(gamma);
 
     return layer;
 }
@@ -1533,7 +1569,7 @@ IConnectableLayer* Network::AddConstantLayer(const ConstTensor& input, const cha
 {
     auto layer = m_Graph->AddLayer<ConstantLayer>(name);
 
-    layer->m_LayerOutput = std::make_unique<ScopedCpuTensorHandle>(input);
+    layer->m_LayerOutput = CreateConstantHandle(input);
 
     return layer;
 }
@@ -1569,23 +1605,23 @@ IConnectableLayer* Network::AddLstmLayer(const LstmDescriptor&  descriptor,
 
     //Lstm Basic Parameters
     layer->m_BasicParameters.m_InputToForgetWeights =
-        std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputToForgetWeights));
+        CreateConstantHandle(*(params.m_InputToForgetWeights));
     layer->m_BasicParameters.m_InputToCellWeights =
-        std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputToCellWeights));
+        CreateConstantHandle(*(params.m_InputToCellWeights));
     layer->m_BasicParameters.m_InputToOutputWeights =
-        std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputToOutputWeights));
+        CreateConstantHandle(*(params.m_InputToOutputWeights));
     layer->m_BasicParameters.m_RecurrentToForgetWeights =
-        std::make_unique<ScopedCpuTensorHandle>(*(params.m_RecurrentToForgetWeights));
+        CreateConstantHandle(*(params.m_RecurrentToForgetWeights));
     layer->m_BasicParameters.m_RecurrentToCellWeights =
-        std::make_unique<ScopedCpuTensorHandle>(*(params.m_RecurrentToCellWeights));
+        CreateConstantHandle(*(params.m_RecurrentToCellWeights));
     layer->m_BasicParameters.m_RecurrentToOutputWeights =
-        std::make_unique<ScopedCpuTensorHandle>(*(params.m_RecurrentToOutputWeights));
+        CreateConstantHandle(*(params.m_RecurrentToOutputWeights));
     layer->m_BasicParameters.m_ForgetGateBias =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_ForgetGateBias));
+            CreateConstantHandle(*(params.m_ForgetGateBias));
     layer->m_BasicParameters.m_CellBias =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_CellBias));
+            CreateConstantHandle(*(params.m_CellBias));
     layer->m_BasicParameters.m_OutputGateBias =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_OutputGateBias));
+            CreateConstantHandle(*(params.m_OutputGateBias));
 
     //Lstm Cifg parameters
     if(!descriptor.m_CifgEnabled)
@@ -1607,11 +1643,11 @@ IConnectableLayer* Network::AddLstmLayer(const LstmDescriptor&  descriptor,
                                            "when CIFG is disabled.");
         }
         layer->m_CifgParameters.m_InputToInputWeights =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputToInputWeights));
+            CreateConstantHandle(*(params.m_InputToInputWeights));
         layer->m_CifgParameters.m_RecurrentToInputWeights =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_RecurrentToInputWeights));
+            CreateConstantHandle(*(params.m_RecurrentToInputWeights));
         layer->m_CifgParameters.m_InputGateBias =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputGateBias));
+            CreateConstantHandle(*(params.m_InputGateBias));
     }
 
     //Lstm projection parameters
@@ -1623,11 +1659,11 @@ IConnectableLayer* Network::AddLstmLayer(const LstmDescriptor&  descriptor,
                                            "when projection is enabled.");
         }
         layer->m_ProjectionParameters.m_ProjectionWeights =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_ProjectionWeights));
+            CreateConstantHandle(*(params.m_ProjectionWeights));
         if(params.m_ProjectionBias != nullptr)
         {
             layer->m_ProjectionParameters.m_ProjectionBias =
-                std::make_unique<ScopedCpuTensorHandle>(*(params.m_ProjectionBias));
+                CreateConstantHandle(*(params.m_ProjectionBias));
         }
     }
 
@@ -1643,7 +1679,7 @@ IConnectableLayer* Network::AddLstmLayer(const LstmDescriptor&  descriptor,
             }
 
             layer->m_PeepholeParameters.m_CellToInputWeights =
-                std::make_unique<ScopedCpuTensorHandle>(*(params.m_CellToInputWeights));
+                CreateConstantHandle(*(params.m_CellToInputWeights));
         }
 
         if(params.m_CellToForgetWeights == nullptr)
@@ -1658,9 +1694,9 @@ IConnectableLayer* Network::AddLstmLayer(const LstmDescriptor&  descriptor,
         }
 
         layer->m_PeepholeParameters.m_CellToForgetWeights =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_CellToForgetWeights));
+            CreateConstantHandle(*(params.m_CellToForgetWeights));
         layer->m_PeepholeParameters.m_CellToOutputWeights =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_CellToOutputWeights));
+            CreateConstantHandle(*(params.m_CellToOutputWeights));
     }
 
     //Lstm Layer Normalization params
@@ -1674,7 +1710,7 @@ IConnectableLayer* Network::AddLstmLayer(const LstmDescriptor&  descriptor,
                                                "when layer normalization is enabled and CIFG disabled.");
             }
             layer->m_LayerNormParameters.m_InputLayerNormWeights =
-                    std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputLayerNormWeights));
+                    CreateConstantHandle(*(params.m_InputLayerNormWeights));
         }
 
         if(params.m_ForgetLayerNormWeights == nullptr)
@@ -1693,11 +1729,11 @@ IConnectableLayer* Network::AddLstmLayer(const LstmDescriptor&  descriptor,
                                            "when layer normalization is enabled.");
         }
         layer->m_LayerNormParameters.m_ForgetLayerNormWeights =
-                std::make_unique<ScopedCpuTensorHandle>(*(params.m_ForgetLayerNormWeights));
+                CreateConstantHandle(*(params.m_ForgetLayerNormWeights));
         layer->m_LayerNormParameters.m_CellLayerNormWeights =
-                std::make_unique<ScopedCpuTensorHandle>(*(params.m_CellLayerNormWeights));
+                CreateConstantHandle(*(params.m_CellLayerNormWeights));
         layer->m_LayerNormParameters.m_OutputLayerNormWeights =
-                std::make_unique<ScopedCpuTensorHandle>(*(params.m_OutputLayerNormWeights));
+                CreateConstantHandle(*(params.m_OutputLayerNormWeights));
     }
     return layer;
 }
@@ -1792,11 +1828,11 @@ IConnectableLayer* Network::AddTransposeConvolution2dLayer(const TransposeConvol
 
     const auto layer = m_Graph->AddLayer<TransposeConvolution2dLayer>(descriptor, name);
 
-    layer->m_Weight = std::make_unique<ScopedCpuTensorHandle>(weights);
+    layer->m_Weight = CreateConstantHandle(weights);
 
     if (descriptor.m_BiasEnabled)
     {
-        layer->m_Bias = std::make_unique<ScopedCpuTensorHandle>(biases.value());
+        layer->m_Bias = CreateConstantHandle(biases.value());
     }
 
     return layer;
@@ -1828,33 +1864,33 @@ IConnectableLayer* Network::AddQuantizedLstmLayer(const QuantizedLstmInputParams
 
     // InputToX weights
     layer->m_QuantizedLstmParameters.m_InputToInputWeights =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetInputToInputWeights());
+            CreateConstantHandle(params.GetInputToInputWeights());
     layer->m_QuantizedLstmParameters.m_InputToForgetWeights =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetInputToForgetWeights());
+            CreateConstantHandle(params.GetInputToForgetWeights());
     layer->m_QuantizedLstmParameters.m_InputToCellWeights =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetInputToCellWeights());
+            CreateConstantHandle(params.GetInputToCellWeights());
     layer->m_QuantizedLstmParameters.m_InputToOutputWeights =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetInputToOutputWeights());
+            CreateConstantHandle(params.GetInputToOutputWeights());
 
     // RecurrentToX weights
     layer->m_QuantizedLstmParameters.m_RecurrentToInputWeights =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetRecurrentToInputWeights());
+            CreateConstantHandle(params.GetRecurrentToInputWeights());
     layer->m_QuantizedLstmParameters.m_RecurrentToForgetWeights =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetRecurrentToForgetWeights());
+            CreateConstantHandle(params.GetRecurrentToForgetWeights());
     layer->m_QuantizedLstmParameters.m_RecurrentToCellWeights =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetRecurrentToCellWeights());
+            CreateConstantHandle(params.GetRecurrentToCellWeights());
     layer->m_QuantizedLstmParameters.m_RecurrentToOutputWeights =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetRecurrentToOutputWeights());
+            CreateConstantHandle(params.GetRecurrentToOutputWeights());
 
     // Bias
     layer->m_QuantizedLstmParameters.m_InputGateBias =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetInputGateBias());
+            CreateConstantHandle(params.GetInputGateBias());
     layer->m_QuantizedLstmParameters.m_ForgetGateBias =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetForgetGateBias());
+            CreateConstantHandle(params.GetForgetGateBias());
     layer->m_QuantizedLstmParameters.m_CellBias =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetCellBias());
+            CreateConstantHandle(params.GetCellBias());
     layer->m_QuantizedLstmParameters.m_OutputGateBias =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetOutputGateBias());
+            CreateConstantHandle(params.GetOutputGateBias());
 
     return layer;
 }
@@ -1867,23 +1903,23 @@ IConnectableLayer* Network::AddQLstmLayer(const QLstmDescriptor&  descriptor,
 
     // QLstm Basic Parameters
     layer->m_BasicParameters.m_InputToForgetWeights =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputToForgetWeights));
+            CreateConstantHandle(*(params.m_InputToForgetWeights));
     layer->m_BasicParameters.m_InputToCellWeights =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputToCellWeights));
+            CreateConstantHandle(*(params.m_InputToCellWeights));
     layer->m_BasicParameters.m_InputToOutputWeights =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputToOutputWeights));
+            CreateConstantHandle(*(params.m_InputToOutputWeights));
     layer->m_BasicParameters.m_RecurrentToForgetWeights =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_RecurrentToForgetWeights));
+            CreateConstantHandle(*(params.m_RecurrentToForgetWeights));
     layer->m_BasicParameters.m_RecurrentToCellWeights =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_RecurrentToCellWeights));
+            CreateConstantHandle(*(params.m_RecurrentToCellWeights));
     layer->m_BasicParameters.m_RecurrentToOutputWeights =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_RecurrentToOutputWeights));
+            CreateConstantHandle(*(params.m_RecurrentToOutputWeights));
     layer->m_BasicParameters.m_ForgetGateBias =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_ForgetGateBias));
+            CreateConstantHandle(*(params.m_ForgetGateBias));
     layer->m_BasicParameters.m_CellBias =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_CellBias));
+            CreateConstantHandle(*(params.m_CellBias));
     layer->m_BasicParameters.m_OutputGateBias =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_OutputGateBias));
+            CreateConstantHandle(*(params.m_OutputGateBias));
 
     // QLstm Cifg parameters
     if(!descriptor.m_CifgEnabled)
@@ -1905,11 +1941,11 @@ IConnectableLayer* Network::AddQLstmLayer(const QLstmDescriptor&  descriptor,
         }
 
         layer->m_CifgParameters.m_InputToInputWeights =
-                std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputToInputWeights));
+                CreateConstantHandle(*(params.m_InputToInputWeights));
         layer->m_CifgParameters.m_RecurrentToInputWeights =
-                std::make_unique<ScopedCpuTensorHandle>(*(params.m_RecurrentToInputWeights));
+                CreateConstantHandle(*(params.m_RecurrentToInputWeights));
         layer->m_CifgParameters.m_InputGateBias =
-                std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputGateBias));
+                CreateConstantHandle(*(params.m_InputGateBias));
     }
 
     // QLstm Projection parameters
@@ -1921,13 +1957,13 @@ IConnectableLayer* Network::AddQLstmLayer(const QLstmDescriptor&  descriptor,
         }
 
         layer->m_ProjectionParameters.m_ProjectionWeights =
-                std::make_unique<ScopedCpuTensorHandle>(*(params.m_ProjectionWeights));
+                CreateConstantHandle(*(params.m_ProjectionWeights));
 
         // Projection bias is optional even if projection is enabled
         if(params.m_ProjectionWeights != nullptr)
         {
             layer->m_ProjectionParameters.m_ProjectionBias =
-                    std::make_unique<ScopedCpuTensorHandle>(*(params.m_ProjectionBias));
+                    CreateConstantHandle(*(params.m_ProjectionBias));
         }
 
     }
@@ -1953,13 +1989,13 @@ IConnectableLayer* Network::AddQLstmLayer(const QLstmDescriptor&  descriptor,
             }
 
             layer->m_PeepholeParameters.m_CellToInputWeights =
-                    std::make_unique<ScopedCpuTensorHandle>(*(params.m_CellToInputWeights));
+                    CreateConstantHandle(*(params.m_CellToInputWeights));
         }
 
         layer->m_PeepholeParameters.m_CellToForgetWeights =
-                std::make_unique<ScopedCpuTensorHandle>(*(params.m_CellToForgetWeights));
+                CreateConstantHandle(*(params.m_CellToForgetWeights));
         layer->m_PeepholeParameters.m_CellToOutputWeights =
-                std::make_unique<ScopedCpuTensorHandle>(*(params.m_CellToOutputWeights));
+                CreateConstantHandle(*(params.m_CellToOutputWeights));
     }
 
     // QLstm Layer Normalization params
@@ -1988,15 +2024,15 @@ IConnectableLayer* Network::AddQLstmLayer(const QLstmDescriptor&  descriptor,
             }
 
             layer->m_LayerNormParameters.m_InputLayerNormWeights =
-                    std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputLayerNormWeights));
+                    CreateConstantHandle(*(params.m_InputLayerNormWeights));
         }
 
         layer->m_LayerNormParameters.m_ForgetLayerNormWeights =
-                std::make_unique<ScopedCpuTensorHandle>(*(params.m_ForgetLayerNormWeights));
+                CreateConstantHandle(*(params.m_ForgetLayerNormWeights));
         layer->m_LayerNormParameters.m_CellLayerNormWeights =
-                std::make_unique<ScopedCpuTensorHandle>(*(params.m_CellLayerNormWeights));
+                CreateConstantHandle(*(params.m_CellLayerNormWeights));
         layer->m_LayerNormParameters.m_OutputLayerNormWeights =
-                std::make_unique<ScopedCpuTensorHandle>(*(params.m_OutputLayerNormWeights));
+                CreateConstantHandle(*(params.m_OutputLayerNormWeights));
     }
     return layer;
 }
@@ -11,6 +11,7 @@
 #include <armnn/Types.hpp>
 
 #include <armnn/INetwork.hpp>
+#include <armnn/backends/CpuTensorHandleFwd.hpp>
 
 #include <string>
 #include <vector>
@@ -272,8 +273,14 @@ private:
         const Optional<ConstTensor>& biases,
         const char* name);
 
+    /// Creates the handle holding the data of a constant tensor added to the network. It borrows the memory of the
+    /// tensor instead of copying it when the "BorrowConstantMemory" network option is set.
+    std::unique_ptr<ScopedCpuTensorHandle> CreateConstantHandle(const ConstTensor& tensor) const;
+
     bool GetShapeInferenceMethod();
+    bool GetBorrowConstantMemory();
     NetworkOptions m_NetworkOptions;
+    bool m_BorrowConstantMemory;
 
     std::unique_ptr<Graph> m_Graph;
     ModelOptions m_ModelOptions;
@@ -292,6 +299,7 @@ public:
     profiling::ProfilingGuid GetGuid() const final { return m_Guid; };
 
     Graph& GetGraph() { return *m_Graph; }
+    const Graph& GetGraph() const { return *m_Graph; }
     ModelOptions& GetModelOptions() { return m_ModelOptions; }
 
 private:
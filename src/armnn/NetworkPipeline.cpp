@@ -0,0 +1,521 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "NetworkPipeline.hpp"
+
+#include "LayersFwd.hpp"
+#include "LoadedNetwork.hpp"
+#include "Network.hpp"
+#include "NetworkUtils.hpp"
+#include "Profiling.hpp"
+
+#include <armnn/Exceptions.hpp>
+#include <armnn/utility/NumericCast.hpp>
+#include <armnn/utility/PolymorphicDowncast.hpp>
+
+#include <backendsCommon/CpuTensorHandle.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace armnn
+{
+
+namespace
+{
+
+bool IsPipelinedLayer(const Layer& layer)
+{
+    return layer.GetType() != LayerType::Input &&
+           layer.GetType() != LayerType::Output &&
+           layer.GetType() != LayerType::Constant;
+}
+
+/// Estimates the cost of running a layer from the number of elements it reads and writes and, for the layers
+/// with weights, from the number of multiply-accumulates.
+double EstimateLayerCost(const Layer& layer)
+{
+    double outputElements = 0.0;
+    for (const OutputSlot& outputSlot : layer.GetOutputSlots())
+    {
+        outputElements += outputSlot.GetTensorInfo().GetNumElements();
+    }
+
+    double cost = outputElements;
+    for (const InputSlot& inputSlot : layer.GetInputSlots())
+    {
+        cost += inputSlot.GetConnectedOutputSlot()->GetTensorInfo().GetNumElements();
+    }
+
+    const ScopedCpuTensorHandle* weights = nullptr;
+    double numOutputChannels = 1.0;
+    switch (layer.GetType())
+    {
+        case LayerType::Convolution2d:
+            weights = PolymorphicDowncast<const Convolution2dLayer*>(&layer)->m_Weight.get();
+            if (weights)
+            {
+                numOutputChannels = weights->GetTensorInfo().GetShape()[0];
+            }
+            break;
+        case LayerType::DepthwiseConvolution2d:
+            weights = PolymorphicDowncast<const DepthwiseConvolution2dLayer*>(&layer)->m_Weight.get();
+            if (weights)
+            {
+                numOutputChannels = weights->GetTensorInfo().GetShape()[0] * weights->GetTensorInfo().GetShape()[1];
+            }
+            break;
+        case LayerType::FullyConnected:
+        {
+            weights = PolymorphicDowncast<const FullyConnectedLayer*>(&layer)->m_Weight.get();
+            const TensorShape& outputShape = layer.GetOutputSlot(0).GetTensorInfo().GetShape();
+            numOutputChannels = outputShape[outputShape.GetNumDimensions() - 1];
+            break;
+        }
+        default:
+            break;
+    }
+
+    if (weights)
+    {
+        cost += outputElements * weights->GetTensorInfo().GetNumElements() / numOutputChannels;
+    }
+    return std::max(cost, 1.0);
+}
+
+const ConstTensor& FindInputTensor(LayerBindingId id, const InputTensors& inputTensors)
+{
+    for (auto&& inputTensor : inputTensors)
+    {
+        if (inputTensor.first == id)
+        {
+            return inputTensor.second;
+        }
+    }
+    throw InvalidArgumentException(fmt::format("No tensor supplied for input {}", id));
+}
+
+const Tensor& FindOutputTensor(LayerBindingId id, const OutputTensors& outputTensors)
+{
+    for (auto&& outputTensor : outputTensors)
+    {
+        if (outputTensor.first == id)
+        {
+            return outputTensor.second;
+        }
+    }
+    throw InvalidArgumentException(fmt::format("No tensor supplied for output {}", id));
+}
+
+unsigned int GetConnectionIndex(const OutputSlot& outputSlot, const InputSlot& inputSlot)
+{
+    const std::vector<InputSlot*>& connections = outputSlot.GetConnections();
+    auto it = std::find(connections.begin(), connections.end(), &inputSlot);
+    return armnn::numeric_cast<unsigned int>(std::distance(connections.begin(), it));
+}
+
+} // anonymous namespace
+
+NetworkPipeline::NetworkPipeline(const Graph& graph,
+                                 const ModelOptions& modelOptions,
+                                 unsigned int numStages,
+                                 const INetworkProperties& networkProperties,
+                                 profiling::ProfilingService& profilingService,
+                                 ConstantTensorStore& constantTensorStore)
+{
+    // Cut the layers, in topological order, where the cost run so far crosses a multiple of the cost of a stage
+    std::vector<const Layer*> pipelinedLayers;
+    std::vector<double> costs;
+    double totalCost = 0.0;
+    for (const Layer* layer : graph)
+    {
+        if (IsPipelinedLayer(*layer))
+        {
+            pipelinedLayers.push_back(layer);
+            costs.push_back(EstimateLayerCost(*layer));
+            totalCost += costs.back();
+        }
+    }
+    if (pipelinedLayers.empty())
+    {
+        throw InvalidArgumentException("The network has no layer to split into pipeline stages");
+    }
+    for (auto layer : graph.GetOutputLayers())
+    {
+        if (!IsPipelinedLayer(layer->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer()))
+        {
+            throw InvalidArgumentException(fmt::format("Output {} of a pipelined network must be computed by a layer",
+                                                       layer->GetBindingId()));
+        }
+    }
+
+    std::unordered_map<LayerGuid, unsigned int> layerStages;
+    double costSoFar = 0.0;
+    unsigned int currentStage = 0;
+    unsigned int lastCostStage = 0;
+    for (size_t i = 0; i < pipelinedLayers.size(); ++i)
+    {
+        // Stages are numbered without gaps even when a single layer costs more than a stage
+        const auto costStage = static_cast<unsigned int>((costSoFar + costs[i] / 2.0) * numStages / totalCost);
+        if (i > 0 && std::min(costStage, numStages - 1) > lastCostStage)
+        {
+            ++currentStage;
+            lastCostStage = std::min(costStage, numStages - 1);
+        }
+        layerStages.emplace(pipelinedLayers[i]->GetGuid(), currentStage);
+        costSoFar += costs[i];
+    }
+    m_Stages.resize(currentStage + 1);
+
+    // The tensors written by a stage and read by a later one
+    std::map<const OutputSlot*, unsigned int> boundaryTensors;
+    for (const Layer* layer : pipelinedLayers)
+    {
+        const unsigned int producerStage = layerStages.at(layer->GetGuid());
+        for (const OutputSlot& outputSlot : layer->GetOutputSlots())
+        {
+            for (const InputSlot* connection : outputSlot.GetConnections())
+            {
+                const Layer& consumer = connection->GetOwningLayer();
+                if (!IsPipelinedLayer(consumer) || layerStages.at(consumer.GetGuid()) == producerStage)
+                {
+                    continue;
+                }
+                if (boundaryTensors.emplace(&outputSlot, numeric_cast<unsigned int>(m_BoundaryTensors.size())).second)
+                {
+                    BoundaryTensor boundaryTensor;
+                    boundaryTensor.m_TensorInfo = outputSlot.GetTensorInfo();
+                    boundaryTensor.m_ProducerStage = producerStage;
+                    for (std::vector<unsigned char>& buffer : boundaryTensor.m_Buffers)
+                    {
+                        buffer.resize(boundaryTensor.m_TensorInfo.GetNumBytes());
+                    }
+                    m_BoundaryTensors.push_back(std::move(boundaryTensor));
+                }
+            }
+        }
+    }
+
+    // Loading the stages registers their profilers for this thread, so restore the current one afterwards
+    Profiler* profiler = ProfilerManager::GetInstance().GetProfiler();
+
+    for (unsigned int stageIndex = 0; stageIndex < m_Stages.size(); ++stageIndex)
+    {
+        Stage& stage = m_Stages[stageIndex];
+        auto isInStage = [&](const Layer& layer)
+        {
+            return IsPipelinedLayer(layer) && layerStages.at(layer.GetGuid()) == stageIndex;
+        };
+
+        // The stage is cut from a copy of the whole graph, whose layers keep their guids
+        std::unique_ptr<Graph> stageGraph = CloneOptimizedGraph(graph);
+        std::unordered_map<LayerGuid, Layer*> stageLayers;
+        for (Layer* layer : *stageGraph)
+        {
+            stageLayers.emplace(layer->GetGuid(), layer);
+        }
+
+        // Each stage keeps its own copy of the constants it reads, which borrow the same memory
+        std::vector<const Layer*> keptLayers;
+        for (const Layer* layer : graph)
+        {
+            bool isKept = isInStage(*layer);
+            if (layer->GetType() == LayerType::Constant)
+            {
+                for (const InputSlot* connection : layer->GetOutputSlot(0).GetConnections())
+                {
+                    isKept = isKept || isInStage(connection->GetOwningLayer());
+                }
+            }
+            if (isKept)
+            {
+                keptLayers.push_back(layer);
+            }
+        }
+
+        // Find what the stage reads and writes before the other layers, and their connections, go away
+        std::map<const OutputSlot*, std::vector<std::pair<InputSlot*, EdgeStrategy>>> stageInputs;
+        std::vector<std::pair<OutputSlot*, StageBinding>> stageOutputs;
+        for (const Layer* layer : keptLayers)
+        {
+            Layer* stageLayer = stageLayers.at(layer->GetGuid());
+            for (const InputSlot& inputSlot : layer->GetInputSlots())
+            {
+                const OutputSlot* source = inputSlot.GetConnectedOutputSlot();
+                const Layer& producer = source->GetOwningLayer();
+                if (isInStage(producer) || producer.GetType() == LayerType::Constant)
+                {
+                    continue;
+                }
+                stageInputs[source].push_back({ &stageLayer->GetInputSlot(inputSlot.GetSlotIndex()),
+                                                source->GetEdgeStrategyForConnection(
+                                                    GetConnectionIndex(*source, inputSlot)) });
+            }
+
+            if (!isInStage(*layer))
+            {
+                continue;
+            }
+            for (const OutputSlot& outputSlot : layer->GetOutputSlots())
+            {
+                OutputSlot* stageOutputSlot = &stageLayer->GetOutputSlot(outputSlot.CalculateIndexOnOwner());
+                for (const InputSlot* connection : outputSlot.GetConnections())
+                {
+                    const Layer& consumer = connection->GetOwningLayer();
+                    if (consumer.GetType() == LayerType::Output)
+                    {
+                        const auto outputLayer = PolymorphicDowncast<const OutputLayer*>(&consumer);
+                        stageOutputs.push_back({ stageOutputSlot, { true, outputLayer->GetBindingId(), 0 } });
+                    }
+                }
+                auto boundaryTensor = boundaryTensors.find(&outputSlot);
+                if (boundaryTensor != boundaryTensors.end())
+                {
+                    stageOutputs.push_back({ stageOutputSlot, { false, 0, boundaryTensor->second } });
+                }
+            }
+        }
+
+        for (const Layer* layer : graph)
+        {
+            if (std::find(keptLayers.begin(), keptLayers.end(), layer) == keptLayers.end())
+            {
+                Layer* stageLayer = stageLayers.at(layer->GetGuid());
+                stageGraph->EraseLayer(stageLayer);
+            }
+        }
+
+        for (auto&& stageInput : stageInputs)
+        {
+            const OutputSlot& source = *stageInput.first;
+            const Layer& producer = source.GetOwningLayer();
+            if (producer.GetType() == LayerType::Input)
+            {
+                const auto inputLayer = PolymorphicDowncast<const InputLayer*>(&producer);
+                stage.m_Inputs.push_back({ true, inputLayer->GetBindingId(), 0 });
+            }
+            else
+            {
+                const unsigned int boundaryTensor = boundaryTensors.at(&source);
+                stage.m_Inputs.push_back({ false, 0, boundaryTensor });
+                stage.m_ProducerStages.push_back(m_BoundaryTensors[boundaryTensor].m_ProducerStage);
+            }
+
+            const auto bindingId = numeric_cast<LayerBindingId>(stage.m_Inputs.size() - 1);
+            Layer* inputLayer = stageGraph->AddLayer<InputLayer>(bindingId,
+                                                                 fmt::format("pipeline input {}", bindingId).c_str());
+            inputLayer->SetBackendId(producer.GetBackendId());
+            OutputSlot& inputSlot = inputLayer->GetOutputSlot(0);
+            inputSlot.SetTensorInfo(source.GetTensorInfo());
+            inputSlot.SetTensorHandleFactory(source.GetTensorHandleFactoryId());
+
+            // The connections keep the edge strategies they had in the whole graph
+            for (auto&& consumer : stageInput.second)
+            {
+                inputSlot.Connect(*consumer.first);
+                inputSlot.SetEdgeStrategy(inputSlot.GetNumConnections() - 1, consumer.second);
+            }
+        }
+
+        for (auto&& stageOutput : stageOutputs)
+        {
+            OutputSlot& source = *stageOutput.first;
+            const auto bindingId = numeric_cast<LayerBindingId>(stage.m_Outputs.size());
+            Layer* outputLayer = stageGraph->AddLayer<OutputLayer>(bindingId,
+                                                                   fmt::format("pipeline output {}", bindingId).c_str());
+            outputLayer->SetBackendId(source.GetOwningLayer().GetBackendId());
+            source.Connect(outputLayer->GetInputSlot(0));
+            source.SetEdgeStrategy(source.GetNumConnections() - 1, EdgeStrategy::DirectCompatibility);
+            stage.m_Outputs.push_back(stageOutput.second);
+        }
+
+        std::string errorMessage;
+        stage.m_Network = LoadedNetwork::MakeLoadedNetwork(
+            std::make_unique<OptimizedNetwork>(std::move(stageGraph), modelOptions),
+            errorMessage,
+            INetworkProperties(networkProperties.m_ImportEnabled, networkProperties.m_ExportEnabled),
+            profilingService,
+            constantTensorStore);
+        if (!stage.m_Network)
+        {
+            ProfilerManager::GetInstance().RegisterProfiler(profiler);
+            throw RuntimeException(fmt::format("Failed to load pipeline stage {0}: {1}", stageIndex, errorMessage));
+        }
+    }
+
+    ProfilerManager::GetInstance().RegisterProfiler(profiler);
+
+    for (unsigned int stageIndex = 0; stageIndex < m_Stages.size(); ++stageIndex)
+    {
+        Stage& stage = m_Stages[stageIndex];
+        std::sort(stage.m_ProducerStages.begin(), stage.m_ProducerStages.end());
+        stage.m_ProducerStages.erase(std::unique(stage.m_ProducerStages.begin(), stage.m_ProducerStages.end()),
+                                     stage.m_ProducerStages.end());
+        for (unsigned int producerStage : stage.m_ProducerStages)
+        {
+            m_Stages[producerStage].m_ConsumerStages.push_back(stageIndex);
+        }
+    }
+}
+
+NetworkPipeline::~NetworkPipeline() = default;
+
+Status NetworkPipeline::Run(const std::vector<InputTensors>& inputTensors,
+                            const std::vector<OutputTensors>& outputTensors)
+{
+    if (inputTensors.size() != outputTensors.size())
+    {
+        throw InvalidArgumentException("There must be as many sets of output tensors as of input tensors");
+    }
+    const size_t numInferences = inputTensors.size();
+
+    // Bind the tensors of every inference up front, so that the stages only have to run
+    std::vector<std::vector<InputTensors>> stageInputTensors(m_Stages.size());
+    std::vector<std::vector<OutputTensors>> stageOutputTensors(m_Stages.size());
+    for (size_t stageIndex = 0; stageIndex < m_Stages.size(); ++stageIndex)
+    {
+        const Stage& stage = m_Stages[stageIndex];
+        stageInputTensors[stageIndex].resize(numInferences);
+        stageOutputTensors[stageIndex].resize(numInferences);
+        for (size_t inference = 0; inference < numInferences; ++inference)
+        {
+            for (size_t i = 0; i < stage.m_Inputs.size(); ++i)
+            {
+                const StageBinding& binding = stage.m_Inputs[i];
+                const auto bindingId = numeric_cast<LayerBindingId>(i);
+                const void* data = binding.m_IsNetworkBinding ?
+                    FindInputTensor(binding.m_NetworkBindingId, inputTensors[inference]).GetMemoryArea() :
+                    m_BoundaryTensors[binding.m_BoundaryTensor].m_Buffers[inference % 2].data();
+                stageInputTensors[stageIndex][inference].emplace_back(
+                    bindingId, ConstTensor(stage.m_Network->GetInputTensorInfo(bindingId), data));
+            }
+            for (size_t i = 0; i < stage.m_Outputs.size(); ++i)
+            {
+                const StageBinding& binding = stage.m_Outputs[i];
+                const auto bindingId = numeric_cast<LayerBindingId>(i);
+                void* data = binding.m_IsNetworkBinding ?
+                    FindOutputTensor(binding.m_NetworkBindingId, outputTensors[inference]).GetMemoryArea() :
+                    m_BoundaryTensors[binding.m_BoundaryTensor].m_Buffers[inference % 2].data();
+                stageOutputTensors[stageIndex][inference].emplace_back(
+                    bindingId, Tensor(stage.m_Network->GetOutputTensorInfo(bindingId), data));
+            }
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::vector<size_t> numFinished(m_Stages.size(), 0);
+    bool failed = false;
+    std::exception_ptr error;
+
+    // A stage runs an inference once the stages it reads from have run it, and once the stages reading from it are
+    // done with the inference that last used the same buffers
+    auto isReady = [&](const Stage& stage, size_t inference)
+    {
+        for (unsigned int producerStage : stage.m_ProducerStages)
+        {
+            if (numFinished[producerStage] <= inference)
+            {
+                return false;
+            }
+        }
+        for (unsigned int consumerStage : stage.m_ConsumerStages)
+        {
+            if (numFinished[consumerStage] + 2 <= inference)
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    auto runStage = [&](size_t stageIndex)
+    {
+        const Stage& stage = m_Stages[stageIndex];
+        ProfilerManager::GetInstance().RegisterProfiler(stage.m_Network->GetProfiler().get());
+
+        for (size_t inference = 0; inference < numInferences; ++inference)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                condition.wait(lock, [&]() { return failed || isReady(stage, inference); });
+                if (failed)
+                {
+                    return;
+                }
+            }
+
+            bool succeeded = false;
+            try
+            {
+                succeeded = stage.m_Network->EnqueueWorkload(stageInputTensors[stageIndex][inference],
+                                                             stageOutputTensors[stageIndex][inference])
+                            == Status::Success;
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                error = error ? error : std::current_exception();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                failed = failed || !succeeded;
+                ++numFinished[stageIndex];
+            }
+            condition.notify_all();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(m_Stages.size());
+    for (size_t stageIndex = 0; stageIndex < m_Stages.size(); ++stageIndex)
+    {
+        threads.emplace_back(runStage, stageIndex);
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+    return failed ? Status::Failure : Status::Success;
+}
+
+void NetworkPipeline::FreeWorkingMemory()
+{
+    for (Stage& stage : m_Stages)
+    {
+        stage.m_Network->FreeWorkingMemory();
+    }
+}
+
+void NetworkPipeline::RegisterDebugCallback(const DebugCallbackFunction& func)
+{
+    for (Stage& stage : m_Stages)
+    {
+        stage.m_Network->RegisterDebugCallback(func);
+    }
+}
+
+void NetworkPipeline::RegisterTensorStatsCallback(const TensorStatsCallbackFunction& func)
+{
+    for (Stage& stage : m_Stages)
+    {
+        stage.m_Network->RegisterTensorStatsCallback(func);
+    }
+}
+
+} // namespace armnn
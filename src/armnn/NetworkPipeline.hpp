@@ -0,0 +1,88 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "ConstantTensorStore.hpp"
+#include "Graph.hpp"
+
+#include <armnn/BackendOptions.hpp>
+#include <armnn/IRuntime.hpp>
+#include <armnn/Tensor.hpp>
+#include <armnn/Types.hpp>
+
+#include <ProfilingService.hpp>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace armnn
+{
+
+class LoadedNetwork;
+
+/// Runs a stream of inferences through a network split into stages, each running on its own thread, so that
+/// consecutive inferences go through different stages at the same time.
+///
+/// The stages are loaded as networks of their own, cut from the optimized graph in topological order at points
+/// of roughly equal estimated cost. The tensors passed from one stage to a later one are double-buffered, so a stage
+/// can work on the next inference while the stages after it still read the outputs of the previous one.
+class NetworkPipeline
+{
+public:
+    /// Splits graph, which must be sorted and still hold its constants, into at most numStages stages and loads them.
+    NetworkPipeline(const Graph& graph,
+                    const ModelOptions& modelOptions,
+                    unsigned int numStages,
+                    const INetworkProperties& networkProperties,
+                    profiling::ProfilingService& profilingService,
+                    ConstantTensorStore& constantTensorStore);
+    ~NetworkPipeline();
+
+    unsigned int GetNumStages() const { return static_cast<unsigned int>(m_Stages.size()); }
+
+    /// Runs the inference of inputTensors[i] into outputTensors[i] for each i and returns once all of them ran.
+    Status Run(const std::vector<InputTensors>& inputTensors, const std::vector<OutputTensors>& outputTensors);
+
+    void FreeWorkingMemory();
+
+    void RegisterDebugCallback(const DebugCallbackFunction& func);
+    void RegisterTensorStatsCallback(const TensorStatsCallbackFunction& func);
+
+private:
+    /// A tensor a stage reads or writes: either an input or output of the network, or a tensor passed between stages.
+    struct StageBinding
+    {
+        bool m_IsNetworkBinding;
+        LayerBindingId m_NetworkBindingId;
+        unsigned int m_BoundaryTensor;
+    };
+
+    /// A tensor passed between stages, written in turn to each of its buffers.
+    struct BoundaryTensor
+    {
+        TensorInfo m_TensorInfo;
+        unsigned int m_ProducerStage;
+        std::array<std::vector<unsigned char>, 2> m_Buffers;
+    };
+
+    struct Stage
+    {
+        std::unique_ptr<LoadedNetwork> m_Network;
+
+        /// What each input and output of m_Network is bound to, indexed by binding id.
+        std::vector<StageBinding> m_Inputs;
+        std::vector<StageBinding> m_Outputs;
+
+        /// The earlier stages this one reads from and the later ones reading from it.
+        std::vector<unsigned int> m_ProducerStages;
+        std::vector<unsigned int> m_ConsumerStages;
+    };
+
+    std::vector<BoundaryTensor> m_BoundaryTensors;
+    std::vector<Stage> m_Stages;
+};
+
+} // namespace armnn
@@ -13,26 +13,25 @@
 #include "QuantizerVisitor.hpp"
 #include "OverrideInputRangeVisitor.hpp"
 
-#include <TensorIOUtils.hpp>
-
 #include <armnn/ILayerVisitor.hpp>
 #include <armnn/INetwork.hpp>
 #include <armnn/Tensor.hpp>
 #include <armnn/Types.hpp>
 
-#include <armnnUtils/TensorUtils.hpp>
 #include <armnn/utility/PolymorphicDowncast.hpp>
 
-#include <mapbox/variant.hpp>
-
-#include <vector>
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace armnn
 {
 
-using TContainer = mapbox::util::variant<std::vector<float>, std::vector<int>, std::vector<unsigned char>>;
-
 INetworkQuantizer* INetworkQuantizer::CreateRaw(INetwork* inputNetwork, const QuantizerOptions& options)
 {
     return new NetworkQuantizer(inputNetwork, options);
@@ -58,80 +57,222 @@ void NetworkQuantizer::OverrideInputRange(LayerBindingId layerId, float min, flo
     VisitLayers(inputLayers, overrideInputRangeVisitor);
 }
 
-void NetworkQuantizer::Refine(const InputTensors& inputTensors)
+void NetworkQuantizer::PrepareRefine()
 {
     // The first time Refine is called the m_Runtime and the DynamicQuantizationVisitor
     // will not have been created. Need to get the environment set up, Runtime loaded,
     // DynamicQuantizationVisitor created and run over the network to initialise itself
     // and the RangeTracker the Debug callback registered and an initial inference
     // done to set up the first min/max values
-    if (!m_Runtime)
+    if (m_Runtime)
     {
-        m_RefineCount = 0;
-        m_Ranges.SetDynamicMode(true);
-        const Graph& cGraph = PolymorphicDowncast<const Network*>(m_InputNetwork)->GetGraph().TopologicalSort();
+        return;
+    }
+
+    m_RefineCount = 0;
+    m_Ranges.SetDynamicMode(true);
+    const Graph& cGraph = PolymorphicDowncast<const Network*>(m_InputNetwork)->GetGraph().TopologicalSort();
+
+    // need to insert Debug layers in the DynamicQuantizationVisitor
+    Graph& graph = const_cast<Graph&>(cGraph);
+
+    // Initialize RangeTracker to the default values for each layer.
+    // The default values are overwritten by the min/max that is
+    // recorded during the first dataset min/max calibration. This
+    // initialisation is only required for the first call of Refine().
+    m_DynamicQuantizationVisitor = DynamicQuantizationVisitor(m_Ranges, graph);
+    VisitLayers(cGraph, m_DynamicQuantizationVisitor.value());
+
+    IRuntime::CreationOptions options;
+    m_Runtime = IRuntime::Create(options);
+
+    // Optimize network - debug already enabled for layers that require quantization
+    OptimizerOptions optimizerOptions(false, false);
+    std::vector<BackendId> backends = {"CpuRef"};
+    IOptimizedNetworkPtr optimizedNet = Optimize(*m_InputNetwork,
+                                                 backends,
+                                                 m_Runtime->GetDeviceSpec(),
+                                                 optimizerOptions);
+
+    m_Runtime->LoadNetwork(m_NetworkId, std::move(optimizedNet));
+
+    // TensorStats callback function to refine min/max in RangeTracker
+    auto rangeTrackerCallback = [&](LayerGuid guid, unsigned int slotIndex, const TensorStats& stats) {
+        MergeRange(guid, slotIndex, std::make_pair(stats.m_Min, stats.m_Max));
+    };
+
+    m_Runtime->RegisterTensorStatsCallback(m_NetworkId, rangeTrackerCallback);
+}
+
+void NetworkQuantizer::MergeRange(LayerGuid guid, unsigned int slotIndex, const RangeTracker::MinMaxRange& minMax)
+{
+    // For first calibration dataset, set min/max range in RangeTracker to
+    // min/max ranges gathered during inference
+    if (m_RefineCount == 0)
+    {
+        m_Ranges.ResetMinMax(guid, slotIndex, minMax.first, minMax.second);
+    }
+    else
+    {
+        // For every other calibration dataset, only set min/max range if the
+        // values gathered are less than / greater than originally recorded.
+        m_Ranges.RefineMin(guid, slotIndex, minMax.first);
+        m_Ranges.RefineMax(guid, slotIndex, minMax.second);
+    }
+}
+
+OutputTensors NetworkQuantizer::MakeOutputTensors(NetworkId networkId, std::vector<std::vector<float>>& outputData)
+{
+    // Create output tensor for EnqueueWorkload
+    std::vector<armnn::BindingPointInfo> outputBindings;
+    auto outputLayers = m_DynamicQuantizationVisitor.value().GetOutputLayers();
+    for (auto outputLayerBindingId : outputLayers)
+    {
+        auto outputTensorInfo = m_Runtime->GetOutputTensorInfo(networkId, outputLayerBindingId);
+        outputBindings.push_back(std::make_pair(outputLayerBindingId, outputTensorInfo));
+        outputData.push_back(std::vector<float>(outputTensorInfo.GetNumElements(), 0));
+    }
+
+    OutputTensors outputTensors;
+    for (unsigned int i = 0; i < outputBindings.size(); ++i)
+    {
+        outputTensors.push_back(std::make_pair(outputBindings[i].first,
+                                               Tensor(outputBindings[i].second, outputData[i].data())));
+    }
+    return outputTensors;
+}
 
-        // need to insert Debug layers in the DynamicQuantizationVisitor
-        Graph& graph = const_cast<Graph&>(cGraph);
+void NetworkQuantizer::Refine(const InputTensors& inputTensors)
+{
+    PrepareRefine();
 
-        // Initialize RangeTracker to the default values for each layer.
-        // The default values are overwritten by the min/max that is
-        // recorded during the first dataset min/max calibration. This
-        // initialisation is only required for the first call of Refine().
-        m_DynamicQuantizationVisitor = DynamicQuantizationVisitor(m_Ranges, graph);
-        VisitLayers(cGraph, m_DynamicQuantizationVisitor.value());
+    std::vector<std::vector<float>> outputData;
+    OutputTensors outputTensors = MakeOutputTensors(m_NetworkId, outputData);
 
-        IRuntime::CreationOptions options;
-        m_Runtime = IRuntime::Create(options);
+    // Execute EnqueueWorkload with calibration image
+    m_Runtime->EnqueueWorkload(m_NetworkId, inputTensors, outputTensors);
+    ++m_RefineCount;
+}
+
+void NetworkQuantizer::RefineBatch(const std::vector<InputTensors>& inputTensorsBatch, unsigned int numThreads)
+{
+    PrepareRefine();
+    if (inputTensorsBatch.empty())
+    {
+        return;
+    }
+
+    if (numThreads == 0)
+    {
+        numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    numThreads = std::min(numThreads, static_cast<unsigned int>(inputTensorsBatch.size()));
+
+    // Each thread runs its own copy of the network, as a loaded network runs one inference at a time, and
+    // collects ranges in its worker rather than in m_Ranges, so the threads share nothing until the merge
+    while (m_CalibrationWorkers.size() < numThreads)
+    {
+        auto worker = std::make_unique<CalibrationWorker>();
+        CalibrationWorker* workerPtr = worker.get();
 
-        // Optimize network - debug already enabled for layers that require quantization
         OptimizerOptions optimizerOptions(false, false);
         std::vector<BackendId> backends = {"CpuRef"};
         IOptimizedNetworkPtr optimizedNet = Optimize(*m_InputNetwork,
                                                      backends,
                                                      m_Runtime->GetDeviceSpec(),
                                                      optimizerOptions);
+        if (m_Runtime->LoadNetwork(worker->m_NetworkId, std::move(optimizedNet)) != Status::Success)
+        {
+            throw RuntimeException("Failed to load a copy of the network for calibration");
+        }
+
+        m_Runtime->RegisterTensorStatsCallback(worker->m_NetworkId,
+            [workerPtr](LayerGuid guid, unsigned int slotIndex, const TensorStats& stats)
+            {
+                const RangeTracker::MinMaxRange minMax = std::make_pair(stats.m_Min, stats.m_Max);
+                auto inserted = workerPtr->m_Ranges.emplace(std::make_pair(guid, slotIndex), minMax);
+                if (!inserted.second)
+                {
+                    RangeTracker::MinMaxRange& range = inserted.first->second;
+                    range.first = std::min(range.first, minMax.first);
+                    range.second = std::max(range.second, minMax.second);
+                }
+            });
 
-        m_Runtime->LoadNetwork(m_NetworkId, std::move(optimizedNet));
+        m_CalibrationWorkers.push_back(std::move(worker));
+    }
 
-        // Debug callback function to refine min/max in RangeTracker
-        auto rangeTrackerCallback = [&](LayerGuid guid, unsigned int slotIndex, ITensorHandle *tensorHandle) {
-            // Get min/max pair from tensor data
-            std::pair<float, float> minMax = armnnUtils::FindMinMax(tensorHandle);
+    // Threads take the next entry of the batch as they finish the previous one, which balances entries whose
+    // inferences take different times
+    std::atomic<size_t> nextEntry(0);
+    std::exception_ptr error;
+    std::mutex errorMutex;
 
-            // For first calibration dataset, set min/max range in RangeTracker to
-            // min/max ranges gathered during inference
-            if (m_RefineCount == 0)
+    auto runWorker = [&](CalibrationWorker& worker)
+    {
+        try
+        {
+            std::vector<std::vector<float>> outputData;
+            OutputTensors outputTensors = MakeOutputTensors(worker.m_NetworkId, outputData);
+            for (size_t entry = nextEntry++; entry < inputTensorsBatch.size(); entry = nextEntry++)
             {
-                m_Ranges.ResetMinMax(guid, slotIndex, minMax.first, minMax.second);
+                m_Runtime->EnqueueWorkload(worker.m_NetworkId, inputTensorsBatch[entry], outputTensors);
             }
-            else
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error)
             {
-                // For every other calibration dataset, only set min/max range if the
-                // values gathered are less than / greater than originally recorded.
-                m_Ranges.RefineMin(guid, slotIndex, minMax.first);
-                m_Ranges.RefineMax(guid, slotIndex, minMax.second);
+                error = std::current_exception();
             }
-        };
+            // Stop the other threads early
+            nextEntry = inputTensorsBatch.size();
+        }
+    };
 
-        m_Runtime->RegisterDebugCallback(m_NetworkId, rangeTrackerCallback);
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads);
+    for (unsigned int i = 0; i < numThreads; ++i)
+    {
+        threads.emplace_back(runWorker, std::ref(*m_CalibrationWorkers[i]));
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
     }
 
-    // Create output tensor for EnqueueWorkload
-    std::vector<armnn::BindingPointInfo> outputBindings;
-    auto outputLayers = m_DynamicQuantizationVisitor.value().GetOutputLayers();
-    std::vector<TContainer> outputVectors;
-    for (auto outputLayerBindingId : outputLayers)
+    if (error)
     {
-        auto outputTensorInfo = m_Runtime->GetOutputTensorInfo(m_NetworkId, outputLayerBindingId);
-        outputBindings.push_back(std::make_pair(outputLayerBindingId, outputTensorInfo));
-        outputVectors.push_back(std::vector<float>(outputTensorInfo.GetNumElements(), 0));
+        for (auto& worker : m_CalibrationWorkers)
+        {
+            worker->m_Ranges.clear();
+        }
+        std::rethrow_exception(error);
     }
-    OutputTensors outputTensors = armnnUtils::MakeOutputTensors<TContainer>(outputBindings, outputVectors);
 
-    // Execute EnqueueWorkload with calibration image
-    m_Runtime->EnqueueWorkload(m_NetworkId, inputTensors, outputTensors);
-    ++m_RefineCount;
+    // Combine the ranges of the workers first, so that the first batch resets each range only once
+    std::map<std::pair<LayerGuid, unsigned int>, RangeTracker::MinMaxRange> batchRanges;
+    for (auto& worker : m_CalibrationWorkers)
+    {
+        for (const auto& workerRange : worker->m_Ranges)
+        {
+            auto inserted = batchRanges.insert(workerRange);
+            if (!inserted.second)
+            {
+                RangeTracker::MinMaxRange& range = inserted.first->second;
+                range.first = std::min(range.first, workerRange.second.first);
+                range.second = std::max(range.second, workerRange.second.second);
+            }
+        }
+        worker->m_Ranges.clear();
+    }
+
+    for (const auto& batchRange : batchRanges)
+    {
+        MergeRange(batchRange.first.first, batchRange.first.second, batchRange.second);
+    }
+    m_RefineCount += static_cast<unsigned int>(inputTensorsBatch.size());
 }
 
 INetworkPtr NetworkQuantizer::ExportNetwork()
@@ -153,6 +294,7 @@ INetworkPtr NetworkQuantizer::ExportNetwork()
         m_DynamicQuantizationVisitor.value().VisitNonCalibratedLayers();
         // now tear down the runtime and the dynamic visitor.
         m_Runtime.reset(nullptr);
+        m_CalibrationWorkers.clear();
         m_DynamicQuantizationVisitor = EmptyOptional();
         m_RefineCount = 0;
     }
@@ -14,6 +14,11 @@
 #include "DynamicQuantizationVisitor.hpp"
 #include "RangeTracker.hpp"
 
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
 namespace armnn
 {
 
@@ -29,12 +34,30 @@ public:
 
     void OverrideInputRange(LayerBindingId layerId, float min, float max) override;
     void Refine(const InputTensors& inputTensors) override;
+    void RefineBatch(const std::vector<InputTensors>& inputTensorsBatch, unsigned int numThreads) override;
 
     // Required for testing? Need some way to get min/max in RangeTracker (m_Ranges)
     std::pair<float, float> GetMinMaxRange(LayerGuid guid, unsigned int idx) { return m_Ranges.GetRange(guid, idx); }
     INetworkPtr ExportNetwork() override;
 
 private:
+    /// A copy of the network loaded for one of the threads of RefineBatch, with the ranges it saw in the batch
+    struct CalibrationWorker
+    {
+        NetworkId m_NetworkId;
+
+        /// Min/max of each calibrated output slot, by layer guid and slot index
+        std::map<std::pair<LayerGuid, unsigned int>, RangeTracker::MinMaxRange> m_Ranges;
+    };
+
+    /// Sets up the runtime and the DynamicQuantizationVisitor the first time the network is refined
+    void PrepareRefine();
+
+    /// Adds a range seen during calibration to m_Ranges
+    void MergeRange(LayerGuid guid, unsigned int slotIndex, const RangeTracker::MinMaxRange& minMax);
+
+    OutputTensors MakeOutputTensors(NetworkId networkId, std::vector<std::vector<float>>& outputData);
+
     /// Original input network to quantize
     INetwork* m_InputNetwork;
 
@@ -49,6 +72,9 @@ private:
     // counts the number of times refine is called
     unsigned int m_RefineCount;
 
+    /// The copies of the network used by RefineBatch, loaded in m_Runtime and kept for later batches
+    std::vector<std::unique_ptr<CalibrationWorker>> m_CalibrationWorkers;
+
     /// Mapping from Guid to an array of ranges for outputs
     RangeTracker m_Ranges;
 
@@ -10,6 +10,8 @@
 #include <armnn/Exceptions.hpp>
 #include <armnn/BackendRegistry.hpp>
 
+#include <unordered_map>
+
 namespace armnn
 {
 
@@ -259,4 +261,65 @@ std::vector<DebugLayer*> InsertDebugLayerAfter(Graph& graph, Layer& layer)
     return debugLayers;
 }
 
+std::vector<TensorStatsLayer*> AddTensorStatsLayersAfter(Graph& graph,
+                                                         Layer& layer,
+                                                         const TensorStatsDescriptor& descriptor)
+{
+    std::vector<TensorStatsLayer*> statsLayers;
+    statsLayers.reserve(layer.GetNumOutputSlots());
+
+    for (auto outputSlot = layer.BeginOutputSlots(); outputSlot != layer.EndOutputSlots(); ++outputSlot)
+    {
+        if (outputSlot->GetTensorInfo().GetDataType() == DataType::Boolean)
+        {
+            continue;
+        }
+
+        const std::string statsName = std::string("TensorStatsLayerAfter") + layer.GetNameStr();
+
+        TensorStatsLayer* statsLayer = graph.AddLayer<TensorStatsLayer>(descriptor, statsName.c_str());
+        outputSlot->Connect(statsLayer->GetInputSlot(0));
+
+        // NOTE: It is OK to do this because TensorStatsLayer is only supported on CpuRef
+        statsLayer->SetBackendId(Compute::CpuRef);
+
+        statsLayers.emplace_back(statsLayer);
+    }
+
+    return statsLayers;
+}
+
+std::unique_ptr<Graph> CloneOptimizedGraph(const Graph& graph)
+{
+    std::unique_ptr<Graph> clone = std::make_unique<Graph>(graph);
+
+    // Cloned layers keep their guid and the connections of their output slots are copied in order
+    std::unordered_map<LayerGuid, const Layer*> originalLayers;
+    for (const Layer* layer : graph)
+    {
+        originalLayers.emplace(layer->GetGuid(), layer);
+    }
+
+    for (Layer* layer : *clone)
+    {
+        const Layer& original = *originalLayers.at(layer->GetGuid());
+        layer->SetAdditionalInfoForObject(original.GetAdditionalInformation<void>());
+
+        for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
+        {
+            const OutputSlot& originalSlot = original.GetOutputSlot(i);
+            OutputSlot& slot = layer->GetOutputSlot(i);
+            slot.SetTensorHandleFactory(originalSlot.GetTensorHandleFactoryId());
+
+            const std::vector<EdgeStrategy>& edgeStrategies = originalSlot.GetEdgeStrategies();
+            for (unsigned int connection = 0; connection < edgeStrategies.size(); ++connection)
+            {
+                slot.SetEdgeStrategy(connection, edgeStrategies[connection]);
+            }
+        }
+    }
+
+    return clone;
+}
+
 } // namespace armnn
@@ -29,4 +29,13 @@ std::vector<ConvertFp32ToFp16Layer*> InsertConvertFp32ToFp16LayersAfter(Graph& g
 
 std::vector<DebugLayer*> InsertDebugLayerAfter(Graph& graph, Layer& layer);
 
+/// Connects a TensorStatsLayer to each output slot of layer, as an extra consumer, except for the Boolean ones.
+std::vector<TensorStatsLayer*> AddTensorStatsLayersAfter(Graph& graph,
+                                                         Layer& layer,
+                                                         const TensorStatsDescriptor& descriptor);
+
+/// Copies graph along with what the optimizer chose for its layers, which the copy constructor of Graph leaves out:
+/// the tensor handle factories and edge strategies of the output slots and the additional info of the layers.
+std::unique_ptr<Graph> CloneOptimizedGraph(const Graph& graph);
+
 } // namespace armnn
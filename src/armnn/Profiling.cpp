@@ -291,7 +291,7 @@ void ExtractJsonObjects(unsigned int inferenceIndex,
     unsigned int childIdx=0;
     for(size_t measurementIndex = 0; measurementIndex < instrumentMeasurements.size(); ++measurementIndex, ++childIdx)
     {
-        if (inferenceIndex == 0)
+        if (inferenceIndex == 0 || childIdx >= parentObject.NumChildren())
         {
             // Only add kernel measurement once, in case of multiple inferences
             JsonChildObject measurementObject{instrumentMeasurements[measurementIndex].m_Name};
@@ -309,20 +309,35 @@ void ExtractJsonObjects(unsigned int inferenceIndex,
     auto childEventsIt = descendantsMap.find(parentEvent);
     if (childEventsIt != descendantsMap.end())
     {
+        // Events are matched by name and order to the objects added for previous inferences, as an inference can
+        // run events the others did not, such as the creation of a plan for new input shapes
+        std::map<std::string, unsigned int> numEventsWithName;
         for (auto childEvent : childEventsIt->second)
         {
-            if (inferenceIndex == 0)
+            const std::string name = childEvent->GetName();
+            unsigned int occurrence = numEventsWithName[name]++;
+
+            JsonChildObject* childObject = nullptr;
+            for (unsigned int i = childIdx; i < parentObject.NumChildren() && childObject == nullptr; ++i)
+            {
+                JsonChildObject& candidate = parentObject.GetChild(i);
+                if (candidate.GetType() == JsonObjectType::Event && candidate.m_Label == name && occurrence-- == 0)
+                {
+                    childObject = &candidate;
+                }
+            }
+
+            if (childObject == nullptr)
             {
                 // Only add second level once, in case of multiple inferences
-                JsonChildObject childObject{childEvent->GetName()};
-                childObject.SetType(JsonObjectType::Event);
-                parentObject.AddChild(childObject);
+                JsonChildObject newChildObject{name};
+                newChildObject.SetType(JsonObjectType::Event);
+                parentObject.AddChild(newChildObject);
+                childObject = &parentObject.GetChild(static_cast<unsigned int>(parentObject.NumChildren() - 1));
             }
 
             // Recursively process children. In reality this won't be very deep recursion. ~4-6 levels deep.
-            ExtractJsonObjects(inferenceIndex, childEvent, parentObject.GetChild(childIdx), descendantsMap);
-
-            childIdx++;
+            ExtractJsonObjects(inferenceIndex, childEvent, *childObject, descendantsMap);
         }
     }
 }
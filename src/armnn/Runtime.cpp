@@ -14,7 +14,10 @@
 #include <backendsCommon/DynamicBackendUtils.hpp>
 #include <armnn/utility/PolymorphicDowncast.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <thread>
 
 #include <backends/BackendProfiling.hpp>
 
@@ -41,6 +44,7 @@ void IRuntime::Destroy(IRuntime* runtime)
 
 int Runtime::GenerateNetworkId()
 {
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
     return m_NetworkIdCounter++;
 }
 
@@ -76,7 +80,8 @@ Status Runtime::LoadNetwork(NetworkId& networkIdOut,
         std::unique_ptr<OptimizedNetwork>(PolymorphicDowncast<OptimizedNetwork*>(rawNetwork)),
         errorMessage,
         networkProperties,
-        m_ProfilingService);
+        m_ProfilingService,
+        m_ConstantTensorStore);
 
     if (!loadedNetwork)
     {
@@ -103,6 +108,150 @@ Status Runtime::LoadNetwork(NetworkId& networkIdOut,
     return Status::Success;
 }
 
+std::vector<Status> Runtime::LoadNetworks(std::vector<NetworkId>& networkIdsOut,
+                                          const std::vector<const INetwork*>& networks,
+                                          const std::vector<BackendId>& backendPreferences,
+                                          std::vector<std::string>& errorMessages,
+                                          const OptimizerOptions& options,
+                                          const INetworkProperties& networkProperties,
+                                          unsigned int numThreads)
+{
+    const size_t numNetworks = networks.size();
+    networkIdsOut.resize(numNetworks);
+    errorMessages.assign(numNetworks, std::string());
+    std::vector<Status> statuses(numNetworks, Status::Failure);
+
+    // The backend contexts are only used from this thread
+    for (NetworkId& networkId : networkIdsOut)
+    {
+        networkId = GenerateNetworkId();
+        for (auto&& context : m_BackendContexts)
+        {
+            context.second->BeforeLoadNetwork(networkId);
+        }
+    }
+
+    std::atomic<size_t> nextNetwork(0);
+    auto optimizeAndLoadNetworks = [&]()
+    {
+        for (size_t i = nextNetwork++; i < numNetworks; i = nextNetwork++)
+        {
+            statuses[i] = OptimizeAndLoadNetwork(networkIdsOut[i], *networks[i], backendPreferences,
+                                                 options, networkProperties, errorMessages[i]);
+        }
+    };
+
+    if (numThreads == 0)
+    {
+        numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    const size_t numWorkers = std::min(static_cast<size_t>(numThreads), numNetworks);
+
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < numWorkers; ++i)
+    {
+        workers.emplace_back(optimizeAndLoadNetworks);
+    }
+    optimizeAndLoadNetworks();
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    for (size_t i = 0; i < numNetworks; ++i)
+    {
+        if (statuses[i] != Status::Success)
+        {
+            continue;
+        }
+
+        for (auto&& context : m_BackendContexts)
+        {
+            context.second->AfterLoadNetwork(networkIdsOut[i]);
+        }
+
+        if (m_ProfilingService.IsProfilingEnabled())
+        {
+            m_ProfilingService.IncrementCounterValue(armnn::profiling::NETWORK_LOADS);
+        }
+    }
+
+    return statuses;
+}
+
+Status Runtime::OptimizeAndLoadNetwork(NetworkId networkId,
+                                       const INetwork& network,
+                                       const std::vector<BackendId>& backendPreferences,
+                                       const OptimizerOptions& options,
+                                       const INetworkProperties& networkProperties,
+                                       std::string& errorMessage)
+{
+    // Record the optimization and the loading in the profiler the loaded network will use. It is only enabled
+    // for them, the user enables it again to profile the inferences.
+    Profiler* const previousProfiler = ProfilerManager::GetInstance().GetProfiler();
+    auto profiler = std::make_shared<Profiler>();
+    profiler->EnableProfiling(true);
+    ProfilerManager::GetInstance().RegisterProfiler(profiler.get());
+
+    std::unique_ptr<LoadedNetwork> loadedNetwork;
+    try
+    {
+        IOptimizedNetworkPtr optimizedNetwork(nullptr, nullptr);
+        {
+            ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "Optimize");
+
+            std::vector<std::string> optimizationMessages;
+            optimizedNetwork = Optimize(network, backendPreferences, m_DeviceSpec, options,
+                                        Optional<std::vector<std::string>&>(optimizationMessages));
+            if (!optimizedNetwork)
+            {
+                errorMessage = "Failed to optimize the network";
+                for (const std::string& message : optimizationMessages)
+                {
+                    errorMessage += "\n" + message;
+                }
+            }
+        }
+
+        if (optimizedNetwork)
+        {
+            ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "LoadNetwork");
+
+            loadedNetwork = LoadedNetwork::MakeLoadedNetwork(
+                std::unique_ptr<OptimizedNetwork>(
+                    PolymorphicDowncast<OptimizedNetwork*>(optimizedNetwork.release())),
+                errorMessage,
+                networkProperties,
+                m_ProfilingService,
+                m_ConstantTensorStore,
+                profiler);
+        }
+    }
+    catch (const armnn::Exception& error)
+    {
+        errorMessage = error.what();
+    }
+
+    profiler->EnableProfiling(false);
+    ProfilerManager::GetInstance().RegisterProfiler(previousProfiler);
+
+    if (!loadedNetwork)
+    {
+        ARMNN_LOG(error) << "Runtime::LoadNetworks(): failed to load network with ID " << networkId << ": "
+                         << errorMessage;
+        return Status::Failure;
+    }
+
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+        // Stores the network
+        m_LoadedNetworks[networkId] = std::move(loadedNetwork);
+    }
+
+    return Status::Success;
+}
+
 Status Runtime::UnloadNetwork(NetworkId networkId)
 {
     bool unloadOk = true;
@@ -140,6 +289,11 @@ Status Runtime::UnloadNetwork(NetworkId networkId)
             return Status::Failure;
         }
 
+        for (auto it = m_BoundTensors.begin(); it != m_BoundTensors.end();)
+        {
+            it = it->second == networkId ? m_BoundTensors.erase(it) : std::next(it);
+        }
+
         if (m_ProfilingService.IsProfilingEnabled())
         {
             m_ProfilingService.IncrementCounterValue(armnn::profiling::NETWORK_UNLOADS);
@@ -184,6 +338,7 @@ void Runtime::ReportStructure() // armnn::profiling::IProfilingService& profilin
 
 Runtime::Runtime(const CreationOptions& options)
     : m_NetworkIdCounter(0),
+      m_BoundTensorsIdCounter(0),
       m_ProfilingService(*this)
 {
     const auto start_time = armnn::GetTimeNow();
@@ -317,6 +472,11 @@ TensorInfo Runtime::GetOutputTensorInfo(NetworkId networkId, LayerBindingId laye
     return GetLoadedNetworkPtr(networkId)->GetOutputTensorInfo(layerId);
 }
 
+std::map<LayerBindingId, std::string> Runtime::GetOutputCopyReasons(NetworkId networkId) const
+{
+    return GetLoadedNetworkPtr(networkId)->GetOutputCopyReasons();
+}
+
 
 Status Runtime::EnqueueWorkload(NetworkId networkId,
                                 const InputTensors& inputTensors,
@@ -340,12 +500,89 @@ Status Runtime::EnqueueWorkload(NetworkId networkId,
     return loadedNetwork->EnqueueWorkload(inputTensors, outputTensors);
 }
 
+Status Runtime::EnqueueWorkloads(NetworkId networkId,
+                                 const std::vector<InputTensors>& inputTensors,
+                                 const std::vector<OutputTensors>& outputTensors)
+{
+    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
+    ProfilerManager::GetInstance().RegisterProfiler(loadedNetwork->GetProfiler().get());
+
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "EnqueueWorkloads");
+
+    return loadedNetwork->EnqueueWorkloads(inputTensors, outputTensors);
+}
+
+Status Runtime::RegisterTensors(NetworkId networkId,
+                                const InputTensors& inputTensors,
+                                const OutputTensors& outputTensors,
+                                BoundTensorsId& boundTensorsId)
+{
+    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
+
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        boundTensorsId = m_BoundTensorsIdCounter++;
+    }
+
+    loadedNetwork->RegisterTensors(boundTensorsId, inputTensors, outputTensors);
+
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    m_BoundTensors[boundTensorsId] = networkId;
+    return Status::Success;
+}
+
+Status Runtime::Execute(BoundTensorsId boundTensorsId)
+{
+    NetworkId networkId;
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        auto it = m_BoundTensors.find(boundTensorsId);
+        if (it == m_BoundTensors.end())
+        {
+            ARMNN_LOG(error) << "Runtime::Execute(): no tensors are bound with id " << boundTensorsId;
+            return Status::Failure;
+        }
+        networkId = it->second;
+    }
+
+    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
+    ProfilerManager::GetInstance().RegisterProfiler(loadedNetwork->GetProfiler().get());
+
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "Execute");
+
+    return loadedNetwork->Execute(boundTensorsId);
+}
+
+Status Runtime::UnregisterTensors(BoundTensorsId boundTensorsId)
+{
+    NetworkId networkId;
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        auto it = m_BoundTensors.find(boundTensorsId);
+        if (it == m_BoundTensors.end())
+        {
+            return Status::Failure;
+        }
+        networkId = it->second;
+        m_BoundTensors.erase(it);
+    }
+
+    GetLoadedNetworkPtr(networkId)->UnregisterTensors(boundTensorsId);
+    return Status::Success;
+}
+
 void Runtime::RegisterDebugCallback(NetworkId networkId, const DebugCallbackFunction& func)
 {
     LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
     loadedNetwork->RegisterDebugCallback(func);
 }
 
+void Runtime::RegisterTensorStatsCallback(NetworkId networkId, const TensorStatsCallbackFunction& func)
+{
+    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
+    loadedNetwork->RegisterTensorStatsCallback(func);
+}
+
 void Runtime::LoadDynamicBackends(const std::string& overrideBackendPath)
 {
     // Get the paths where to load the dynamic backends from
@@ -53,14 +53,46 @@ public:
                                std::string& errorMessage,
                                const INetworkProperties& networkProperties) override;
 
+    /// Optimizes and loads several networks concurrently.
+    /// @param [out] networkIdsOut Unique identifier of each network, in the order of networks.
+    /// @param [in] networks Networks to optimize and load.
+    /// @param [in] backendPreferences Backends to optimize the networks for, in order of preference.
+    /// @param [out] errorMessages Error message of each network, empty for the networks that were loaded.
+    /// @param [in] options Options used to optimize every network.
+    /// @param [in] networkProperties Properties used to load every network.
+    /// @param [in] numThreads Maximum number of networks processed at once, 0 for one per hardware thread.
+    /// @return Status of each network, in the order of networks.
+    virtual std::vector<Status> LoadNetworks(std::vector<NetworkId>& networkIdsOut,
+                                             const std::vector<const INetwork*>& networks,
+                                             const std::vector<BackendId>& backendPreferences,
+                                             std::vector<std::string>& errorMessages,
+                                             const OptimizerOptions& options,
+                                             const INetworkProperties& networkProperties,
+                                             unsigned int numThreads) override;
+
     virtual TensorInfo GetInputTensorInfo(NetworkId networkId, LayerBindingId layerId) const override;
     virtual TensorInfo GetOutputTensorInfo(NetworkId networkId, LayerBindingId layerId) const override;
 
+    virtual std::map<LayerBindingId, std::string> GetOutputCopyReasons(NetworkId networkId) const override;
+
     // Evaluates network using input in inputTensors, outputs filled into outputTensors.
     virtual Status EnqueueWorkload(NetworkId networkId,
         const InputTensors& inputTensors,
         const OutputTensors& outputTensors) override;
 
+    virtual Status EnqueueWorkloads(NetworkId networkId,
+        const std::vector<InputTensors>& inputTensors,
+        const std::vector<OutputTensors>& outputTensors) override;
+
+    virtual Status RegisterTensors(NetworkId networkId,
+                                   const InputTensors& inputTensors,
+                                   const OutputTensors& outputTensors,
+                                   BoundTensorsId& boundTensorsId) override;
+
+    virtual Status Execute(BoundTensorsId boundTensorsId) override;
+
+    virtual Status UnregisterTensors(BoundTensorsId boundTensorsId) override;
+
     /// Unloads a network from the Runtime.
     /// At the moment this only removes the network from the m_Impl->m_Network.
     /// This might need more work in the future to be AndroidNN compliant.
@@ -80,6 +112,11 @@ public:
     /// @param func callback function to pass to the debug layer.
     virtual void RegisterDebugCallback(NetworkId networkId, const DebugCallbackFunction& func) override;
 
+    /// Registers a callback function to the TensorStats layers of a network.
+    /// @param networkId The id of the network to register the callback.
+    /// @param func callback function to pass to the TensorStats layers.
+    virtual void RegisterTensorStatsCallback(NetworkId networkId, const TensorStatsCallbackFunction& func) override;
+
     /// Creates a runtime for workload execution.
     Runtime(const CreationOptions& options);
 
@@ -94,8 +131,18 @@ private:
 
     friend profiling::ProfilingService& GetProfilingService(armnn::Runtime* runtime); // See RuntimeTests.cpp
 
+    friend const ConstantTensorStore& RuntimeGetConstantTensorStore(armnn::Runtime* runtime); // See RuntimeTests.cpp
+
     int GenerateNetworkId();
 
+    /// Optimizes and loads one network of LoadNetworks, on the calling thread
+    Status OptimizeAndLoadNetwork(NetworkId networkId,
+                                  const INetwork& network,
+                                  const std::vector<BackendId>& backendPreferences,
+                                  const OptimizerOptions& options,
+                                  const INetworkProperties& networkProperties,
+                                  std::string& errorMessage);
+
     LoadedNetwork* GetLoadedNetworkPtr(NetworkId networkId) const;
 
     template<typename Func>
@@ -114,6 +161,9 @@ private:
 
     mutable std::mutex m_Mutex;
 
+    /// Constant tensor data shared by the loaded networks
+    ConstantTensorStore m_ConstantTensorStore;
+
     /// Map of Loaded Networks with associated GUID as key
     LoadedNetworks m_LoadedNetworks;
 
@@ -121,6 +171,10 @@ private:
 
     int m_NetworkIdCounter;
 
+    /// The network each set of tensors bound by RegisterTensors belongs to
+    std::unordered_map<BoundTensorsId, NetworkId> m_BoundTensors;
+    int m_BoundTensorsIdCounter;
+
     DeviceSpec m_DeviceSpec;
 
     /// List of dynamic backends loaded in the runtime
@@ -515,4 +515,102 @@ void StringifyLayerParameters<TransposeDescriptor>::Serialize(ParameterStringify
     fn("DimMappings",ss.str());
 }
 
+void StringifyLayerParameters<ArgMinMaxDescriptor>::Serialize(ParameterStringifyFunction& fn,
+                                                              const ArgMinMaxDescriptor& desc)
+{
+    fn("Function", GetArgMinMaxFunctionAsCString(desc.m_Function));
+    fn("Axis", std::to_string(desc.m_Axis));
+    fn("OutputType", GetDataTypeName(desc.m_Output_Type));
+}
+
+void StringifyLayerParameters<ComparisonDescriptor>::Serialize(ParameterStringifyFunction& fn,
+                                                               const ComparisonDescriptor& desc)
+{
+    fn("Operation", GetComparisonOperationAsCString(desc.m_Operation));
+}
+
+void StringifyLayerParameters<ElementwiseUnaryDescriptor>::Serialize(ParameterStringifyFunction& fn,
+                                                                     const ElementwiseUnaryDescriptor& desc)
+{
+    fn("Operation", GetUnaryOperationAsCString(desc.m_Operation));
+}
+
+void StringifyLayerParameters<FillDescriptor>::Serialize(ParameterStringifyFunction& fn,
+                                                         const FillDescriptor& desc)
+{
+    fn("Value", std::to_string(desc.m_Value));
+}
+
+void StringifyLayerParameters<GatherDescriptor>::Serialize(ParameterStringifyFunction& fn,
+                                                           const GatherDescriptor& desc)
+{
+    fn("Axis", std::to_string(desc.m_Axis));
+}
+
+void StringifyLayerParameters<InstanceNormalizationDescriptor>::Serialize(
+    ParameterStringifyFunction& fn,
+    const InstanceNormalizationDescriptor& desc)
+{
+    fn("Gamma", std::to_string(desc.m_Gamma));
+    fn("Beta", std::to_string(desc.m_Beta));
+    fn("Eps", std::to_string(desc.m_Eps));
+    fn("DataLayout", GetDataLayoutName(desc.m_DataLayout));
+}
+
+void StringifyLayerParameters<LogicalBinaryDescriptor>::Serialize(ParameterStringifyFunction& fn,
+                                                                  const LogicalBinaryDescriptor& desc)
+{
+    fn("Operation", GetLogicalBinaryOperationAsCString(desc.m_Operation));
+}
+
+void StringifyLayerParameters<QLstmDescriptor>::Serialize(ParameterStringifyFunction& fn,
+                                                          const QLstmDescriptor& desc)
+{
+    fn("CellClip", std::to_string(desc.m_CellClip));
+    fn("ProjectionClip", std::to_string(desc.m_ProjectionClip));
+    fn("CifgEnabled", (desc.m_CifgEnabled ? "true" : "false"));
+    fn("PeepholeEnabled", (desc.m_PeepholeEnabled ? "true" : "false"));
+    fn("ProjectionEnabled", (desc.m_ProjectionEnabled ? "true" : "false"));
+    fn("LayerNormEnabled", (desc.m_LayerNormEnabled ? "true" : "false"));
+    fn("InputIntermediateScale", std::to_string(desc.m_InputIntermediateScale));
+    fn("ForgetIntermediateScale", std::to_string(desc.m_ForgetIntermediateScale));
+    fn("CellIntermediateScale", std::to_string(desc.m_CellIntermediateScale));
+    fn("OutputIntermediateScale", std::to_string(desc.m_OutputIntermediateScale));
+    fn("HiddenStateZeroPoint", std::to_string(desc.m_HiddenStateZeroPoint));
+    fn("HiddenStateScale", std::to_string(desc.m_HiddenStateScale));
+}
+
+void StringifyLayerParameters<SliceDescriptor>::Serialize(ParameterStringifyFunction& fn,
+                                                          const SliceDescriptor& desc)
+{
+    auto toString = [](const std::vector<unsigned int>& values)
+    {
+        std::stringstream ss;
+        ss << "[";
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            ss << (i > 0 ? "," : "") << values[i];
+        }
+        ss << "]";
+        return ss.str();
+    };
+    fn("Begin", toString(desc.m_Begin));
+    fn("Size", toString(desc.m_Size));
+}
+
+void StringifyLayerParameters<StandInDescriptor>::Serialize(ParameterStringifyFunction& fn,
+                                                            const StandInDescriptor& desc)
+{
+    fn("NumInputs", std::to_string(desc.m_NumInputs));
+    fn("NumOutputs", std::to_string(desc.m_NumOutputs));
+}
+
+void StringifyLayerParameters<TensorStatsDescriptor>::Serialize(ParameterStringifyFunction& fn,
+                                                                const TensorStatsDescriptor& desc)
+{
+    fn("NumBins", std::to_string(desc.m_NumBins));
+    fn("HistogramMin", std::to_string(desc.m_HistogramMin));
+    fn("HistogramMax", std::to_string(desc.m_HistogramMax));
+}
+
 } // namespace armnn
\ No newline at end of file
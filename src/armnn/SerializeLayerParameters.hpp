@@ -15,9 +15,8 @@ using ParameterStringifyFunction = std::function<void(const std::string& name, c
 
 ///
 /// StringifyLayerParameters allows serializing layer parameters to string.
-/// The default implementation is a no-op because this operation is considered
-/// non-vital for ArmNN and thus we allow adding new layer parameters without
-/// supplying the corresponding stringify functionality.
+/// The default implementation is a no-op, but every field of a descriptor should be serialized:
+/// the layer support cache used by Optimize tells layer configurations apart by these strings.
 ///
 template <typename LayerParameter>
 struct StringifyLayerParameters
@@ -165,4 +164,59 @@ template <> struct StringifyLayerParameters<TransposeDescriptor>
     static void Serialize(ParameterStringifyFunction& fn, const TransposeDescriptor& desc);
 };
 
+template <> struct StringifyLayerParameters<ArgMinMaxDescriptor>
+{
+    static void Serialize(ParameterStringifyFunction& fn, const ArgMinMaxDescriptor& desc);
+};
+
+template <> struct StringifyLayerParameters<ComparisonDescriptor>
+{
+    static void Serialize(ParameterStringifyFunction& fn, const ComparisonDescriptor& desc);
+};
+
+template <> struct StringifyLayerParameters<ElementwiseUnaryDescriptor>
+{
+    static void Serialize(ParameterStringifyFunction& fn, const ElementwiseUnaryDescriptor& desc);
+};
+
+template <> struct StringifyLayerParameters<FillDescriptor>
+{
+    static void Serialize(ParameterStringifyFunction& fn, const FillDescriptor& desc);
+};
+
+template <> struct StringifyLayerParameters<GatherDescriptor>
+{
+    static void Serialize(ParameterStringifyFunction& fn, const GatherDescriptor& desc);
+};
+
+template <> struct StringifyLayerParameters<InstanceNormalizationDescriptor>
+{
+    static void Serialize(ParameterStringifyFunction& fn, const InstanceNormalizationDescriptor& desc);
+};
+
+template <> struct StringifyLayerParameters<LogicalBinaryDescriptor>
+{
+    static void Serialize(ParameterStringifyFunction& fn, const LogicalBinaryDescriptor& desc);
+};
+
+template <> struct StringifyLayerParameters<QLstmDescriptor>
+{
+    static void Serialize(ParameterStringifyFunction& fn, const QLstmDescriptor& desc);
+};
+
+template <> struct StringifyLayerParameters<SliceDescriptor>
+{
+    static void Serialize(ParameterStringifyFunction& fn, const SliceDescriptor& desc);
+};
+
+template <> struct StringifyLayerParameters<StandInDescriptor>
+{
+    static void Serialize(ParameterStringifyFunction& fn, const StandInDescriptor& desc);
+};
+
+template <> struct StringifyLayerParameters<TensorStatsDescriptor>
+{
+    static void Serialize(ParameterStringifyFunction& fn, const TensorStatsDescriptor& desc);
+};
+
 } // namespace armnn
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include <armnn/utility/Assert.hpp>
 #include <armnn/utility/NumericCast.hpp>
 
+#include <algorithm>
 #include <iostream>
 
 #include <sstream>
@@ -395,6 +396,15 @@ TensorInfo::TensorInfo(const TensorInfo& other)
 , m_Quantization(other.m_Quantization)
 {}
 
+TensorInfo::TensorInfo(TensorInfo&& other) noexcept
+: m_Shape(other.m_Shape)
+, m_DataType(other.m_DataType)
+, m_Quantization(std::move(other.m_Quantization))
+{
+    // Leave the moved from info without scales rather than pointing at the storage it gave up
+    other.m_Quantization.m_NumScales = 0;
+}
+
 TensorInfo& TensorInfo::operator=(const TensorInfo& other)
 {
     m_Shape = other.m_Shape;
@@ -403,6 +413,26 @@ TensorInfo& TensorInfo::operator=(const TensorInfo& other)
     return *this;
 }
 
+TensorInfo& TensorInfo::operator=(TensorInfo&& other) noexcept
+{
+    m_Shape = other.m_Shape;
+    m_DataType = other.m_DataType;
+    if (this != &other)
+    {
+        m_Quantization = std::move(other.m_Quantization);
+        other.m_Quantization.m_NumScales = 0;
+    }
+    return *this;
+}
+
+bool TensorInfo::Quantization::operator==(const Quantization& other) const
+{
+    return m_NumScales == other.m_NumScales &&
+           std::equal(GetScales(), GetScales() + m_NumScales, other.GetScales()) &&
+           m_Offset == other.m_Offset &&
+           m_QuantizationDim == other.m_QuantizationDim;
+}
+
 bool TensorInfo::operator==(const TensorInfo& other) const
 {
     return ((m_Shape == other.m_Shape) &&
@@ -441,29 +471,59 @@ bool TensorInfo::HasPerAxisQuantization() const
 
 std::vector<float> TensorInfo::GetQuantizationScales() const
 {
-    return m_Quantization.m_Scales;
+    const float* scales = m_Quantization.GetScales();
+    return std::vector<float>(scales, scales + m_Quantization.m_NumScales);
 }
 
 void TensorInfo::SetQuantizationScales(const std::vector<float>& scales)
 {
-    m_Quantization.m_Scales = scales;
+    if (scales.size() > 1)
+    {
+        m_Quantization.m_Scales = std::make_shared<const std::vector<float>>(scales);
+        m_Quantization.m_NumScales = armnn::numeric_cast<unsigned int>(scales.size());
+    }
+    else if (scales.size() == 1)
+    {
+        SetQuantizationScale(scales[0]);
+    }
+    else
+    {
+        m_Quantization.m_Scale = 0.0f;
+        m_Quantization.m_NumScales = 0;
+        m_Quantization.m_Scales.reset();
+    }
+}
+
+void TensorInfo::SetQuantizationScales(std::vector<float>&& scales)
+{
+    if (scales.size() > 1)
+    {
+        m_Quantization.m_NumScales = armnn::numeric_cast<unsigned int>(scales.size());
+        m_Quantization.m_Scales = std::make_shared<const std::vector<float>>(std::move(scales));
+    }
+    else
+    {
+        SetQuantizationScales(static_cast<const std::vector<float>&>(scales));
+    }
 }
 
 float TensorInfo::GetQuantizationScale() const
 {
-    if (m_Quantization.m_Scales.empty())
+    if (m_Quantization.m_NumScales == 0)
     {
         // NOTE: old default for backward compatibility
         return 1.0f;
     }
 
     ARMNN_ASSERT(!HasMultipleQuantizationScales());
-    return m_Quantization.m_Scales[0];
+    return m_Quantization.m_Scale;
 }
 
 void TensorInfo::SetQuantizationScale(float scale)
 {
-    m_Quantization.m_Scales = { scale };
+    m_Quantization.m_Scale = scale;
+    m_Quantization.m_NumScales = 1;
+    m_Quantization.m_Scales.reset();
 }
 
 int32_t TensorInfo::GetQuantizationOffset() const
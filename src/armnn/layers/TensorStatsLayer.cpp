@@ -0,0 +1,53 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "TensorStatsLayer.hpp"
+
+#include "LayerCloneBase.hpp"
+
+#include <backendsCommon/WorkloadData.hpp>
+#include <backendsCommon/WorkloadFactory.hpp>
+#include <armnn/utility/IgnoreUnused.hpp>
+
+namespace armnn
+{
+
+TensorStatsLayer::TensorStatsLayer(const TensorStatsDescriptor& param, const char* name)
+    : LayerWithParameters(1, 0, LayerType::TensorStats, param, name)
+{}
+
+std::unique_ptr<IWorkload> TensorStatsLayer::CreateWorkload(const IWorkloadFactory& factory) const
+{
+    const OutputSlot* prevSlot = GetInputSlot(0).GetConnectedOutputSlot();
+
+    TensorStatsQueueDescriptor descriptor;
+    descriptor.m_Guid = prevSlot->GetOwningLayer().GetGuid();
+    descriptor.m_LayerName = prevSlot->GetOwningLayer().GetNameStr();
+    descriptor.m_SlotIndex = prevSlot->CalculateIndexOnOwner();
+
+    SetAdditionalInfo(descriptor);
+
+    return factory.CreateTensorStats(descriptor, PrepInfoAndDesc(descriptor));
+}
+
+TensorStatsLayer* TensorStatsLayer::Clone(Graph& graph) const
+{
+    return CloneBase<TensorStatsLayer>(graph, m_Param, GetName());
+}
+
+void TensorStatsLayer::ValidateTensorShapesFromInputs()
+{
+    // validates that the input is connected.
+    VerifyLayerConnections(1, CHECK_LOCATION());
+    ARMNN_ASSERT(GetNumOutputSlots() == 0);
+}
+
+void TensorStatsLayer::Accept(ILayerVisitor& visitor) const
+{
+    // by design tensor stats layers are never in input graphs
+    IgnoreUnused(visitor);
+    throw armnn::Exception("TensorStatsLayer should never appear in an input graph");
+}
+
+} // namespace armnn
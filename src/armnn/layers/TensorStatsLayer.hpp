@@ -0,0 +1,43 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "LayerWithParameters.hpp"
+
+namespace armnn
+{
+
+/// This layer computes stats of the tensor connected to its input, such as its range, for monitoring.
+/// Unlike a DebugLayer it is not inserted between a layer and its consumers but added as one more consumer,
+/// so the tensor is neither copied nor delayed.
+class TensorStatsLayer : public LayerWithParameters<TensorStatsDescriptor>
+{
+public:
+    /// Makes a workload for the TensorStats type.
+    /// @param [in] factory The workload factory which will create the workload.
+    /// @return A pointer to the created workload, or nullptr if not created.
+    virtual std::unique_ptr<IWorkload> CreateWorkload(const IWorkloadFactory& factory) const override;
+
+    /// Creates a dynamically-allocated copy of this layer.
+    /// @param [in] graph The graph into which this layer is being cloned.
+    TensorStatsLayer* Clone(Graph& graph) const override;
+
+    /// Check if the input tensor shape(s)
+    /// will lead to a valid configuration of @ref TensorStatsLayer.
+    void ValidateTensorShapesFromInputs() override;
+
+    void Accept(ILayerVisitor& visitor) const override;
+
+protected:
+    /// Constructor to create a TensorStatsLayer.
+    /// @param [in] param TensorStatsDescriptor to configure the histogram.
+    /// @param [in] name Optional name for the layer.
+    TensorStatsLayer(const TensorStatsDescriptor& param, const char* name);
+
+    /// Default destructor
+    ~TensorStatsLayer() = default;
+};
+
+} // namespace armnn
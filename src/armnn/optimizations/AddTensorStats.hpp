@@ -0,0 +1,39 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Optimization.hpp"
+#include "NetworkUtils.hpp"
+
+namespace armnn
+{
+namespace optimizations
+{
+
+class AddTensorStatsImpl
+{
+public:
+    AddTensorStatsImpl(const TensorStatsDescriptor& descriptor) : m_Descriptor(descriptor) {}
+
+    void Run(Graph& graph, Layer& layer) const
+    {
+        // Constants are left out as their values do not change from one inference to the next
+        if (layer.GetType() != LayerType::TensorStats && layer.GetType() != LayerType::Constant)
+        {
+            AddTensorStatsLayersAfter(graph, layer, m_Descriptor);
+        }
+    }
+
+protected:
+    ~AddTensorStatsImpl() = default;
+
+private:
+    TensorStatsDescriptor m_Descriptor;
+};
+
+using InsertTensorStatsLayer = OptimizeForType<Layer, AddTensorStatsImpl>;
+
+} // namespace optimizations
+} // namespace armnn
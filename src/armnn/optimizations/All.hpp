@@ -6,6 +6,7 @@
 
 #include "AddBroadcastReshapeLayer.hpp"
 #include "AddDebug.hpp"
+#include "AddTensorStats.hpp"
 #include "ConvertConstants.hpp"
 #include "ConvertFp32NetworkToBf16.hpp"
 #include "ConvertFp32NetworkToFp16.hpp"
@@ -11,6 +11,8 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
+
 BOOST_AUTO_TEST_SUITE(DebugCallback)
 
 namespace
@@ -94,6 +96,78 @@ BOOST_AUTO_TEST_CASE(RuntimeRegisterDebugCallback)
     BOOST_TEST(slotIndexes == expectedSlotIndexes);
 }
 
+BOOST_AUTO_TEST_CASE(RuntimeRegisterTensorStatsCallback)
+{
+    INetworkPtr net = CreateSimpleNetwork();
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    // Optimize the network with tensor stats option and a histogram of 4 bins over [-2, 2)
+    OptimizerOptions optimizerOptions;
+    optimizerOptions.m_TensorStats              = true;
+    optimizerOptions.m_TensorStatsHistogramBins = 4;
+    optimizerOptions.m_TensorStatsHistogramMin  = -2.0f;
+    optimizerOptions.m_TensorStatsHistogramMax  = 2.0f;
+    std::vector<BackendId> backends = { "CpuRef" };
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec(), optimizerOptions);
+
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+    // Set up callback function
+    std::vector<TensorStats> stats;
+    std::vector<unsigned int> slotIndexes;
+    auto mockCallback = [&](LayerGuid guid, unsigned int slotIndex, const TensorStats& tensorStats)
+    {
+        IgnoreUnused(guid);
+        slotIndexes.push_back(slotIndex);
+        stats.push_back(tensorStats);
+    };
+
+    runtime->RegisterTensorStatsCallback(netId, mockCallback);
+
+    std::vector<float> inputData({-2, -1, 0, 1, 2});
+    std::vector<float> outputData(5);
+
+    InputTensors inputTensors
+    {
+        {0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data())}
+    };
+    OutputTensors outputTensors
+    {
+        {0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data())}
+    };
+
+    runtime->EnqueueWorkload(netId, inputTensors, outputTensors);
+
+    // Check that the callback was called for the outputs of the input and activation layers
+    BOOST_TEST(stats.size() == 2);
+    const std::vector<unsigned int> expectedSlotIndexes({0, 0});
+    BOOST_TEST(slotIndexes == expectedSlotIndexes);
+
+    // Both layers consume the input, so their order is not fixed: put the input stats first
+    std::sort(stats.begin(), stats.end(), [](const TensorStats& a, const TensorStats& b) { return a.m_Min < b.m_Min; });
+
+    BOOST_TEST(stats[0].m_Min == -2.0f);
+    BOOST_TEST(stats[0].m_Max == 2.0f);
+    BOOST_TEST(stats[0].m_Mean == 0.0f);
+    BOOST_TEST(stats[0].m_NumElements == 5);
+
+    // Values equal to the top of the range fall in the last bin
+    const std::vector<unsigned int> expectedInputHistogram({1, 1, 1, 2});
+    BOOST_TEST(stats[0].m_Histogram == expectedInputHistogram);
+
+    BOOST_TEST(stats[1].m_Min == 0.0f);
+    BOOST_TEST(stats[1].m_Max == 2.0f);
+    const std::vector<unsigned int> expectedActivationHistogram({0, 0, 3, 2});
+    BOOST_TEST(stats[1].m_Histogram == expectedActivationHistogram);
+
+    // The output of the network is unaffected by the tensor stats layers
+    const std::vector<float> expectedOutput({0, 0, 0, 1, 2});
+    BOOST_TEST(outputData == expectedOutput);
+}
+
 } // anonymous namespace
 
 BOOST_AUTO_TEST_SUITE_END()
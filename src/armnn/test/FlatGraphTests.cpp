@@ -0,0 +1,134 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "GraphUtils.hpp"
+
+#include <FlatGraph.hpp>
+#include <Graph.hpp>
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(FlatGraph)
+
+BOOST_AUTO_TEST_CASE(FlatGraphConnections)
+{
+    armnn::Graph graph;
+    armnn::ActivationDescriptor activationDefaults;
+
+    //  input
+    //   |   \'
+    //  activation
+    //   |   /
+    //  addition
+    //   |
+    //  output
+    armnn::Layer* const input = graph.AddLayer<armnn::InputLayer>(0, "input");
+    armnn::Layer* const activation = graph.AddLayer<armnn::ActivationLayer>(activationDefaults, "activation");
+    armnn::Layer* const addition = graph.AddLayer<armnn::AdditionLayer>("addition");
+    armnn::Layer* const output = graph.AddLayer<armnn::OutputLayer>(0, "output");
+
+    input->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    input->GetOutputSlot(0).Connect(addition->GetInputSlot(1));
+    activation->GetOutputSlot(0).Connect(addition->GetInputSlot(0));
+    addition->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    graph.TopologicalSort();
+    const armnn::FlatGraph flatGraph(graph);
+    BOOST_TEST(flatGraph.GetNumLayers() == 4);
+    BOOST_TEST(flatGraph.GetNumOutputSlots() == 3);
+
+    // Layers keep the order of the graph
+    armnn::FlatGraph::Index index = 0;
+    for (armnn::Layer* layer : graph)
+    {
+        BOOST_TEST(&flatGraph.GetLayer(index) == layer);
+        ++index;
+    }
+
+    const armnn::FlatGraph::Index additionIndex = 2;
+    BOOST_TEST(&flatGraph.GetLayer(additionIndex) == addition);
+    BOOST_TEST(flatGraph.GetEndInputSlot(additionIndex) - flatGraph.GetFirstInputSlot(additionIndex) == 2);
+
+    // The first input of the addition comes from the activation, the second from the input
+    const armnn::FlatGraph::Index firstInput = flatGraph.GetFirstInputSlot(additionIndex);
+    const armnn::FlatGraph::Index activationSlot = flatGraph.GetConnectedOutputSlot(firstInput);
+    const armnn::FlatGraph::Index inputSlot = flatGraph.GetConnectedOutputSlot(firstInput + 1);
+    BOOST_TEST(&flatGraph.GetOutputSlot(activationSlot) == &activation->GetOutputSlot(0));
+    BOOST_TEST(&flatGraph.GetLayer(flatGraph.GetOwningLayer(activationSlot)) == activation);
+    BOOST_TEST(&flatGraph.GetOutputSlot(inputSlot) == &input->GetOutputSlot(0));
+
+    // The input feeds the activation and the addition
+    BOOST_TEST(flatGraph.GetEndConsumer(inputSlot) - flatGraph.GetFirstConsumer(inputSlot) == 2);
+    BOOST_TEST(&flatGraph.GetLayer(flatGraph.GetConsumingLayer(flatGraph.GetFirstConsumer(inputSlot))) == activation);
+    BOOST_TEST(&flatGraph.GetLayer(flatGraph.GetConsumingLayer(flatGraph.GetFirstConsumer(inputSlot) + 1))
+               == addition);
+
+    // Outputs have no output slot
+    const armnn::FlatGraph::Index outputIndex = 3;
+    BOOST_TEST(flatGraph.GetFirstOutputSlot(outputIndex) == flatGraph.GetEndOutputSlot(outputIndex));
+}
+
+BOOST_AUTO_TEST_CASE(FlatGraphUnconnectedInput)
+{
+    armnn::Graph graph;
+    graph.AddLayer<armnn::AdditionLayer>("addition");
+
+    const armnn::FlatGraph flatGraph(graph);
+    BOOST_TEST(flatGraph.GetConnectedOutputSlot(0) == armnn::FlatGraph::Unconnected);
+    BOOST_TEST(flatGraph.GetConnectedOutputSlot(1) == armnn::FlatGraph::Unconnected);
+}
+
+BOOST_AUTO_TEST_CASE(TopologicalSortLongChain)
+{
+    // A chain much longer than the recursion the layers could be sorted with, added in reverse order
+    constexpr unsigned int numActivations = 20000;
+    armnn::Graph graph;
+    armnn::ActivationDescriptor activationDefaults;
+
+    armnn::Layer* next = graph.AddLayer<armnn::OutputLayer>(0, "output");
+    for (unsigned int i = 0; i < numActivations; ++i)
+    {
+        armnn::Layer* const activation =
+            graph.AddLayer<armnn::ActivationLayer>(activationDefaults, std::to_string(i).c_str());
+        activation->GetOutputSlot(0).Connect(next->GetInputSlot(0));
+        next = activation;
+    }
+    armnn::Layer* const input = graph.AddLayer<armnn::InputLayer>(0, "input");
+    input->GetOutputSlot(0).Connect(next->GetInputSlot(0));
+
+    graph.TopologicalSort();
+
+    // Each layer follows the one it consumes
+    auto it = graph.begin();
+    BOOST_TEST(*it == input);
+    for (unsigned int i = numActivations; i-- > 0; )
+    {
+        ++it;
+        BOOST_TEST((*it)->GetNameStr() == std::to_string(i));
+        BOOST_TEST((*it)->GetPriority() == numActivations - i);
+    }
+    ++it;
+    BOOST_TEST(((*it)->GetType() == armnn::LayerType::Output));
+}
+
+BOOST_AUTO_TEST_CASE(TopologicalSortCycle)
+{
+    armnn::Graph graph;
+    armnn::ActivationDescriptor activationDefaults;
+
+    armnn::Layer* const layerA = graph.AddLayer<armnn::ActivationLayer>(activationDefaults, "layerA");
+    armnn::Layer* const layerB = graph.AddLayer<armnn::ActivationLayer>(activationDefaults, "layerB");
+    layerA->GetOutputSlot(0).Connect(layerB->GetInputSlot(0));
+    layerB->GetOutputSlot(0).Connect(layerA->GetInputSlot(0));
+
+    std::vector<armnn::LayerPriority> priorities;
+    BOOST_CHECK_THROW(armnn::FlatGraph(graph).GetTopologicalOrder(priorities), armnn::GraphValidationException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
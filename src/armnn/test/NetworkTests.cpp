@@ -8,6 +8,10 @@
 #include <armnn/LayerVisitorBase.hpp>
 
 #include <Network.hpp>
+#include <layers/ConstantLayer.hpp>
+#include <layers/Convolution2dLayer.hpp>
+
+#include <backendsCommon/CpuTensorHandle.hpp>
 
 #include <boost/test/unit_test.hpp>
 
@@ -539,4 +543,60 @@ BOOST_AUTO_TEST_CASE(StandInLayerSingleInputMultipleOutputsNetworkTest)
     BOOST_TEST(standIn->GetOutputSlot(1).GetConnection(0) == &output1->GetInputSlot(0));
 }
 
+void CheckConstantMemory(bool borrowConstantMemory)
+{
+    armnn::BackendOptions borrowConstantMemoryOption("BorrowConstantMemory",
+                                                     {{ "BorrowConstantMemory", borrowConstantMemory }});
+    armnn::Network net({ borrowConstantMemoryOption });
+
+    std::vector<float> constantData = { 1.0f, 2.0f, 3.0f, 4.0f };
+    std::vector<float> weightsData  = { 1.0f, 0.0f, 0.0f, 1.0f };
+    const armnn::ConstTensor constant(armnn::TensorInfo({ 1, 2, 2, 1 }, armnn::DataType::Float32), constantData);
+    const armnn::ConstTensor weights(armnn::TensorInfo({ 1, 2, 2, 1 }, armnn::DataType::Float32), weightsData);
+
+    armnn::Convolution2dDescriptor convolutionDescriptor;
+    convolutionDescriptor.m_DataLayout = armnn::DataLayout::NHWC;
+    net.AddConstantLayer(constant, "constant");
+    net.AddConvolution2dLayer(convolutionDescriptor, weights, armnn::EmptyOptional(), "convolution");
+
+    // Copies of the graph, as made by Optimize, share borrowed memory as well
+    const armnn::Graph graphCopy(net.GetGraph());
+    for (const armnn::Graph* graph : { &net.GetGraph(), &graphCopy })
+    {
+        for (const armnn::Layer* layer : *graph)
+        {
+            const armnn::ScopedCpuTensorHandle* handle = nullptr;
+            const void* data = nullptr;
+            if (layer->GetType() == armnn::LayerType::Constant)
+            {
+                handle = armnn::PolymorphicDowncast<const armnn::ConstantLayer*>(layer)->m_LayerOutput.get();
+                data   = constantData.data();
+            }
+            else
+            {
+                handle = armnn::PolymorphicDowncast<const armnn::Convolution2dLayer*>(layer)->m_Weight.get();
+                data   = weightsData.data();
+            }
+
+            BOOST_TEST(handle->IsMemoryBorrowed() == borrowConstantMemory);
+            BOOST_TEST((handle->GetConstTensor<void>() == data) == borrowConstantMemory);
+
+            // Workloads take their own handle from the layer's one
+            const armnn::ScopedCpuTensorHandle workloadHandle(*static_cast<const armnn::ConstCpuTensorHandle*>(handle));
+            BOOST_TEST((workloadHandle.GetConstTensor<void>() == data) == borrowConstantMemory);
+            BOOST_TEST(workloadHandle.GetConstTensor<float>()[1] == static_cast<const float*>(data)[1]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(NetworkCopiesConstantMemory)
+{
+    CheckConstantMemory(false);
+}
+
+BOOST_AUTO_TEST_CASE(NetworkBorrowsConstantMemory)
+{
+    CheckConstantMemory(true);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -7,6 +7,7 @@
 
 #include <BackendSettings.hpp>
 #include <Graph.hpp>
+#include <LayerSupportCache.hpp>
 #include <Network.hpp>
 #include <Optimizer.hpp>
 
@@ -788,6 +789,62 @@ BOOST_AUTO_TEST_CASE(BackendHintTest)
     }
 }
 
+BOOST_AUTO_TEST_CASE(LayerSupportCacheTest)
+{
+    using namespace armnn;
+
+    // input -> 8 x ReLu -> BoundedReLu -> output
+    auto createNetwork = [](const TensorInfo& info)
+    {
+        INetworkPtr net(INetwork::Create());
+        ActivationDescriptor reluDescriptor;
+        reluDescriptor.m_Function = ActivationFunction::ReLu;
+        ActivationDescriptor boundedReluDescriptor;
+        boundedReluDescriptor.m_Function = ActivationFunction::BoundedReLu;
+        boundedReluDescriptor.m_A = 6.0f;
+
+        IConnectableLayer* previous = net->AddInputLayer(0);
+        previous->GetOutputSlot(0).SetTensorInfo(info);
+        for (unsigned int i = 0; i < 9; ++i)
+        {
+            IConnectableLayer* activation = net->AddActivationLayer(i < 8 ? reluDescriptor : boundedReluDescriptor);
+            previous->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+            activation->GetOutputSlot(0).SetTensorInfo(info);
+            previous = activation;
+        }
+        previous->GetOutputSlot(0).Connect(net->AddOutputLayer(0)->GetInputSlot(0));
+        return net;
+    };
+
+    IRuntimePtr runtime(IRuntime::Create(IRuntime::CreationOptions()));
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    LayerSupportCache& cache = LayerSupportCache::GetInstance();
+    cache.Clear();
+
+    // Layers with the same configuration share an entry: input, ReLu, BoundedReLu and output
+    BOOST_TEST(Optimize(*createNetwork(TensorInfo({ 1, 8 }, DataType::Float32)), backends,
+                        runtime->GetDeviceSpec()).get());
+    BOOST_TEST(cache.GetNumEntries() == 4);
+
+    // Optimizing the network again only hits the cache
+    BOOST_TEST(Optimize(*createNetwork(TensorInfo({ 1, 8 }, DataType::Float32)), backends,
+                        runtime->GetDeviceSpec()).get());
+    BOOST_TEST(cache.GetNumEntries() == 4);
+
+    // Different tensor infos are a different configuration
+    BOOST_TEST(Optimize(*createNetwork(TensorInfo({ 2, 8 }, DataType::Float32)), backends,
+                        runtime->GetDeviceSpec()).get());
+    BOOST_TEST(cache.GetNumEntries() == 8);
+
+    // Registering a backend invalidates the cached results
+    BackendRegistryInstance().Register("LayerSupportCacheTestBackend", []()
+    {
+        return IBackendInternalUniquePtr();
+    });
+    BOOST_TEST(cache.GetNumEntries() == 0);
+    BackendRegistryInstance().Deregister("LayerSupportCacheTestBackend");
+}
+
 // Tests that OptimizeForExclusiveConnections works, fusing when needed, using BatchNorm fusing as example
 BOOST_AUTO_TEST_CASE(OptimizeForExclusiveConnectionsFuseTest)
 {
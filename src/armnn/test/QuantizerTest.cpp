@@ -5,6 +5,7 @@
 
 #include "../Graph.hpp"
 #include "../Network.hpp"
+#include "../NetworkQuantizer.hpp"
 #include "../NetworkQuantizerUtils.hpp"
 #include "../OverrideInputRangeVisitor.hpp"
 #include "../RangeTracker.hpp"
@@ -3125,5 +3126,70 @@ BOOST_AUTO_TEST_CASE(TestConnectionPreservationAfterDynamicQuant)
     VisitLayersTopologically(quantNetwork.get(), visitor2);
 }
 
+BOOST_AUTO_TEST_CASE(RefineBatchMatchesRefine)
+{
+    // input -> ReLu -> Addition(input) -> output, returning the guids of the calibrated layers
+    auto createNetwork = [](std::vector<LayerGuid>& guids)
+    {
+        INetworkPtr network = INetwork::Create();
+        ActivationDescriptor reLUDesc;
+        reLUDesc.m_Function = ActivationFunction::ReLu;
+
+        IConnectableLayer* inputLayer = network->AddInputLayer(0);
+        IConnectableLayer* reLULayer = network->AddActivationLayer(reLUDesc);
+        IConnectableLayer* addLayer = network->AddAdditionLayer();
+        IConnectableLayer* outputLayer = network->AddOutputLayer(0);
+
+        inputLayer->GetOutputSlot(0).Connect(reLULayer->GetInputSlot(0));
+        inputLayer->GetOutputSlot(0).Connect(addLayer->GetInputSlot(1));
+        reLULayer->GetOutputSlot(0).Connect(addLayer->GetInputSlot(0));
+        addLayer->GetOutputSlot(0).Connect(outputLayer->GetInputSlot(0));
+
+        const TensorInfo info(TensorShape({1, 2, 2, 1}), DataType::Float32);
+        inputLayer->GetOutputSlot(0).SetTensorInfo(info);
+        reLULayer->GetOutputSlot(0).SetTensorInfo(info);
+        addLayer->GetOutputSlot(0).SetTensorInfo(info);
+
+        guids = { inputLayer->GetGuid(), reLULayer->GetGuid(), addLayer->GetGuid() };
+        return network;
+    };
+
+    const TensorInfo tensorInfo(TensorShape({1, 2, 2, 1}), DataType::Float32);
+    std::vector<std::vector<float>> inputData(9);
+    std::vector<InputTensors> inputTensorsBatch;
+    for (unsigned int i = 0; i < inputData.size(); ++i)
+    {
+        float value = static_cast<float>(i) - 4.0f;
+        inputData[i] = { value, -2.0f * value, 0.5f * value, 1.0f };
+        inputTensorsBatch.push_back({ std::make_pair(0, ConstTensor(tensorInfo, inputData[i].data())) });
+    }
+
+    std::vector<LayerGuid> guids;
+    INetworkPtr network = createNetwork(guids);
+    NetworkQuantizer quantizer(network.get(), QuantizerOptions());
+    for (const InputTensors& inputTensors : inputTensorsBatch)
+    {
+        quantizer.Refine(inputTensors);
+    }
+
+    // Calibrate in two batches, with more threads than entries in the second one
+    std::vector<LayerGuid> batchGuids;
+    INetworkPtr batchNetwork = createNetwork(batchGuids);
+    NetworkQuantizer batchQuantizer(batchNetwork.get(), QuantizerOptions());
+    batchQuantizer.RefineBatch(std::vector<InputTensors>(inputTensorsBatch.begin(), inputTensorsBatch.begin() + 6), 3);
+    batchQuantizer.RefineBatch(std::vector<InputTensors>(inputTensorsBatch.begin() + 6, inputTensorsBatch.end()), 8);
+
+    for (unsigned int i = 0; i < guids.size(); ++i)
+    {
+        std::pair<float, float> range = quantizer.GetMinMaxRange(guids[i], 0);
+        std::pair<float, float> batchRange = batchQuantizer.GetMinMaxRange(batchGuids[i], 0);
+        BOOST_TEST(range.first == batchRange.first);
+        BOOST_TEST(range.second == batchRange.second);
+    }
+
+    // The largest input, 8 in the first entry, is doubled by the add layer
+    BOOST_TEST(batchQuantizer.GetMinMaxRange(batchGuids[2], 0).second == 16.0f);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 } // namespace armnn
@@ -24,6 +24,9 @@
 #include "RuntimeTests.hpp"
 #include "TestUtils.hpp"
 
+#include <set>
+#include <sstream>
+
 namespace armnn
 {
 
@@ -32,6 +35,11 @@ void RuntimeLoadedNetworksReserve(armnn::Runtime* runtime)
     runtime->m_LoadedNetworks.reserve(1);
 }
 
+const ConstantTensorStore& RuntimeGetConstantTensorStore(armnn::Runtime* runtime)
+{
+    return runtime->m_ConstantTensorStore;
+}
+
 }
 
 BOOST_AUTO_TEST_SUITE(Runtime)
@@ -61,6 +69,435 @@ BOOST_AUTO_TEST_CASE(RuntimeUnloadNetwork)
     BOOST_TEST(runtime->UnloadNetwork(networkIdentifier1) == armnn::Status::Failure);
 }
 
+BOOST_AUTO_TEST_CASE(RuntimeSharesConstantTensors)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    armnn::Runtime runtime(options);
+    std::vector<BackendId> backends = { Compute::CpuRef };
+
+    const TensorInfo tensorInfo({ 1, 4 }, DataType::Float32);
+    std::vector<float> weightsData = { 1, 0, 0, 0,
+                                       0, 1, 0, 0,
+                                       0, 0, 1, 0,
+                                       0, 0, 0, 1 };
+    // The bias and the constant hold the same data, so they are stored once as well
+    std::vector<float> biasData = { 1, 2, 3, 4 };
+
+    // input -> FullyConnected -> Addition(constant) -> output
+    auto createNetwork = [&]()
+    {
+        INetworkPtr net(INetwork::Create());
+        FullyConnectedDescriptor descriptor;
+        descriptor.m_BiasEnabled = true;
+
+        IConnectableLayer* input = net->AddInputLayer(0);
+        IConnectableLayer* fullyConnected = net->AddFullyConnectedLayer(
+            descriptor,
+            ConstTensor(TensorInfo({ 4, 4 }, DataType::Float32), weightsData),
+            Optional<ConstTensor>(ConstTensor(TensorInfo({ 4 }, DataType::Float32), biasData)));
+        IConnectableLayer* constant = net->AddConstantLayer(ConstTensor(tensorInfo, biasData));
+        IConnectableLayer* addition = net->AddAdditionLayer();
+        IConnectableLayer* output = net->AddOutputLayer(0);
+
+        input->GetOutputSlot(0).Connect(fullyConnected->GetInputSlot(0));
+        fullyConnected->GetOutputSlot(0).Connect(addition->GetInputSlot(0));
+        constant->GetOutputSlot(0).Connect(addition->GetInputSlot(1));
+        addition->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+        input->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+        fullyConnected->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+        constant->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+        addition->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+        return net;
+    };
+
+    NetworkId networkId1;
+    NetworkId networkId2;
+    BOOST_TEST(runtime.LoadNetwork(networkId1, Optimize(*createNetwork(), backends, runtime.GetDeviceSpec()))
+               == Status::Success);
+    BOOST_TEST(runtime.LoadNetwork(networkId2, Optimize(*createNetwork(), backends, runtime.GetDeviceSpec()))
+               == Status::Success);
+
+    const ConstantTensorStore& store = RuntimeGetConstantTensorStore(&runtime);
+    BOOST_TEST(store.GetNumSharedMemoryBlocks() == 2);
+
+    // The loaded networks no longer depend on the data they were created from
+    weightsData.assign(weightsData.size(), 0.0f);
+    biasData.assign(biasData.size(), 0.0f);
+
+    for (NetworkId networkId : { networkId1, networkId2 })
+    {
+        std::vector<float> inputData = { 10, 20, 30, 40 };
+        std::vector<float> outputData(4);
+        InputTensors inputTensors{ { 0, ConstTensor(runtime.GetInputTensorInfo(networkId, 0), inputData.data()) } };
+        OutputTensors outputTensors{ { 0, Tensor(runtime.GetOutputTensorInfo(networkId, 0), outputData.data()) } };
+
+        BOOST_TEST(runtime.EnqueueWorkload(networkId, inputTensors, outputTensors) == Status::Success);
+        BOOST_TEST(outputData == std::vector<float>({ 12, 24, 36, 48 }), boost::test_tools::per_element());
+    }
+
+    runtime.UnloadNetwork(networkId1);
+    BOOST_TEST(store.GetNumSharedMemoryBlocks() == 2);
+    runtime.UnloadNetwork(networkId2);
+    BOOST_TEST(store.GetNumSharedMemoryBlocks() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeLoadNetworks)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+    std::vector<BackendId> backends = { Compute::CpuRef };
+
+    const TensorInfo tensorInfo({ 1, 4 }, DataType::Float32);
+
+    // input -> Activation(bounded ReLu) -> output, where each network clamps to its own upper bound
+    auto createNetwork = [&](float upperBound, bool setOutputInfo)
+    {
+        INetworkPtr net(INetwork::Create());
+        ActivationDescriptor descriptor;
+        descriptor.m_Function = ActivationFunction::BoundedReLu;
+        descriptor.m_A = upperBound;
+
+        IConnectableLayer* input = net->AddInputLayer(0);
+        IConnectableLayer* activation = net->AddActivationLayer(descriptor);
+        IConnectableLayer* output = net->AddOutputLayer(0);
+
+        input->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+        activation->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+        input->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+        if (setOutputInfo)
+        {
+            activation->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+        }
+        return net;
+    };
+
+    // The third network is missing a tensor info, so it fails to optimize without affecting the others
+    std::vector<INetworkPtr> networks;
+    networks.push_back(createNetwork(1.0f, true));
+    networks.push_back(createNetwork(2.0f, true));
+    networks.push_back(createNetwork(3.0f, false));
+    networks.push_back(createNetwork(4.0f, true));
+    networks.push_back(createNetwork(5.0f, true));
+
+    std::vector<const INetwork*> rawNetworks;
+    for (const INetworkPtr& network : networks)
+    {
+        rawNetworks.push_back(network.get());
+    }
+
+    std::vector<NetworkId> networkIds;
+    std::vector<std::string> errorMessages;
+    std::vector<Status> statuses = runtime->LoadNetworks(networkIds, rawNetworks, backends, errorMessages,
+                                                         OptimizerOptions(), INetworkProperties(), 2);
+
+    BOOST_TEST(statuses.size() == networks.size());
+    BOOST_TEST(networkIds.size() == networks.size());
+    BOOST_TEST(errorMessages.size() == networks.size());
+    BOOST_TEST(std::set<NetworkId>(networkIds.begin(), networkIds.end()).size() == networks.size());
+
+    for (size_t i = 0; i < networks.size(); ++i)
+    {
+        const NetworkId networkId = networkIds[i];
+        if (i == 2)
+        {
+            BOOST_TEST((statuses[i] == Status::Failure));
+            BOOST_TEST(!errorMessages[i].empty());
+            BOOST_TEST(runtime->GetProfiler(networkId) == nullptr);
+            continue;
+        }
+
+        BOOST_TEST((statuses[i] == Status::Success));
+        BOOST_TEST(errorMessages[i].empty());
+
+        std::vector<float> inputData = { -1.0f, 1.5f, 3.5f, 10.0f };
+        std::vector<float> outputData(4);
+        InputTensors inputTensors{ { 0, ConstTensor(runtime->GetInputTensorInfo(networkId, 0), inputData.data()) } };
+        OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(networkId, 0), outputData.data()) } };
+        BOOST_TEST((runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) == Status::Success));
+
+        const float upperBound = static_cast<float>(i + 1);
+        for (size_t j = 0; j < inputData.size(); ++j)
+        {
+            BOOST_TEST(outputData[j] == std::min(std::max(inputData[j], 0.0f), upperBound));
+        }
+
+        // The optimization and the loading are timed in the profiler of the network
+        std::stringstream profilerOutput;
+        runtime->GetProfiler(networkId)->AnalyzeEventsAndWriteResults(profilerOutput);
+        BOOST_TEST(profilerOutput.str().find(" Optimize ") != std::string::npos);
+        BOOST_TEST(profilerOutput.str().find(" LoadNetwork ") != std::string::npos);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeDynamicInputShapes)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+    std::vector<BackendId> backends = { Compute::CpuRef };
+
+    // input -> FullyConnected -> Activation(ReLu) -> output, loaded for a batch of 1
+    std::vector<float> weightsData = { 1, 0, 0, 0,
+                                       0, 2, 0, 0,
+                                       0, 0, 3, 0,
+                                       0, 0, 0, 4 };
+    std::vector<float> biasData = { -1, -1, -1, -1 };
+    FullyConnectedDescriptor fullyConnectedDescriptor;
+    fullyConnectedDescriptor.m_BiasEnabled = true;
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::ReLu;
+
+    INetworkPtr net(INetwork::Create());
+    IConnectableLayer* input = net->AddInputLayer(0);
+    IConnectableLayer* fullyConnected = net->AddFullyConnectedLayer(
+        fullyConnectedDescriptor,
+        ConstTensor(TensorInfo({ 4, 4 }, DataType::Float32), weightsData),
+        Optional<ConstTensor>(ConstTensor(TensorInfo({ 4 }, DataType::Float32), biasData)));
+    IConnectableLayer* activation = net->AddActivationLayer(activationDescriptor);
+    IConnectableLayer* output = net->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(fullyConnected->GetInputSlot(0));
+    fullyConnected->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    const TensorInfo tensorInfo({ 1, 4 }, DataType::Float32);
+    input->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    fullyConnected->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    activation->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    NetworkId networkId;
+    std::string errorMessage;
+    BOOST_TEST((runtime->LoadNetwork(networkId,
+                                     Optimize(*net, backends, runtime->GetDeviceSpec()),
+                                     errorMessage,
+                                     INetworkProperties(false, false, true)) == Status::Success));
+    runtime->GetProfiler(networkId)->EnableProfiling(true);
+
+    auto run = [&](unsigned int batchSize)
+    {
+        std::vector<float> inputData(batchSize * 4);
+        for (unsigned int i = 0; i < inputData.size(); ++i)
+        {
+            inputData[i] = static_cast<float>(i % 3);
+        }
+        std::vector<float> outputData(batchSize * 4);
+
+        const TensorInfo batchInfo({ batchSize, 4 }, DataType::Float32);
+        InputTensors inputTensors{ { 0, ConstTensor(batchInfo, inputData.data()) } };
+        OutputTensors outputTensors{ { 0, Tensor(batchInfo, outputData.data()) } };
+        BOOST_TEST((runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) == Status::Success));
+
+        for (unsigned int i = 0; i < inputData.size(); ++i)
+        {
+            const float expected = std::max(inputData[i] * weightsData[(i % 4) * 5] - 1.0f, 0.0f);
+            BOOST_TEST(outputData[i] == expected);
+        }
+    };
+
+    // The plan made for each new batch size is reused when it comes back
+    for (unsigned int batchSize : { 1u, 3u, 3u, 1u, 5u, 3u })
+    {
+        run(batchSize);
+    }
+
+    // Counts the plans in the sequence of events, which lists each of them on its own line
+    std::stringstream profilerOutput;
+    runtime->GetProfiler(networkId)->AnalyzeEventsAndWriteResults(profilerOutput);
+    std::string profilerString = profilerOutput.str();
+    profilerString = profilerString.substr(0, profilerString.find("Event Stats"));
+    size_t numShapePlans = 0;
+    for (size_t pos = profilerString.find("CreateShapePlan"); pos != std::string::npos;
+         pos = profilerString.find("CreateShapePlan", pos + 1))
+    {
+        ++numShapePlans;
+    }
+    BOOST_TEST(numShapePlans == 2);
+
+    // The outputs must have the shapes inferred for the inputs
+    std::vector<float> inputData(8);
+    std::vector<float> outputData(4);
+    InputTensors inputTensors{ { 0, ConstTensor(TensorInfo({ 2, 4 }, DataType::Float32), inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(tensorInfo, outputData.data()) } };
+    BOOST_CHECK_THROW(runtime->EnqueueWorkload(networkId, inputTensors, outputTensors), InvalidArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(RuntimePipelinedInference)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+    std::vector<BackendId> backends = { Compute::CpuRef };
+
+    const TensorInfo tensorInfo({ 1, 8 }, DataType::Float32);
+    const TensorInfo weightsInfo({ 8, 8 }, DataType::Float32);
+    std::vector<float> weightsData(64);
+    for (unsigned int i = 0; i < weightsData.size(); ++i)
+    {
+        weightsData[i] = static_cast<float>(i % 5) * 0.25f - 0.5f;
+    }
+
+    // input -> FullyConnected -> Activation -> FullyConnected -> Addition(input) -> output 0
+    //                                 \-> output 1
+    // so that tensors go from each stage to the next, from the input to a later stage and out of a middle stage
+    auto createNetwork = [&]()
+    {
+        INetworkPtr net(INetwork::Create());
+        FullyConnectedDescriptor fullyConnectedDescriptor;
+        ActivationDescriptor activationDescriptor;
+        activationDescriptor.m_Function = ActivationFunction::ReLu;
+
+        IConnectableLayer* input = net->AddInputLayer(0);
+        IConnectableLayer* fullyConnected1 = net->AddFullyConnectedLayer(
+            fullyConnectedDescriptor, ConstTensor(weightsInfo, weightsData), EmptyOptional());
+        IConnectableLayer* activation = net->AddActivationLayer(activationDescriptor);
+        IConnectableLayer* fullyConnected2 = net->AddFullyConnectedLayer(
+            fullyConnectedDescriptor, ConstTensor(weightsInfo, weightsData), EmptyOptional());
+        IConnectableLayer* addition = net->AddAdditionLayer();
+        IConnectableLayer* output0 = net->AddOutputLayer(0);
+        IConnectableLayer* output1 = net->AddOutputLayer(1);
+
+        input->GetOutputSlot(0).Connect(fullyConnected1->GetInputSlot(0));
+        input->GetOutputSlot(0).Connect(addition->GetInputSlot(1));
+        fullyConnected1->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+        activation->GetOutputSlot(0).Connect(fullyConnected2->GetInputSlot(0));
+        activation->GetOutputSlot(0).Connect(output1->GetInputSlot(0));
+        fullyConnected2->GetOutputSlot(0).Connect(addition->GetInputSlot(0));
+        addition->GetOutputSlot(0).Connect(output0->GetInputSlot(0));
+
+        for (IConnectableLayer* layer : { input, fullyConnected1, activation, fullyConnected2, addition })
+        {
+            layer->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+        }
+        return net;
+    };
+
+    NetworkId networkId;
+    NetworkId pipelinedNetworkId;
+    std::string errorMessage;
+    BOOST_TEST((runtime->LoadNetwork(networkId, Optimize(*createNetwork(), backends, runtime->GetDeviceSpec()),
+                                     errorMessage, INetworkProperties()) == Status::Success));
+    BOOST_TEST((runtime->LoadNetwork(pipelinedNetworkId,
+                                     Optimize(*createNetwork(), backends, runtime->GetDeviceSpec()),
+                                     errorMessage, INetworkProperties(false, false, false, 3)) == Status::Success));
+
+    constexpr unsigned int numInferences = 7;
+    std::vector<std::vector<float>> inputData(numInferences, std::vector<float>(8));
+    std::vector<std::vector<float>> outputData(2 * numInferences, std::vector<float>(8));
+    std::vector<std::vector<float>> expectedOutputData(2 * numInferences, std::vector<float>(8));
+    std::vector<InputTensors> inputTensors;
+    std::vector<OutputTensors> outputTensors;
+    for (unsigned int i = 0; i < numInferences; ++i)
+    {
+        for (unsigned int j = 0; j < inputData[i].size(); ++j)
+        {
+            inputData[i][j] = static_cast<float>((i + j) % 7) - 3.0f;
+        }
+        inputTensors.push_back({ { 0, ConstTensor(tensorInfo, inputData[i].data()) } });
+        outputTensors.push_back({ { 0, Tensor(tensorInfo, outputData[2 * i].data()) },
+                                  { 1, Tensor(tensorInfo, outputData[2 * i + 1].data()) } });
+
+        OutputTensors expectedOutputTensors{ { 0, Tensor(tensorInfo, expectedOutputData[2 * i].data()) },
+                                             { 1, Tensor(tensorInfo, expectedOutputData[2 * i + 1].data()) } };
+        BOOST_TEST((runtime->EnqueueWorkload(networkId, inputTensors.back(), expectedOutputTensors)
+                    == Status::Success));
+    }
+
+    // Running the stream twice reuses the double buffers of the stages
+    for (unsigned int run = 0; run < 2; ++run)
+    {
+        BOOST_TEST((runtime->EnqueueWorkloads(pipelinedNetworkId, inputTensors, outputTensors) == Status::Success));
+        for (unsigned int i = 0; i < outputData.size(); ++i)
+        {
+            BOOST_TEST(outputData[i] == expectedOutputData[i], boost::test_tools::per_element());
+            std::fill(outputData[i].begin(), outputData[i].end(), 0.0f);
+        }
+    }
+
+    // Networks without stages run the inferences one after the other
+    BOOST_TEST((runtime->EnqueueWorkloads(networkId, inputTensors, outputTensors) == Status::Success));
+    for (unsigned int i = 0; i < outputData.size(); ++i)
+    {
+        BOOST_TEST(outputData[i] == expectedOutputData[i], boost::test_tools::per_element());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeExecuteRegisteredTensors)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+    std::vector<BackendId> backends = { Compute::CpuRef };
+
+    // input -> Activation -> output, with the input and output imported and exported
+    const TensorInfo tensorInfo({ 1, 4 }, DataType::Float32);
+    INetworkPtr net(INetwork::Create());
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::Square;
+    IConnectableLayer* input = net->AddInputLayer(0);
+    IConnectableLayer* activation = net->AddActivationLayer(activationDescriptor);
+    IConnectableLayer* output = net->AddOutputLayer(0);
+    input->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    input->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    activation->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    NetworkId networkId;
+    std::string errorMessage;
+    BOOST_TEST((runtime->LoadNetwork(networkId, Optimize(*net, backends, runtime->GetDeviceSpec()),
+                                     errorMessage, INetworkProperties(true, true)) == Status::Success));
+
+    // Two sets of tensors, so that each Execute has to import its own memory again
+    std::vector<float> inputData0(4);
+    std::vector<float> inputData1(4);
+    std::vector<float> outputData0(4);
+    std::vector<float> outputData1(4);
+
+    BoundTensorsId boundTensorsId0;
+    BoundTensorsId boundTensorsId1;
+    BOOST_TEST((runtime->RegisterTensors(networkId,
+                                         { { 0, ConstTensor(tensorInfo, inputData0.data()) } },
+                                         { { 0, Tensor(tensorInfo, outputData0.data()) } },
+                                         boundTensorsId0) == Status::Success));
+    BOOST_TEST((runtime->RegisterTensors(networkId,
+                                         { { 0, ConstTensor(tensorInfo, inputData1.data()) } },
+                                         { { 0, Tensor(tensorInfo, outputData1.data()) } },
+                                         boundTensorsId1) == Status::Success));
+    BOOST_TEST(boundTensorsId0 != boundTensorsId1);
+
+    for (unsigned int run = 0; run < 3; ++run)
+    {
+        for (unsigned int i = 0; i < 4; ++i)
+        {
+            inputData0[i] = static_cast<float>(run + i);
+            inputData1[i] = -static_cast<float>(run * i);
+        }
+
+        BOOST_TEST((runtime->Execute(boundTensorsId0) == Status::Success));
+        BOOST_TEST((runtime->Execute(boundTensorsId1) == Status::Success));
+
+        for (unsigned int i = 0; i < 4; ++i)
+        {
+            BOOST_TEST(outputData0[i] == inputData0[i] * inputData0[i]);
+            BOOST_TEST(outputData1[i] == inputData1[i] * inputData1[i]);
+        }
+    }
+
+    // Unregistered tensors and those of unloaded networks cannot run anymore
+    BOOST_TEST((runtime->UnregisterTensors(boundTensorsId0) == Status::Success));
+    BOOST_TEST((runtime->Execute(boundTensorsId0) == Status::Failure));
+    BOOST_TEST((runtime->UnloadNetwork(networkId) == Status::Success));
+    BOOST_TEST((runtime->Execute(boundTensorsId1) == Status::Failure));
+}
+
 // Note: the current builds we don't do valgrind and gperftools based leak checking at the same
 //       time, so in practice WITH_VALGRIND and ARMNN_LEAK_CHECKING_ENABLED are exclusive. The
 //       valgrind tests can stay for x86 builds, but on hikey Valgrind is just way too slow
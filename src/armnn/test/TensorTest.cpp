@@ -246,6 +246,44 @@ BOOST_AUTO_TEST_CASE(TensorInfoPerAxisQuantization)
     BOOST_CHECK(tensorInfo1.GetQuantizationDim().value() == 1);
 }
 
+BOOST_AUTO_TEST_CASE(CopyAndMovePerAxisQuantizationTensorInfo)
+{
+    std::vector<float> perAxisScales{ 3.0f, 4.0f, 5.0f };
+    TensorInfo infoA({ 3, 2 }, DataType::QSymmS8, perAxisScales, 0);
+
+    // Copies share the scales and stay equal to the original
+    TensorInfo infoB(infoA);
+    BOOST_CHECK(infoB == infoA);
+    BOOST_CHECK(infoB.GetQuantizationScalesData() == infoA.GetQuantizationScalesData());
+    BOOST_CHECK(infoB.GetQuantizationScales() == perAxisScales);
+
+    // Setting the scales of a copy leaves the original untouched
+    infoB.SetQuantizationScales(std::vector<float>{ 6.0f, 7.0f, 8.0f });
+    BOOST_CHECK(infoB != infoA);
+    BOOST_CHECK(infoA.GetQuantizationScales() == perAxisScales);
+
+    // Equal scales held in different storage compare equal
+    infoB.SetQuantizationScales(perAxisScales);
+    BOOST_CHECK(infoB == infoA);
+
+    // Moving takes the scales over
+    const float* scalesData = infoA.GetQuantizationScalesData();
+    TensorInfo infoC(std::move(infoA));
+    BOOST_CHECK(infoC.GetQuantizationScalesData() == scalesData);
+    BOOST_TEST(infoC.GetNumQuantizationScales() == 3);
+    BOOST_CHECK(infoC.GetQuantizationDim().value() == 0);
+
+    // A single scale is held inline
+    TensorInfo infoD({ 3, 2 }, DataType::QAsymmU8, 0.5f, 10);
+    TensorInfo infoE = infoD;
+    BOOST_TEST(infoE.GetNumQuantizationScales() == 1);
+    BOOST_TEST(*infoE.GetQuantizationScalesData() == 0.5f);
+    BOOST_CHECK(infoE.GetQuantizationScalesData() != infoD.GetQuantizationScalesData());
+    infoE = std::move(infoC);
+    BOOST_CHECK(infoE.HasMultipleQuantizationScales());
+    BOOST_CHECK(infoE.GetQuantizationScales() == perAxisScales);
+}
+
 BOOST_AUTO_TEST_CASE(TensorShape_scalar)
 {
     float mutableDatum = 3.1416f;
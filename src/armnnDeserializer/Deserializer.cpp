@@ -4,6 +4,7 @@
 //
 
 #include "Deserializer.hpp"
+#include "OptimizedNetworkUtils.hpp"
 
 #include <armnn/Descriptors.hpp>
 #include <armnn/Exceptions.hpp>
@@ -179,6 +180,10 @@ m_ParserFunctions(Layer_MAX+1, &Deserializer::ParseUnsupportedLayer)
     m_ParserFunctions[Layer_ComparisonLayer]             = &Deserializer::ParseComparison;
     m_ParserFunctions[Layer_ConcatLayer]                 = &Deserializer::ParseConcat;
     m_ParserFunctions[Layer_ConstantLayer]               = &Deserializer::ParseConstant;
+    m_ParserFunctions[Layer_ConvertBf16ToFp32Layer]      = &Deserializer::ParseOptimizerLayer;
+    m_ParserFunctions[Layer_ConvertFp16ToFp32Layer]      = &Deserializer::ParseOptimizerLayer;
+    m_ParserFunctions[Layer_ConvertFp32ToBf16Layer]      = &Deserializer::ParseOptimizerLayer;
+    m_ParserFunctions[Layer_ConvertFp32ToFp16Layer]      = &Deserializer::ParseOptimizerLayer;
     m_ParserFunctions[Layer_Convolution2dLayer]          = &Deserializer::ParseConvolution2d;
     m_ParserFunctions[Layer_DepthToSpaceLayer]           = &Deserializer::ParseDepthToSpace;
     m_ParserFunctions[Layer_DepthwiseConvolution2dLayer] = &Deserializer::ParseDepthwiseConvolution2d;
@@ -199,6 +204,8 @@ m_ParserFunctions(Layer_MAX+1, &Deserializer::ParseUnsupportedLayer)
     m_ParserFunctions[Layer_LstmLayer]                   = &Deserializer::ParseLstm;
     m_ParserFunctions[Layer_MaximumLayer]                = &Deserializer::ParseMaximum;
     m_ParserFunctions[Layer_MeanLayer]                   = &Deserializer::ParseMean;
+    m_ParserFunctions[Layer_MemCopyLayer]                = &Deserializer::ParseOptimizerLayer;
+    m_ParserFunctions[Layer_MemImportLayer]              = &Deserializer::ParseOptimizerLayer;
     m_ParserFunctions[Layer_MinimumLayer]                = &Deserializer::ParseMinimum;
     m_ParserFunctions[Layer_MergeLayer]                  = &Deserializer::ParseMerge;
     m_ParserFunctions[Layer_MergerLayer]                 = &Deserializer::ParseConcat;
@@ -254,6 +261,14 @@ Deserializer::LayerBaseRawPtr Deserializer::GetBaseLayer(const GraphPtr& graphPt
             return graphPtr->layers()->Get(layerIndex)->layer_as_ConcatLayer()->base();
         case Layer::Layer_ConstantLayer:
             return graphPtr->layers()->Get(layerIndex)->layer_as_ConstantLayer()->base();
+        case Layer::Layer_ConvertBf16ToFp32Layer:
+            return graphPtr->layers()->Get(layerIndex)->layer_as_ConvertBf16ToFp32Layer()->base();
+        case Layer::Layer_ConvertFp16ToFp32Layer:
+            return graphPtr->layers()->Get(layerIndex)->layer_as_ConvertFp16ToFp32Layer()->base();
+        case Layer::Layer_ConvertFp32ToBf16Layer:
+            return graphPtr->layers()->Get(layerIndex)->layer_as_ConvertFp32ToBf16Layer()->base();
+        case Layer::Layer_ConvertFp32ToFp16Layer:
+            return graphPtr->layers()->Get(layerIndex)->layer_as_ConvertFp32ToFp16Layer()->base();
         case Layer::Layer_Convolution2dLayer:
             return graphPtr->layers()->Get(layerIndex)->layer_as_Convolution2dLayer()->base();
         case Layer::Layer_DepthToSpaceLayer:
@@ -294,6 +309,10 @@ Deserializer::LayerBaseRawPtr Deserializer::GetBaseLayer(const GraphPtr& graphPt
             return graphPtr->layers()->Get(layerIndex)->layer_as_LstmLayer()->base();
         case Layer::Layer_MeanLayer:
             return graphPtr->layers()->Get(layerIndex)->layer_as_MeanLayer()->base();
+        case Layer::Layer_MemCopyLayer:
+            return graphPtr->layers()->Get(layerIndex)->layer_as_MemCopyLayer()->base();
+        case Layer::Layer_MemImportLayer:
+            return graphPtr->layers()->Get(layerIndex)->layer_as_MemImportLayer()->base();
         case Layer::Layer_MinimumLayer:
             return graphPtr->layers()->Get(layerIndex)->layer_as_MinimumLayer()->base();
         case Layer::Layer_MaximumLayer:
@@ -536,6 +555,9 @@ armnn::TensorInfo ToTensorInfo(Deserializer::TensorRawPtr tensorPtr)
         case DataType_Float16:
             type = armnn::DataType::Float16;
             break;
+        case DataType_BFloat16:
+            type = armnn::DataType::BFloat16;
+            break;
         case DataType_Boolean:
             type = armnn::DataType::Boolean;
             break;
@@ -683,6 +705,7 @@ void Deserializer::ResetParser()
     m_Network = armnn::INetworkPtr(nullptr, nullptr);
     m_InputBindings.clear();
     m_OutputBindings.clear();
+    m_LayerIndices.clear();
 }
 
 IDeserializer* IDeserializer::CreateRaw()
@@ -704,15 +727,31 @@ INetworkPtr Deserializer::CreateNetworkFromBinary(const std::vector<uint8_t>& bi
 {
      ResetParser();
      GraphPtr graph = LoadGraphFromBinary(binaryContent.data(), binaryContent.size());
+     if (graph->isOptimized())
+     {
+         throw ParseException(fmt::format("The network is optimized, use CreateOptimizedNetworkFromBinary {}",
+                                          CHECK_LOCATION().AsString()));
+     }
      return CreateNetworkFromGraph(graph);
 }
 
 armnn::INetworkPtr Deserializer::CreateNetworkFromBinary(std::istream& binaryContent)
+{
+    std::vector<uint8_t> content((std::istreambuf_iterator<char>(binaryContent)), std::istreambuf_iterator<char>());
+    return CreateNetworkFromBinary(content);
+}
+
+armnn::IOptimizedNetworkPtr Deserializer::CreateOptimizedNetworkFromBinary(const std::vector<uint8_t>& binaryContent)
 {
     ResetParser();
+    GraphPtr graph = LoadGraphFromBinary(binaryContent.data(), binaryContent.size());
+    return CreateOptimizedNetworkFromGraph(graph);
+}
+
+armnn::IOptimizedNetworkPtr Deserializer::CreateOptimizedNetworkFromBinary(std::istream& binaryContent)
+{
     std::vector<uint8_t> content((std::istreambuf_iterator<char>(binaryContent)), std::istreambuf_iterator<char>());
-    GraphPtr graph = LoadGraphFromBinary(content.data(), content.size());
-    return CreateNetworkFromGraph(graph);
+    return CreateOptimizedNetworkFromBinary(content);
 }
 
 Deserializer::GraphPtr Deserializer::LoadGraphFromBinary(const uint8_t* binaryContent, size_t len)
@@ -774,6 +813,82 @@ INetworkPtr Deserializer::CreateNetworkFromGraph(GraphPtr graph)
     return std::move(m_Network);
 }
 
+armnn::EdgeStrategy ToEdgeStrategy(armnnSerializer::EdgeStrategy edgeStrategy)
+{
+    switch (edgeStrategy)
+    {
+        case armnnSerializer::EdgeStrategy_DirectCompatibility:
+            return armnn::EdgeStrategy::DirectCompatibility;
+        case armnnSerializer::EdgeStrategy_ExportToTarget:
+            return armnn::EdgeStrategy::ExportToTarget;
+        case armnnSerializer::EdgeStrategy_CopyToTarget:
+            return armnn::EdgeStrategy::CopyToTarget;
+        case armnnSerializer::EdgeStrategy_Undefined:
+        default:
+            return armnn::EdgeStrategy::Undefined;
+    }
+}
+
+armnn::IOptimizedNetworkPtr Deserializer::CreateOptimizedNetworkFromGraph(GraphPtr graph)
+{
+    if (!graph->isOptimized())
+    {
+        throw ParseException(fmt::format("The network is not optimized, use CreateNetworkFromBinary {}",
+                                         CHECK_LOCATION().AsString()));
+    }
+
+    INetworkPtr network = CreateNetworkFromGraph(graph);
+
+    // Collect what the optimizer chose for each layer, to apply it to the optimized graph
+    std::unordered_map<armnn::LayerGuid, OptimizedLayerInfo> layerInfos;
+    for (auto&& layerIndex : m_LayerIndices)
+    {
+        LayerBaseRawPtr baseLayer = GetBaseLayer(graph, layerIndex.second);
+        OptimizedLayerInfo& layerInfo = layerInfos[layerIndex.first];
+
+        if (baseLayer->backendId())
+        {
+            layerInfo.m_BackendId = baseLayer->backendId()->str();
+        }
+
+        layerInfo.m_OutputSlotFactoryIds.resize(baseLayer->outputSlots()->size());
+        for (auto fbOutputSlot : *baseLayer->outputSlots())
+        {
+            if (fbOutputSlot->index() >= layerInfo.m_OutputSlotFactoryIds.size() ||
+                !fbOutputSlot->tensorHandleFactoryId())
+            {
+                throw ParseException(fmt::format("Invalid output slot for layer index: {0} {1}",
+                                                 layerIndex.second,
+                                                 CHECK_LOCATION().AsString()));
+            }
+            layerInfo.m_OutputSlotFactoryIds[fbOutputSlot->index()] = fbOutputSlot->tensorHandleFactoryId()->str();
+        }
+
+        layerInfo.m_InputSlotEdgeStrategies.resize(baseLayer->inputSlots()->size());
+        for (auto fbInputSlot : *baseLayer->inputSlots())
+        {
+            if (fbInputSlot->index() >= layerInfo.m_InputSlotEdgeStrategies.size())
+            {
+                throw ParseException(fmt::format("Invalid input slot for layer index: {0} {1}",
+                                                 layerIndex.second,
+                                                 CHECK_LOCATION().AsString()));
+            }
+            layerInfo.m_InputSlotEdgeStrategies[fbInputSlot->index()] = ToEdgeStrategy(fbInputSlot->edgeStrategy());
+        }
+
+        if (baseLayer->fusedActivation())
+        {
+            auto fusedActivation = std::make_shared<armnn::ActivationDescriptor>();
+            fusedActivation->m_Function = ToActivationFunction(baseLayer->fusedActivation()->activationFunction());
+            fusedActivation->m_A = baseLayer->fusedActivation()->a();
+            fusedActivation->m_B = baseLayer->fusedActivation()->b();
+            layerInfo.m_FusedActivation = fusedActivation;
+        }
+    }
+
+    return CreateOptimizedNetwork(*network, layerInfos);
+}
+
 BindingPointInfo Deserializer::GetNetworkInputBindingInfo(unsigned int layerIndex,
                                                           const std::string& name) const
 {
@@ -953,6 +1068,7 @@ void Deserializer::RegisterOutputSlots(GraphPtr graph,
     CHECK_LAYERS(graph, 0, layerIndex);
     ARMNN_ASSERT(layer != nullptr);
     LayerBaseRawPtr baseLayer = GetBaseLayer(graph, layerIndex);
+    m_LayerIndices[layer->GetGuid()] = layerIndex;
     if (baseLayer->outputSlots()->size() != layer->GetNumOutputSlots())
     {
         throw ParseException(fmt::format("The number of outputslots ({0}) does not match the number expected ({1})"
@@ -979,6 +1095,7 @@ void Deserializer::RegisterInputSlots(GraphPtr graph,
     CHECK_LAYERS(graph, 0, layerIndex);
     ARMNN_ASSERT(layer != nullptr);
     LayerBaseRawPtr baseLayer = GetBaseLayer(graph, layerIndex);
+    m_LayerIndices[layer->GetGuid()] = layerIndex;
     if (baseLayer->inputSlots()->size() != layer->GetNumInputSlots())
     {
         throw ParseException(fmt::format("The number of inputslots ({0}) does not match the number expected ({1})"
@@ -2345,6 +2462,54 @@ void Deserializer::ParseNormalization(GraphPtr graph, unsigned int layerIndex)
     RegisterOutputSlots(graph, layerIndex, layer);
 }
 
+void Deserializer::ParseOptimizerLayer(GraphPtr graph, unsigned int layerIndex)
+{
+    CHECK_LAYERS(graph, 0, layerIndex);
+    if (!graph->isOptimized())
+    {
+        ParseUnsupportedLayer(graph, layerIndex);
+    }
+
+    auto inputs = GetInputs(graph, layerIndex);
+    CHECK_VALID_SIZE(inputs.size(), 1);
+
+    auto outputs = GetOutputs(graph, layerIndex);
+    CHECK_VALID_SIZE(outputs.size(), 1);
+
+    armnn::LayerType layerType;
+    switch (graph->layers()->Get(layerIndex)->layer_type())
+    {
+        case Layer::Layer_MemCopyLayer:
+            layerType = armnn::LayerType::MemCopy;
+            break;
+        case Layer::Layer_MemImportLayer:
+            layerType = armnn::LayerType::MemImport;
+            break;
+        case Layer::Layer_ConvertFp16ToFp32Layer:
+            layerType = armnn::LayerType::ConvertFp16ToFp32;
+            break;
+        case Layer::Layer_ConvertFp32ToFp16Layer:
+            layerType = armnn::LayerType::ConvertFp32ToFp16;
+            break;
+        case Layer::Layer_ConvertBf16ToFp32Layer:
+            layerType = armnn::LayerType::ConvertBf16ToFp32;
+            break;
+        case Layer::Layer_ConvertFp32ToBf16Layer:
+            layerType = armnn::LayerType::ConvertFp32ToBf16;
+            break;
+        default:
+            ParseUnsupportedLayer(graph, layerIndex);
+            return;
+    }
+
+    auto layerName = GetLayerName(graph, layerIndex);
+    IConnectableLayer* layer = AddOptimizerLayer(*m_Network, layerType, layerName.c_str());
+    layer->GetOutputSlot(0).SetTensorInfo(ToTensorInfo(outputs[0]));
+
+    RegisterInputSlots(graph, layerIndex, layer);
+    RegisterOutputSlots(graph, layerIndex, layer);
+}
+
 void Deserializer::ParseRsqrt(GraphPtr graph, unsigned int layerIndex)
 {
     CHECK_LAYERS(graph, 0, layerIndex);
@@ -39,6 +39,12 @@ public:
     /// Create an input network from a binary input stream
     armnn::INetworkPtr CreateNetworkFromBinary(std::istream& binaryContent) override;
 
+    /// Create an optimized network from binary file contents
+    armnn::IOptimizedNetworkPtr CreateOptimizedNetworkFromBinary(const std::vector<uint8_t>& binaryContent) override;
+
+    /// Create an optimized network from a binary input stream
+    armnn::IOptimizedNetworkPtr CreateOptimizedNetworkFromBinary(std::istream& binaryContent) override;
+
     /// Retrieve binding info (layer id and tensor info) for the network input identified by the given layer name
     BindingPointInfo GetNetworkInputBindingInfo(unsigned int layerId, const std::string& name) const override;
 
@@ -75,6 +81,9 @@ private:
     /// Create the network from an already loaded flatbuffers graph
     armnn::INetworkPtr CreateNetworkFromGraph(GraphPtr graph);
 
+    /// Create the optimized network from an already loaded flatbuffers graph
+    armnn::IOptimizedNetworkPtr CreateOptimizedNetworkFromGraph(GraphPtr graph);
+
     // signature for the parser functions
     using LayerParsingFunction = void(Deserializer::*)(GraphPtr graph, unsigned int layerIndex);
 
@@ -111,6 +120,7 @@ private:
     void ParseMerge(GraphPtr graph, unsigned int layerIndex);
     void ParseMultiplication(GraphPtr graph, unsigned int layerIndex);
     void ParseNormalization(GraphPtr graph, unsigned int layerIndex);
+    void ParseOptimizerLayer(GraphPtr graph, unsigned int layerIndex);
     void ParseLstm(GraphPtr graph, unsigned int layerIndex);
     void ParseQuantizedLstm(GraphPtr graph, unsigned int layerIndex);
     void ParsePad(GraphPtr graph, unsigned int layerIndex);
@@ -186,6 +196,9 @@ private:
 
     /// Maps layer index (index property in flatbuffer object) to Connections for each layer
     std::unordered_map<unsigned int, Connections> m_GraphConnections;
+
+    /// Maps the guid of each layer added to m_Network to the index of its flatbuffer object in the layers vector
+    std::unordered_map<armnn::LayerGuid, unsigned int> m_LayerIndices;
 };
 
 } // namespace armnnDeserializer
@@ -0,0 +1,100 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "OptimizedNetworkUtils.hpp"
+
+#include <Graph.hpp>
+#include <Network.hpp>
+
+#include <armnn/Exceptions.hpp>
+#include <armnn/utility/NumericCast.hpp>
+#include <armnn/utility/PolymorphicDowncast.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+
+namespace armnnDeserializer
+{
+
+armnn::IConnectableLayer* AddOptimizerLayer(armnn::INetwork& network, armnn::LayerType type, const char* name)
+{
+    // The network is still being built by the deserializer, so its graph can be extended
+    const armnn::Graph& cGraph = armnn::PolymorphicDowncast<armnn::Network*>(&network)->GetGraph();
+    armnn::Graph& graph = const_cast<armnn::Graph&>(cGraph);
+
+    switch (type)
+    {
+        case armnn::LayerType::MemCopy:
+            return graph.AddLayer<armnn::MemCopyLayer>(name);
+        case armnn::LayerType::MemImport:
+            return graph.AddLayer<armnn::MemImportLayer>(name);
+        case armnn::LayerType::ConvertFp16ToFp32:
+            return graph.AddLayer<armnn::ConvertFp16ToFp32Layer>(name);
+        case armnn::LayerType::ConvertFp32ToFp16:
+            return graph.AddLayer<armnn::ConvertFp32ToFp16Layer>(name);
+        case armnn::LayerType::ConvertBf16ToFp32:
+            return graph.AddLayer<armnn::ConvertBf16ToFp32Layer>(name);
+        case armnn::LayerType::ConvertFp32ToBf16:
+            return graph.AddLayer<armnn::ConvertFp32ToBf16Layer>(name);
+        default:
+            throw armnn::InvalidArgumentException(fmt::format("Layers of type {} are not inserted by the optimizer",
+                                                              armnn::GetLayerTypeAsCString(type)));
+    }
+}
+
+armnn::IOptimizedNetworkPtr CreateOptimizedNetwork(
+    const armnn::INetwork& network,
+    const std::unordered_map<armnn::LayerGuid, OptimizedLayerInfo>& layerInfos)
+{
+    // Cloned layers keep their guid, so the infos still apply to the copy
+    const armnn::Graph& graph = armnn::PolymorphicDowncast<const armnn::Network*>(&network)->GetGraph();
+    std::unique_ptr<armnn::Graph> optimizedGraph = std::make_unique<armnn::Graph>(graph);
+
+    for (armnn::Layer* layer : *optimizedGraph)
+    {
+        auto layerInfo = layerInfos.find(layer->GetGuid());
+        if (layerInfo == layerInfos.end() || layerInfo->second.m_BackendId.Get().empty())
+        {
+            throw armnn::ParseException(fmt::format("No backend is assigned to layer {}", layer->GetName()));
+        }
+        const OptimizedLayerInfo& info = layerInfo->second;
+
+        if (info.m_OutputSlotFactoryIds.size() != layer->GetNumOutputSlots() ||
+            info.m_InputSlotEdgeStrategies.size() != layer->GetNumInputSlots())
+        {
+            throw armnn::ParseException(fmt::format("The slots of layer {} do not match its optimizer info",
+                                                    layer->GetName()));
+        }
+
+        layer->SetBackendId(info.m_BackendId);
+        if (info.m_FusedActivation)
+        {
+            layer->SetAdditionalInfoForObject(info.m_FusedActivation);
+        }
+
+        for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
+        {
+            layer->GetOutputSlot(i).SetTensorHandleFactory(info.m_OutputSlotFactoryIds[i]);
+        }
+
+        // The edge strategies are stored by the output slot, for each of its connections
+        for (unsigned int i = 0; i < layer->GetNumInputSlots(); ++i)
+        {
+            armnn::InputSlot& inputSlot = layer->GetInputSlot(i);
+            armnn::OutputSlot* connectedSlot = inputSlot.GetConnectedOutputSlot();
+            const std::vector<armnn::InputSlot*>& connections = connectedSlot->GetConnections();
+            auto connectionIndex = std::distance(connections.begin(),
+                                                 std::find(connections.begin(), connections.end(), &inputSlot));
+            connectedSlot->SetEdgeStrategy(armnn::numeric_cast<unsigned int>(connectionIndex),
+                                           info.m_InputSlotEdgeStrategies[i]);
+        }
+    }
+
+    return armnn::IOptimizedNetworkPtr(new armnn::OptimizedNetwork(std::move(optimizedGraph)),
+                                       &armnn::IOptimizedNetwork::Destroy);
+}
+
+} // namespace armnnDeserializer
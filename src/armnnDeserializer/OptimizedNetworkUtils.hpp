@@ -0,0 +1,50 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/BackendId.hpp>
+#include <armnn/Descriptors.hpp>
+#include <armnn/INetwork.hpp>
+#include <armnn/backends/ITensorHandleFactory.hpp>
+
+#include <InternalTypes.hpp>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Helpers to rebuild an optimized network, kept apart from Deserializer.cpp as the armnn graph classes clash with
+// the names generated from the schema.
+namespace armnnDeserializer
+{
+
+/// What the optimizer chose for a layer of a serialized optimized network.
+struct OptimizedLayerInfo
+{
+    armnn::BackendId m_BackendId;
+
+    /// Tensor handle factory of each output slot.
+    std::vector<armnn::ITensorHandleFactory::FactoryId> m_OutputSlotFactoryIds;
+
+    /// Edge strategy of the connection to each input slot.
+    std::vector<armnn::EdgeStrategy> m_InputSlotEdgeStrategies;
+
+    /// Activation the backend fused into the layer, if any.
+    std::shared_ptr<armnn::ActivationDescriptor> m_FusedActivation;
+};
+
+/// Adds one of the layers only the optimizer inserts (MemCopy, MemImport and the Fp16/Bf16 conversions), which
+/// INetwork has no function for.
+armnn::IConnectableLayer* AddOptimizerLayer(armnn::INetwork& network, armnn::LayerType type, const char* name);
+
+/// Creates an optimized network from a copy of the graph of network, applying the info of each layer, which is looked
+/// up by layer guid.
+armnn::IOptimizedNetworkPtr CreateOptimizedNetwork(
+    const armnn::INetwork& network,
+    const std::unordered_map<armnn::LayerGuid, OptimizedLayerInfo>& layerInfos);
+
+} // namespace armnnDeserializer
@@ -16,6 +16,11 @@
 
 #include <numeric>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 using namespace armnn;
 
 namespace armnnOnnxParser
@@ -355,6 +360,72 @@ TensorInfo ComputeReshapeInfo(const TensorShape& targetShapeTensor,
     return TensorInfo(outShape, DataType::Float32);
 }
 
+size_t ReadExternalDataSize(const std::string& tensorName, const onnx::StringStringEntryProto& entry)
+{
+    try
+    {
+        return armnn::numeric_cast<size_t>(std::stoull(entry.value()));
+    }
+    catch (const std::exception&)
+    {
+        throw ParseException(fmt::format("Invalid external data {} '{}' for tensor '{}' {}",
+                                         entry.key(),
+                                         entry.value(),
+                                         tensorName,
+                                         CHECK_LOCATION().AsString()));
+    }
+}
+
+std::string GetDirectory(const char* fileName)
+{
+    const std::string path = fileName != nullptr ? fileName : "";
+    const size_t separator = path.find_last_of("/\\");
+    return separator == std::string::npos ? std::string() : path.substr(0, separator);
+}
+
+/// Maps a whole file read-only. The memory is unmapped when the last copy of the returned pointer is released.
+std::shared_ptr<const char> MapFile(const std::string& path, size_t& size)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw FileNotFoundException(fmt::format("Cannot open external data file '{}' {}",
+                                                path,
+                                                CHECK_LOCATION().AsString()));
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0)
+    {
+        close(fd);
+        throw ParseException(fmt::format("Cannot read the size of external data file '{}' {}",
+                                         path,
+                                         CHECK_LOCATION().AsString()));
+    }
+    size = static_cast<size_t>(fileStat.st_size);
+    if (size == 0)
+    {
+        close(fd);
+        return std::shared_ptr<const char>(nullptr);
+    }
+
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        throw ParseException(fmt::format("Cannot map external data file '{}' {}",
+                                         path,
+                                         CHECK_LOCATION().AsString()));
+    }
+
+    const size_t mappedSize = size;
+    return std::shared_ptr<const char>(static_cast<const char*>(mapping),
+                                       [mappedSize](const char* data)
+                                       {
+                                           munmap(const_cast<char*>(data), mappedSize);
+                                       });
+}
+
 } //namespace
 
 const std::map<std::string, OnnxParser::OperationParsingFunction> OnnxParser::m_ParserFunctions = {
@@ -451,6 +522,7 @@ void OnnxParser::ResetParser()
 {
     m_Network = armnn::INetworkPtr(nullptr, nullptr);
     m_Graph = nullptr;
+    m_ModelDirectory.clear();
 }
 
 void OnnxParser::Cleanup()
@@ -459,18 +531,26 @@ void OnnxParser::Cleanup()
     m_TensorsInfo.clear();
     m_OutputsMap.clear();
     m_OutputsFusedAndUsed.clear();
+    m_ExternalDataFiles.clear();
 }
 
-std::pair<ConstTensor, std::unique_ptr<float[]>> OnnxParser::CreateConstTensor(const std::string name)
+ConstTensor OnnxParser::CreateConstTensor(const std::string& name)
 {
-    const TensorInfo tensorInfo = *m_TensorsInfo[name].m_info;
-    onnx::TensorProto onnxTensor = *m_TensorsInfo[name].m_tensor;
+    OnnxTensor& tensor = m_TensorsInfo[name];
+    const TensorInfo& tensorInfo = *tensor.m_info;
+    if (tensor.m_constData != nullptr)
+    {
+        return ConstTensor(tensorInfo, tensor.m_constData);
+    }
 
-    auto srcData = onnxTensor.float_data().data();
-    std::unique_ptr<float[]> tensorData(new float[tensorInfo.GetNumElements()]);
+    const onnx::TensorProto& onnxTensor = *tensor.m_tensor;
     const size_t tensorSizeInBytes = tensorInfo.GetNumBytes();
-    // Copy the value list entries into the destination
-    if (!onnxTensor.has_raw_data())
+    const void* srcData = nullptr;
+    if (onnxTensor.data_location() == onnx::TensorProto::EXTERNAL)
+    {
+        srcData = GetExternalData(name, onnxTensor, tensorSizeInBytes);
+    }
+    else if (!onnxTensor.has_raw_data())
     {
         if(tensorInfo.GetNumElements() != static_cast<uint>(onnxTensor.float_data_size()))
         {
@@ -482,11 +562,20 @@ std::pair<ConstTensor, std::unique_ptr<float[]>> OnnxParser::CreateConstTensor(c
                             tensorInfo.GetNumElements(),
                             CHECK_LOCATION().AsString()));
         }
-        ::memcpy(tensorData.get(), srcData, tensorSizeInBytes);
+        srcData = onnxTensor.float_data().data();
     }
     else
     {
-        ::memcpy(tensorData.get(), onnxTensor.raw_data().c_str(), tensorSizeInBytes);
+        if (onnxTensor.raw_data().size() < tensorSizeInBytes)
+        {
+            throw ParseException(
+                fmt::format("The raw data provided ({} bytes) is too small for the tensor '{}' ({} bytes) {}",
+                            onnxTensor.raw_data().size(),
+                            name,
+                            tensorSizeInBytes,
+                            CHECK_LOCATION().AsString()));
+        }
+        srcData = onnxTensor.raw_data().data();
     }
 
     // Const tensors requires at least a list of values
@@ -496,7 +585,84 @@ std::pair<ConstTensor, std::unique_ptr<float[]>> OnnxParser::CreateConstTensor(c
                                          name,
                                          CHECK_LOCATION().AsString()));
     }
-    return std::make_pair(ConstTensor(tensorInfo, tensorData.get()), std::move(tensorData));
+
+    // The values stay in the TensorProto or the mapped file until Cleanup, so they only need copying when they
+    // are not aligned for float accesses
+    if (reinterpret_cast<uintptr_t>(srcData) % alignof(float) == 0)
+    {
+        tensor.m_constData = static_cast<const float*>(srcData);
+    }
+    else
+    {
+        tensor.m_data.reset(new float[tensorInfo.GetNumElements()]);
+        ::memcpy(tensor.m_data.get(), srcData, tensorSizeInBytes);
+        tensor.m_constData = tensor.m_data.get();
+    }
+    return ConstTensor(tensorInfo, tensor.m_constData);
+}
+
+const char* OnnxParser::GetExternalData(const std::string& name,
+                                        const onnx::TensorProto& onnxTensor,
+                                        size_t numBytes)
+{
+    std::string location;
+    size_t offset = 0;
+    size_t length = numBytes;
+    for (const onnx::StringStringEntryProto& entry : onnxTensor.external_data())
+    {
+        if (entry.key() == "location")
+        {
+            location = entry.value();
+        }
+        else if (entry.key() == "offset")
+        {
+            offset = ReadExternalDataSize(name, entry);
+        }
+        else if (entry.key() == "length")
+        {
+            length = ReadExternalDataSize(name, entry);
+        }
+    }
+
+    if (location.empty())
+    {
+        throw ParseException(fmt::format("No location given for the external data of tensor '{}' {}",
+                                         name,
+                                         CHECK_LOCATION().AsString()));
+    }
+    if (length != numBytes)
+    {
+        throw ParseException(fmt::format("The external data of tensor '{}' has {} bytes, {} were expected {}",
+                                         name,
+                                         length,
+                                         numBytes,
+                                         CHECK_LOCATION().AsString()));
+    }
+
+    auto fileIt = m_ExternalDataFiles.find(location);
+    if (fileIt == m_ExternalDataFiles.end())
+    {
+        const bool isAbsolute = location[0] == '/' || location[0] == '\\';
+        const std::string path = (isAbsolute || m_ModelDirectory.empty()) ? location
+                                                                          : m_ModelDirectory + "/" + location;
+        ExternalDataFile file;
+        file.m_data = MapFile(path, file.m_size);
+        fileIt = m_ExternalDataFiles.emplace(location, std::move(file)).first;
+    }
+
+    const ExternalDataFile& file = fileIt->second;
+    if (offset > file.m_size || file.m_size - offset < length)
+    {
+        throw ParseException(fmt::format("The external data of tensor '{}' (offset {}, {} bytes) is outside of "
+                                         "'{}' ({} bytes) {}",
+                                         name,
+                                         offset,
+                                         length,
+                                         location,
+                                         file.m_size,
+                                         CHECK_LOCATION().AsString()));
+    }
+    return file.m_data.get() + offset;
 }
 
 ModelPtr OnnxParser::LoadModelFromTextFile(const char* graphFile)
@@ -527,6 +693,7 @@ ModelPtr OnnxParser::LoadModelFromTextFile(const char* graphFile)
 INetworkPtr OnnxParser::CreateNetworkFromTextFile(const char* graphFile)
 {
     ResetParser();
+    m_ModelDirectory = GetDirectory(graphFile);
     ModelPtr modelProto = LoadModelFromTextFile(graphFile);
     return CreateNetworkFromModel(*modelProto);
 }
@@ -563,6 +730,7 @@ ModelPtr OnnxParser::LoadModelFromBinaryFile(const char* graphFile)
 INetworkPtr OnnxParser::CreateNetworkFromBinaryFile(const char* graphFile)
 {
     ResetParser();
+    m_ModelDirectory = GetDirectory(graphFile);
     ModelPtr modelProto = LoadModelFromBinaryFile(graphFile);
     return CreateNetworkFromModel(*modelProto);
 }
@@ -598,7 +766,9 @@ INetworkPtr OnnxParser::CreateNetworkFromModel(onnx::ModelProto& model)
     m_Network = INetwork::Create();
     try
     {
-        m_Graph = std::make_unique<onnx::GraphProto>(*model.mutable_graph());
+        // Take the graph over rather than copying it, so the initializers are only held in memory once
+        m_Graph = std::make_unique<onnx::GraphProto>();
+        m_Graph->Swap(model.mutable_graph());
         LoadGraph();
     }
     catch (const ParseException& e)
@@ -619,9 +789,9 @@ void OnnxParser::LoadGraph()
     SetupInfo(m_Graph->mutable_input());
     SetupInfo(m_Graph->mutable_value_info());
 
-    for (auto tensor : m_Graph->initializer())
+    for (const onnx::TensorProto& tensor : m_Graph->initializer())
     {
-        m_TensorsInfo[tensor.name()].m_tensor = std::make_unique<const onnx::TensorProto>(tensor);
+        m_TensorsInfo[tensor.name()].m_tensor = &tensor;
         m_TensorsInfo[tensor.name()].m_info = std::make_unique<TensorInfo>(ToTensorInfo(tensor));
         m_TensorsInfo[tensor.name()].m_dtype =
             static_cast<onnx::TensorProto::DataType>(tensor.data_type());
@@ -636,7 +806,7 @@ void OnnxParser::LoadGraph()
     //Parsing the graph
     for(size_t nodeIndex = 0; nodeIndex < static_cast<size_t>(m_Graph->node_size()); nodeIndex++)
     {
-        auto node = m_Graph->node(static_cast<int>(nodeIndex));
+        const onnx::NodeProto& node = m_Graph->node(static_cast<int>(nodeIndex));
         const std::string& operation = node.op_type();
 
         // check which layers we handled already (add and matmul fused as FC)
@@ -820,7 +990,7 @@ void OnnxParser::AddConvLayerWithDepthwiseConv(const onnx::NodeProto& node, cons
 
     armnn::IConnectableLayer* layer;
     auto weightTensor = CreateConstTensor(node.input(1));
-    TensorShape& weightShape = weightTensor.first.GetShape();
+    TensorShape& weightShape = weightTensor.GetShape();
     weightShape[1] = weightShape[0];
     weightShape[0] = 1;
     m_TensorsInfo[node.input(1)].m_info->SetShape(weightShape);
@@ -837,14 +1007,14 @@ void OnnxParser::AddConvLayerWithDepthwiseConv(const onnx::NodeProto& node, cons
         desc.m_BiasEnabled = true;
         auto biasTensor = CreateConstTensor(node.input(2));
         layer = m_Network->AddDepthwiseConvolution2dLayer(desc,
-                                                          weightTensor.first,
-                                                          Optional<ConstTensor>(biasTensor.first),
+                                                          weightTensor,
+                                                          Optional<ConstTensor>(biasTensor),
                                                           node.name().c_str());
     }
     else
     {
         layer = m_Network->AddDepthwiseConvolution2dLayer(desc,
-                                                          weightTensor.first,
+                                                          weightTensor,
                                                           EmptyOptional(),
                                                           node.name().c_str());
     }
@@ -909,8 +1079,8 @@ void OnnxParser::AddFullyConnected(const onnx::NodeProto& matmulNode, const onnx
                             CHECK_LOCATION().AsString()));
         }
         layer = m_Network->AddFullyConnectedLayer(desc,
-                                                  CreateConstTensor(weightName).first,
-                                                  Optional<ConstTensor>(CreateConstTensor(biasName).first),
+                                                  CreateConstTensor(weightName),
+                                                  Optional<ConstTensor>(CreateConstTensor(biasName)),
                                                   matmulNode.name().c_str());
         ARMNN_ASSERT(layer != nullptr);
 
@@ -926,7 +1096,7 @@ void OnnxParser::AddFullyConnected(const onnx::NodeProto& matmulNode, const onnx
     else
     {
         layer = m_Network->AddFullyConnectedLayer(desc,
-                                                  CreateConstTensor(weightName).first,
+                                                  CreateConstTensor(weightName),
                                                   EmptyOptional(),
                                                   matmulNode.name().c_str());
         ARMNN_ASSERT(layer != nullptr);
@@ -1048,8 +1218,8 @@ void OnnxParser::CreateConstantLayer(const std::string& tensorName, const std::s
 {
     auto armnnTensor = CreateConstTensor(tensorName);
 
-    IConnectableLayer* layer = m_Network->AddConstantLayer(armnnTensor.first, layerName.c_str());
-    layer->GetOutputSlot(0).SetTensorInfo(armnnTensor.first.GetInfo());
+    IConnectableLayer* layer = m_Network->AddConstantLayer(armnnTensor, layerName.c_str());
+    layer->GetOutputSlot(0).SetTensorInfo(armnnTensor.GetInfo());
     RegisterOutputSlots(layer, {tensorName});
 }
 
@@ -1230,10 +1400,10 @@ void OnnxParser::ParseBatchNormalization(const onnx::NodeProto& node)
     auto varTensor = CreateConstTensor(node.input(4));
 
     IConnectableLayer* layer = m_Network->AddBatchNormalizationLayer(desc,
-                                                                     meanTensor.first,
-                                                                     varTensor.first,
-                                                                     biasTensor.first,
-                                                                     scaleTensor.first,
+                                                                     meanTensor,
+                                                                     varTensor,
+                                                                     biasTensor,
+                                                                     scaleTensor,
                                                                      node.name().c_str());
     ARMNN_ASSERT(layer != nullptr);
 
@@ -1262,7 +1432,7 @@ void OnnxParser::ParseConstant(const onnx::NodeProto& node)
                          static_cast<onnx::TensorProto::DataType>(onnxTensor.data_type()), onnx::TensorProto::FLOAT);
 
     //Register this as a m_ConstParam so we know we can use it as a constant param in future layers.
-    m_TensorsInfo[node.output(0)].m_tensor = std::make_unique<const onnx::TensorProto>(onnxTensor);
+    m_TensorsInfo[node.output(0)].m_tensor = &onnxTensor;
     m_TensorsInfo[node.output(0)].m_info = std::make_unique<TensorInfo>(ToTensorInfo(onnxTensor));
     m_TensorsInfo[node.output(0)].m_dtype = static_cast<onnx::TensorProto::DataType>(onnxTensor.data_type());
 
@@ -1436,14 +1606,14 @@ void OnnxParser::ParseConv(const onnx::NodeProto& node)
         desc.m_BiasEnabled = true;
         auto biasTensor = CreateConstTensor(node.input(2));
         layer = m_Network->AddConvolution2dLayer(desc,
-                                                 weightTensor.first,
-                                                 Optional<ConstTensor>(biasTensor.first),
+                                                 weightTensor,
+                                                 Optional<ConstTensor>(biasTensor),
                                                  node.name().c_str());
     }
     else
     {
         layer = m_Network->AddConvolution2dLayer(desc,
-                                                 weightTensor.first,
+                                                 weightTensor,
                                                  EmptyOptional(),
                                                  node.name().c_str());
     }
@@ -1568,8 +1738,7 @@ void OnnxParser::ParseReshape(const onnx::NodeProto& node)
         {
             m_TensorsInfo[node.output(0)] = OnnxTensor();
         }
-        m_TensorsInfo[node.output(0)].m_tensor =
-            std::make_unique<onnx::TensorProto>(*m_TensorsInfo[node.input(0)].m_tensor);
+        m_TensorsInfo[node.output(0)].m_tensor = m_TensorsInfo[node.input(0)].m_tensor;
     }
     else
     {
@@ -1628,7 +1797,7 @@ void OnnxParser::PrependForBroadcast(const std::string& outputName,
     }
     else //make it constant and it will be create in Add
     {
-        m_TensorsInfo[outputName].m_tensor = std::make_unique<onnx::TensorProto>(*m_TensorsInfo[input0].m_tensor);
+        m_TensorsInfo[outputName].m_tensor = m_TensorsInfo[input0].m_tensor;
 
     }
 }
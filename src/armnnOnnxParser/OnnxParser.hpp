@@ -124,7 +124,12 @@ private:
     void ResetParser();
     void Cleanup();
 
-    std::pair<armnn::ConstTensor, std::unique_ptr<float[]>> CreateConstTensor(const std::string name);
+    /// Returns the values of a constant tensor. They are converted on the first call for each tensor and the
+    /// memory is reused by later calls, until Cleanup.
+    armnn::ConstTensor CreateConstTensor(const std::string& name);
+
+    /// Returns the values of an initializer stored in an external data file, which is mapped into memory
+    const char* GetExternalData(const std::string& name, const onnx::TensorProto& onnxTensor, size_t numBytes);
 
     template <typename TypeList, typename Location>
     void ValidateInputs(const onnx::NodeProto& node,
@@ -137,14 +142,24 @@ private:
     /// Ptr to the graph we're building the network from
     GraphPtr m_Graph;
 
+    /// Directory of the model file, external data locations are relative to it. Empty for models parsed from a
+    /// string, whose external data locations are relative to the working directory.
+    std::string m_ModelDirectory;
+
     /// Map of the information for every tensor
     struct OnnxTensor
     {
         std::unique_ptr<armnn::TensorInfo>          m_info;
-        std::unique_ptr<const onnx::TensorProto>    m_tensor;
+        /// Points into m_Graph, which outlives the tensor infos
+        const onnx::TensorProto*                    m_tensor;
         onnx::TensorProto::DataType                 m_dtype;
+        /// Values of a constant tensor once CreateConstTensor has been called for it. They are used in place
+        /// from the TensorProto or the external data file when possible, otherwise they are copied into m_data.
+        const float*                                m_constData;
+        std::unique_ptr<float[]>                    m_data;
 
-        OnnxTensor() : m_info(nullptr), m_tensor(nullptr), m_dtype(onnx::TensorProto::FLOAT) { }
+        OnnxTensor()
+            : m_info(nullptr), m_tensor(nullptr), m_dtype(onnx::TensorProto::FLOAT), m_constData(nullptr) { }
         bool isConstant() { return m_tensor != nullptr; }
     };
 
@@ -182,5 +197,16 @@ private:
 
     std::vector<UsageSummary> m_OutputsFusedAndUsed;
 
+    /// External data files mapped while parsing, by location. They are unmapped by Cleanup, once the constant
+    /// layers have copied the values they use.
+    struct ExternalDataFile
+    {
+        std::shared_ptr<const char> m_data;
+        size_t                      m_size;
+
+        ExternalDataFile() : m_data(nullptr), m_size(0) { }
+    };
+    std::unordered_map<std::string, ExternalDataFile> m_ExternalDataFiles;
+
 };
 }
@@ -7,6 +7,10 @@
 #include "armnnOnnxParser/IOnnxParser.hpp"
 #include  "ParserPrototxtFixture.hpp"
 
+#include <Filesystem.hpp>
+
+#include <fstream>
+
 BOOST_AUTO_TEST_SUITE(OnnxParser)
 
 struct ConstMainFixture : public armnnUtils::ParserPrototxtFixture<armnnOnnxParser::IOnnxParser>
@@ -74,6 +78,93 @@ struct ConstInvalidFixture : ConstMainFixture
     ConstInvalidFixture() : ConstMainFixture("10") { }
 };
 
+struct ConstExternalDataFixture : public armnnUtils::ParserPrototxtFixture<armnnOnnxParser::IOnnxParser>
+{
+    ConstExternalDataFixture(const std::string& length)
+        : m_DataFile(armnnUtils::Filesystem::NamedTempFile("Armnn-OnnxParser-ExternalData-TempFile.bin"))
+    {
+        // The values follow a 4 byte header, so the offset has to be applied and they are not read in place
+        const uint32_t header = 0;
+        const std::vector<float> values = { 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f };
+        std::ofstream file(m_DataFile.string(), std::ios::binary);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(values.data()),
+                   static_cast<std::streamsize>(values.size() * sizeof(float)));
+        file.close();
+
+        m_Prototext = R"(
+                   ir_version: 3
+                   producer_name:  "CNTK "
+                   producer_version:  "2.5.1 "
+                   domain:  "ai.cntk "
+                   model_version: 1
+                   graph {
+                     name:  "CNTKGraph "
+                     node {
+                        output:  "Output"
+                        attribute {
+                          name: "value"
+                          t {
+                              dims: 7
+                              data_type: 1
+                              data_location: EXTERNAL
+                              external_data {
+                                key: "location"
+                                value: ")" + m_DataFile.string() + R"("
+                              }
+                              external_data {
+                                key: "offset"
+                                value: "4"
+                              }
+                              external_data {
+                                key: "length"
+                                value: ")" + length + R"("
+                              }
+                          }
+                          type: 1
+                        }
+                        name:  "constantNode"
+                        op_type:  "Constant"
+                      }
+                      output {
+                          name:  "Output"
+                          type {
+                             tensor_type {
+                               elem_type: 1
+                               shape {
+                                 dim {
+                                    dim_value: 7
+                                 }
+                               }
+                             }
+                          }
+                      }
+                   }
+                   opset_import {
+                      version: 7
+                    })";
+    }
+
+    ~ConstExternalDataFixture()
+    {
+        fs::remove(m_DataFile);
+    }
+
+    fs::path m_DataFile;
+};
+
+struct ConstValidExternalDataFixture : ConstExternalDataFixture
+{
+    ConstValidExternalDataFixture() : ConstExternalDataFixture("28") {
+        Setup();
+    }
+};
+
+struct ConstInvalidExternalDataFixture : ConstExternalDataFixture
+{
+    ConstInvalidExternalDataFixture() : ConstExternalDataFixture("32") { }
+};
+
 BOOST_FIXTURE_TEST_CASE(ValidConstTest, ConstValidFixture)
 {
     RunTest<1>({ }, {{ "Output" , {0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0}}});
@@ -84,4 +175,14 @@ BOOST_FIXTURE_TEST_CASE(IncorrectDataTypeConst, ConstInvalidFixture)
    BOOST_CHECK_THROW( Setup(), armnn::ParseException);
 }
 
+BOOST_FIXTURE_TEST_CASE(ValidConstExternalDataTest, ConstValidExternalDataFixture)
+{
+    RunTest<1>({ }, {{ "Output" , {0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0}}});
+}
+
+BOOST_FIXTURE_TEST_CASE(IncorrectLengthConstExternalData, ConstInvalidExternalDataFixture)
+{
+   BOOST_CHECK_THROW( Setup(), armnn::ParseException);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -13,6 +13,7 @@
 #include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <vector>
 
 int main(int argc, char* argv[])
 {
@@ -64,21 +65,39 @@ int main(int argc, char* argv[])
             armnnQuantizer::InputLayerVisitor inputLayerVisitor;
             network->Accept(inputLayerVisitor);
 
+            // Calibrate a batch of entries at a time, spread over all the hardware threads,
+            // keeping only one batch of input data in memory
+            constexpr size_t batchSize = 64;
+            std::vector<armnn::InputTensors> inputTensorsBatch;
+            std::vector<std::vector<float>> inputData;
+            inputTensorsBatch.reserve(batchSize);
+
+            auto refineBatch = [&]()
+            {
+                quantizer->RefineBatch(inputTensorsBatch);
+                inputTensorsBatch.clear();
+                inputData.clear();
+            };
+
             for (armnnQuantizer::QuantizationInput quantizationInput : dataSet)
             {
                 armnn::InputTensors inputTensors;
-                std::vector<std::vector<float>> inputData(quantizationInput.GetNumberOfInputs());
-                std::vector<armnn::LayerBindingId> layerBindingIds = quantizationInput.GetLayerBindingIds();
-                unsigned int count = 0;
                 for (armnn::LayerBindingId layerBindingId : quantizationInput.GetLayerBindingIds())
                 {
                     armnn::TensorInfo tensorInfo = inputLayerVisitor.GetTensorInfo(layerBindingId);
-                    inputData[count] = quantizationInput.GetDataForEntry(layerBindingId);
-                    armnn::ConstTensor inputTensor(tensorInfo, inputData[count].data());
+                    inputData.push_back(quantizationInput.GetDataForEntry(layerBindingId));
+                    armnn::ConstTensor inputTensor(tensorInfo, inputData.back().data());
                     inputTensors.push_back(std::make_pair(layerBindingId, inputTensor));
-                    count++;
                 }
-                quantizer->Refine(inputTensors);
+                inputTensorsBatch.push_back(inputTensors);
+                if (inputTensorsBatch.size() == batchSize)
+                {
+                    refineBatch();
+                }
+            }
+            if (!inputTensorsBatch.empty())
+            {
+                refineBatch();
             }
         }
     }
@@ -4,15 +4,22 @@
 //
 #include "Serializer.hpp"
 
+#include <Graph.hpp>
+#include <Layer.hpp>
+#include <Network.hpp>
+
 #include <armnn/Descriptors.hpp>
 #include <armnn/LstmParams.hpp>
 #include <armnn/QuantizedLstmParams.hpp>
 #include <armnn/utility/IgnoreUnused.hpp>
 #include <armnn/utility/NumericCast.hpp>
+#include <armnn/utility/PolymorphicDowncast.hpp>
 
+#include <algorithm>
 #include <iostream>
 
 #include <flatbuffers/util.h>
+#include <fmt/format.h>
 
 #include "SerializerUtils.hpp"
 
@@ -1565,12 +1572,109 @@ fb::Offset<serializer::LayerBase> SerializerVisitor::CreateLayerBase(const IConn
     std::vector<fb::Offset<serializer::InputSlot>> inputSlots = CreateInputSlots(layer);
     std::vector<fb::Offset<serializer::OutputSlot>> outputSlots = CreateOutputSlots(layer);
 
+    // The backend assignment, and any activation the backend fused into the layer, only exist in optimized graphs
+    fb::Offset<fb::String> fbBackendId;
+    fb::Offset<serializer::ActivationDescriptor> fbFusedActivation;
+    if (m_isOptimizedGraph)
+    {
+        const armnn::Layer* optimizedLayer = PolymorphicDowncast<const armnn::Layer*>(layer);
+        fbBackendId = m_flatBufferBuilder.CreateString(optimizedLayer->GetBackendId().Get());
+
+        auto fusedActivation = optimizedLayer->GetAdditionalInformation<armnn::ActivationDescriptor>();
+        if (fusedActivation)
+        {
+            fbFusedActivation = CreateActivationDescriptor(m_flatBufferBuilder,
+                                                           GetFlatBufferActivationFunction(fusedActivation->m_Function),
+                                                           fusedActivation->m_A,
+                                                           fusedActivation->m_B);
+        }
+    }
+
     return serializer::CreateLayerBase(m_flatBufferBuilder,
                                        fbIndex,
                                        m_flatBufferBuilder.CreateString(layer->GetName()),
                                        layerType,
                                        m_flatBufferBuilder.CreateVector(inputSlots),
-                                       m_flatBufferBuilder.CreateVector(outputSlots));
+                                       m_flatBufferBuilder.CreateVector(outputSlots),
+                                       fbBackendId,
+                                       fbFusedActivation);
+}
+
+void SerializerVisitor::VisitOptimizedGraph(const armnn::Graph& graph)
+{
+    m_isOptimizedGraph = true;
+
+    for (const armnn::Layer* layer : graph.TopologicalSort())
+    {
+        switch (layer->GetType())
+        {
+            case armnn::LayerType::MemCopy:
+            case armnn::LayerType::MemImport:
+            case armnn::LayerType::ConvertFp16ToFp32:
+            case armnn::LayerType::ConvertFp32ToFp16:
+            case armnn::LayerType::ConvertBf16ToFp32:
+            case armnn::LayerType::ConvertFp32ToBf16:
+                SerializeOptimizerLayer(*layer);
+                break;
+            default:
+                // Throws for the layers that cannot be serialized, such as PreCompiled layers
+                layer->Accept(*this);
+                break;
+        }
+    }
+}
+
+void SerializerVisitor::SerializeOptimizerLayer(const armnn::Layer& layer)
+{
+    switch (layer.GetType())
+    {
+        case armnn::LayerType::MemCopy:
+        {
+            auto fbBaseLayer = CreateLayerBase(&layer, serializer::LayerType::LayerType_MemCopy);
+            auto fbLayer = serializer::CreateMemCopyLayer(m_flatBufferBuilder, fbBaseLayer);
+            CreateAnyLayer(fbLayer.o, serializer::Layer::Layer_MemCopyLayer);
+            break;
+        }
+        case armnn::LayerType::MemImport:
+        {
+            auto fbBaseLayer = CreateLayerBase(&layer, serializer::LayerType::LayerType_MemImport);
+            auto fbLayer = serializer::CreateMemImportLayer(m_flatBufferBuilder, fbBaseLayer);
+            CreateAnyLayer(fbLayer.o, serializer::Layer::Layer_MemImportLayer);
+            break;
+        }
+        case armnn::LayerType::ConvertFp16ToFp32:
+        {
+            auto fbBaseLayer = CreateLayerBase(&layer, serializer::LayerType::LayerType_ConvertFp16ToFp32);
+            auto fbLayer = serializer::CreateConvertFp16ToFp32Layer(m_flatBufferBuilder, fbBaseLayer);
+            CreateAnyLayer(fbLayer.o, serializer::Layer::Layer_ConvertFp16ToFp32Layer);
+            break;
+        }
+        case armnn::LayerType::ConvertFp32ToFp16:
+        {
+            auto fbBaseLayer = CreateLayerBase(&layer, serializer::LayerType::LayerType_ConvertFp32ToFp16);
+            auto fbLayer = serializer::CreateConvertFp32ToFp16Layer(m_flatBufferBuilder, fbBaseLayer);
+            CreateAnyLayer(fbLayer.o, serializer::Layer::Layer_ConvertFp32ToFp16Layer);
+            break;
+        }
+        case armnn::LayerType::ConvertBf16ToFp32:
+        {
+            auto fbBaseLayer = CreateLayerBase(&layer, serializer::LayerType::LayerType_ConvertBf16ToFp32);
+            auto fbLayer = serializer::CreateConvertBf16ToFp32Layer(m_flatBufferBuilder, fbBaseLayer);
+            CreateAnyLayer(fbLayer.o, serializer::Layer::Layer_ConvertBf16ToFp32Layer);
+            break;
+        }
+        case armnn::LayerType::ConvertFp32ToBf16:
+        {
+            auto fbBaseLayer = CreateLayerBase(&layer, serializer::LayerType::LayerType_ConvertFp32ToBf16);
+            auto fbLayer = serializer::CreateConvertFp32ToBf16Layer(m_flatBufferBuilder, fbBaseLayer);
+            CreateAnyLayer(fbLayer.o, serializer::Layer::Layer_ConvertFp32ToBf16Layer);
+            break;
+        }
+        default:
+            throw armnn::InvalidArgumentException(fmt::format("Layer {} of type {} is not inserted by the optimizer",
+                                                              layer.GetName(),
+                                                              armnn::GetLayerTypeAsCString(layer.GetType())));
+    }
 }
 
 void SerializerVisitor::CreateAnyLayer(const flatbuffers::Offset<void>& layer, const serializer::Layer serializerLayer)
@@ -1704,8 +1808,22 @@ std::vector<fb::Offset<serializer::InputSlot>>
         // Create FlatBuffer Connection
         serializer::Connection conn(GetSerializedId(inputSlot.GetConnection()->GetOwningLayerGuid()),
                                     connection->CalculateIndexOnOwner());
+
+        // The edge strategy is stored by the output slot, for each of its connections
+        serializer::EdgeStrategy edgeStrategy = serializer::EdgeStrategy::EdgeStrategy_Undefined;
+        if (m_isOptimizedGraph)
+        {
+            const auto* optimizedInputSlot = PolymorphicDowncast<const armnn::InputSlot*>(&inputSlot);
+            const armnn::OutputSlot* optimizedConnection = optimizedInputSlot->GetConnectedOutputSlot();
+            const std::vector<armnn::InputSlot*>& connections = optimizedConnection->GetConnections();
+            auto connectionIndex = std::distance(connections.begin(),
+                                                 std::find(connections.begin(), connections.end(), optimizedInputSlot));
+            edgeStrategy = GetFlatBufferEdgeStrategy(
+                optimizedConnection->GetEdgeStrategyForConnection(armnn::numeric_cast<unsigned int>(connectionIndex)));
+        }
+
         // Create FlatBuffer InputSlot
-        inputSlots.push_back(serializer::CreateInputSlot(m_flatBufferBuilder, slotIndex, &conn));
+        inputSlots.push_back(serializer::CreateInputSlot(m_flatBufferBuilder, slotIndex, &conn, edgeStrategy));
     }
     return inputSlots;
 }
@@ -1721,10 +1839,18 @@ std::vector<fb::Offset<serializer::OutputSlot>>
         const IOutputSlot& outputSlot = layer->GetOutputSlot(slotIndex);
         const armnn::TensorInfo& tensorInfo = outputSlot.GetTensorInfo();
 
+        fb::Offset<fb::String> fbTensorHandleFactoryId;
+        if (m_isOptimizedGraph)
+        {
+            fbTensorHandleFactoryId = m_flatBufferBuilder.CreateString(
+                PolymorphicDowncast<const armnn::OutputSlot*>(&outputSlot)->GetTensorHandleFactoryId());
+        }
+
         // Create FlatBuffer Outputslot
         outputSlots.push_back(serializer::CreateOutputSlot(m_flatBufferBuilder,
                                                            slotIndex,
-                                                           CreateTensorInfo(tensorInfo)));
+                                                           CreateTensorInfo(tensorInfo),
+                                                           fbTensorHandleFactoryId));
     }
     return outputSlots;
 }
@@ -1763,6 +1889,25 @@ void Serializer::Serialize(const INetwork& inNetwork)
     fbBuilder.Finish(serializedGraph);
 }
 
+void Serializer::Serialize(const IOptimizedNetwork& inNetwork)
+{
+    // Iterate through the optimized graph
+    m_SerializerVisitor.VisitOptimizedGraph(PolymorphicDowncast<const OptimizedNetwork*>(&inNetwork)->GetGraph());
+    flatbuffers::FlatBufferBuilder& fbBuilder = m_SerializerVisitor.GetFlatBufferBuilder();
+
+    // Create FlatBuffer SerializedGraph
+    auto serializedGraph = serializer::CreateSerializedGraph(
+        fbBuilder,
+        fbBuilder.CreateVector(m_SerializerVisitor.GetSerializedLayers()),
+        fbBuilder.CreateVector(m_SerializerVisitor.GetInputIds()),
+        fbBuilder.CreateVector(m_SerializerVisitor.GetOutputIds()),
+        m_SerializerVisitor.GetVersionTable(),
+        m_SerializerVisitor.IsOptimizedGraph());
+
+    // Serialize the graph
+    fbBuilder.Finish(serializedGraph);
+}
+
 bool Serializer::SaveSerializedToStream(std::ostream& stream)
 {
     flatbuffers::FlatBufferBuilder& fbBuilder = m_SerializerVisitor.GetFlatBufferBuilder();
@@ -15,13 +15,19 @@
 
 #include <armnn/Types.hpp>
 
+namespace armnn
+{
+class Graph;
+class Layer;
+}
+
 namespace armnnSerializer
 {
 
 class SerializerVisitor : public armnn::ILayerVisitor
 {
 public:
-    SerializerVisitor() : m_layerId(0) {}
+    SerializerVisitor() : m_layerId(0), m_isOptimizedGraph(false) {}
     ~SerializerVisitor() {}
 
     flatbuffers::FlatBufferBuilder& GetFlatBufferBuilder()
@@ -46,6 +52,15 @@ public:
 
     flatbuffers::Offset<armnnSerializer::FeatureCompatibilityVersions> GetVersionTable();
 
+    /// Serializes the layers of the graph of an optimized network in topological order, together with the backend
+    /// and tensor handle factory the optimizer chose for each of them.
+    void VisitOptimizedGraph(const armnn::Graph& graph);
+
+    bool IsOptimizedGraph() const
+    {
+        return m_isOptimizedGraph;
+    }
+
 
     ARMNN_DEPRECATED_MSG("Use VisitElementwiseUnaryLayer instead")
     void VisitAbsLayer(const armnn::IConnectableLayer* layer,
@@ -302,6 +317,9 @@ private:
             const armnn::IConnectableLayer* layer,
             const armnnSerializer::LayerType layerType);
 
+    /// Serializes a layer that only the optimizer inserts, so has no Visit function.
+    void SerializeOptimizerLayer(const armnn::Layer& layer);
+
     /// Creates the serializer AnyLayer for the layer and adds it to m_serializedLayers.
     void CreateAnyLayer(const flatbuffers::Offset<void>& layer, const armnnSerializer::Layer serializerLayer);
 
@@ -343,6 +361,9 @@ private:
 
     /// layer within our FlatBuffer index.
     uint32_t m_layerId;
+
+    /// True when serializing an optimized network, whose layers also carry their backend assignment.
+    bool m_isOptimizedGraph;
 };
 
 class Serializer : public ISerializer
@@ -355,6 +376,10 @@ public:
     /// @param [in] inNetwork The network to be serialized.
     void Serialize(const armnn::INetwork& inNetwork) override;
 
+    /// Serializes the optimized network to ArmNN SerializedGraph.
+    /// @param [in] inNetwork The optimized network to be serialized.
+    void Serialize(const armnn::IOptimizedNetwork& inNetwork) override;
+
     /// Serializes the SerializedGraph to the stream.
     /// @param [stream] the stream to save to
     /// @return true if graph is Serialized to the Stream, false otherwise
@@ -50,8 +50,10 @@ armnnSerializer::ConstTensorData GetFlatBufferConstTensorData(armnn::DataType da
         case armnn::DataType::Signed32:
             return armnnSerializer::ConstTensorData::ConstTensorData_IntData;
         case armnn::DataType::Float16:
+        case armnn::DataType::BFloat16:
         case armnn::DataType::QSymmS16:
             return armnnSerializer::ConstTensorData::ConstTensorData_ShortData;
+        case armnn::DataType::QAsymmS8:
         case armnn::DataType::QAsymmU8:
         case armnn::DataType::QSymmS8:
         case armnn::DataType::Boolean:
@@ -69,6 +71,8 @@ armnnSerializer::DataType GetFlatBufferDataType(armnn::DataType dataType)
             return armnnSerializer::DataType::DataType_Float32;
         case armnn::DataType::Float16:
             return armnnSerializer::DataType::DataType_Float16;
+        case armnn::DataType::BFloat16:
+            return armnnSerializer::DataType::DataType_BFloat16;
         case armnn::DataType::Signed32:
             return armnnSerializer::DataType::DataType_Signed32;
         case armnn::DataType::QSymmS16:
@@ -86,6 +90,22 @@ armnnSerializer::DataType GetFlatBufferDataType(armnn::DataType dataType)
     }
 }
 
+armnnSerializer::EdgeStrategy GetFlatBufferEdgeStrategy(armnn::EdgeStrategy edgeStrategy)
+{
+    switch (edgeStrategy)
+    {
+        case armnn::EdgeStrategy::DirectCompatibility:
+            return armnnSerializer::EdgeStrategy::EdgeStrategy_DirectCompatibility;
+        case armnn::EdgeStrategy::ExportToTarget:
+            return armnnSerializer::EdgeStrategy::EdgeStrategy_ExportToTarget;
+        case armnn::EdgeStrategy::CopyToTarget:
+            return armnnSerializer::EdgeStrategy::EdgeStrategy_CopyToTarget;
+        case armnn::EdgeStrategy::Undefined:
+        default:
+            return armnnSerializer::EdgeStrategy::EdgeStrategy_Undefined;
+    }
+}
+
 armnnSerializer::DataLayout GetFlatBufferDataLayout(armnn::DataLayout dataLayout)
 {
     switch (dataLayout)
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <armnn/Types.hpp>
+#include <armnn/backends/ITensorHandleFactory.hpp>
 #include <ArmnnSchema_generated.h>
 
 namespace armnnSerializer
@@ -18,6 +19,8 @@ armnnSerializer::DataType GetFlatBufferDataType(armnn::DataType dataType);
 
 armnnSerializer::DataLayout GetFlatBufferDataLayout(armnn::DataLayout dataLayout);
 
+armnnSerializer::EdgeStrategy GetFlatBufferEdgeStrategy(armnn::EdgeStrategy edgeStrategy);
+
 armnnSerializer::UnaryOperation GetFlatBufferUnaryOperation(armnn::UnaryOperation unaryOperation);
 
 armnnSerializer::PoolingAlgorithm GetFlatBufferPoolingAlgorithm(armnn::PoolingAlgorithm poolingAlgorithm);
@@ -0,0 +1,176 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "../Serializer.hpp"
+
+#include <Graph.hpp>
+#include <Network.hpp>
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/INetwork.hpp>
+#include <armnn/IRuntime.hpp>
+#include <armnn/utility/PolymorphicDowncast.hpp>
+#include <armnnDeserializer/IDeserializer.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+armnn::INetworkPtr CreateConvolutionNetwork(const std::vector<float>& weightsData, const std::vector<float>& biasData)
+{
+    armnn::TensorInfo inputInfo({ 1, 4, 4, 1 }, armnn::DataType::Float32);
+    armnn::TensorInfo outputInfo({ 1, 4, 4, 2 }, armnn::DataType::Float32);
+    armnn::TensorInfo weightsInfo({ 2, 3, 3, 1 }, armnn::DataType::Float32);
+    armnn::TensorInfo biasInfo({ 2 }, armnn::DataType::Float32);
+
+    armnn::Convolution2dDescriptor convDescriptor;
+    convDescriptor.m_PadLeft = convDescriptor.m_PadRight = convDescriptor.m_PadTop = convDescriptor.m_PadBottom = 1;
+    convDescriptor.m_StrideX = convDescriptor.m_StrideY = 1;
+    convDescriptor.m_BiasEnabled = true;
+    convDescriptor.m_DataLayout = armnn::DataLayout::NHWC;
+
+    armnn::ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = armnn::ActivationFunction::ReLu;
+
+    armnn::INetworkPtr network = armnn::INetwork::Create();
+    armnn::IConnectableLayer* const inputLayer = network->AddInputLayer(0, "input");
+    armnn::IConnectableLayer* const convLayer =
+        network->AddConvolution2dLayer(convDescriptor,
+                                       armnn::ConstTensor(weightsInfo, weightsData),
+                                       armnn::Optional<armnn::ConstTensor>(armnn::ConstTensor(biasInfo, biasData)),
+                                       "convolution");
+    armnn::IConnectableLayer* const activationLayer = network->AddActivationLayer(activationDescriptor, "activation");
+    armnn::IConnectableLayer* const outputLayer = network->AddOutputLayer(0, "output");
+
+    inputLayer->GetOutputSlot(0).Connect(convLayer->GetInputSlot(0));
+    inputLayer->GetOutputSlot(0).SetTensorInfo(inputInfo);
+    convLayer->GetOutputSlot(0).Connect(activationLayer->GetInputSlot(0));
+    convLayer->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    activationLayer->GetOutputSlot(0).Connect(outputLayer->GetInputSlot(0));
+    activationLayer->GetOutputSlot(0).SetTensorInfo(outputInfo);
+
+    return network;
+}
+
+template <typename NetworkType>
+std::vector<std::uint8_t> SerializeToBinary(const NetworkType& network)
+{
+    armnnSerializer::Serializer serializer;
+    serializer.Serialize(network);
+
+    std::stringstream stream;
+    serializer.SaveSerializedToStream(stream);
+
+    std::string const serializerString{stream.str()};
+    return std::vector<std::uint8_t>(serializerString.begin(), serializerString.end());
+}
+
+std::vector<float> Run(armnn::IRuntime& runtime, armnn::IOptimizedNetworkPtr optimizedNetwork)
+{
+    armnn::NetworkId networkIdentifier;
+    BOOST_TEST(runtime.LoadNetwork(networkIdentifier, std::move(optimizedNetwork)) == armnn::Status::Success);
+
+    std::vector<float> inputData(16);
+    for (unsigned int i = 0; i < inputData.size(); ++i)
+    {
+        inputData[i] = static_cast<float>(i % 5) - 2.0f;
+    }
+    std::vector<float> outputData(32);
+
+    armnn::InputTensors inputTensors
+    {
+        {0, armnn::ConstTensor(runtime.GetInputTensorInfo(networkIdentifier, 0), inputData.data())}
+    };
+    armnn::OutputTensors outputTensors
+    {
+        {0, armnn::Tensor(runtime.GetOutputTensorInfo(networkIdentifier, 0), outputData.data())}
+    };
+    runtime.EnqueueWorkload(networkIdentifier, inputTensors, outputTensors);
+    runtime.UnloadNetwork(networkIdentifier);
+    return outputData;
+}
+
+armnn::Graph& GetGraph(armnn::IOptimizedNetwork& optimizedNetwork)
+{
+    return armnn::PolymorphicDowncast<armnn::OptimizedNetwork*>(&optimizedNetwork)->GetGraph();
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(SerializerTests)
+
+BOOST_AUTO_TEST_CASE(OptimizedNetworkSerialization)
+{
+    std::vector<float> weightsData(18);
+    for (unsigned int i = 0; i < weightsData.size(); ++i)
+    {
+        weightsData[i] = static_cast<float>(i % 7) * 0.25f - 0.5f;
+    }
+    std::vector<float> biasData { 0.5f, -1.0f };
+    armnn::INetworkPtr network = CreateConvolutionNetwork(weightsData, biasData);
+
+    // Reducing to Fp16 makes the optimizer insert conversion layers and convert the constants
+    armnn::IRuntimePtr runtime = armnn::IRuntime::Create(armnn::IRuntime::CreationOptions());
+    armnn::OptimizerOptions optimizerOptions;
+    optimizerOptions.m_ReduceFp32ToFp16 = true;
+    armnn::IOptimizedNetworkPtr optimizedNetwork =
+        armnn::Optimize(*network, { armnn::Compute::CpuRef }, runtime->GetDeviceSpec(), optimizerOptions);
+    BOOST_TEST(optimizedNetwork.get());
+
+    const std::vector<std::uint8_t> optimizedBinary = SerializeToBinary(*optimizedNetwork);
+    armnnDeserializer::IDeserializerPtr parser = armnnDeserializer::IDeserializer::Create();
+    armnn::IOptimizedNetworkPtr deserializedNetwork = parser->CreateOptimizedNetworkFromBinary(optimizedBinary);
+
+    // The same layers in the same order, with the same backends and tensor handle factories
+    armnn::Graph& graph = GetGraph(*optimizedNetwork).TopologicalSort();
+    armnn::Graph& deserializedGraph = GetGraph(*deserializedNetwork).TopologicalSort();
+    BOOST_TEST(deserializedGraph.GetNumLayers() == graph.GetNumLayers());
+
+    unsigned int numConversionLayers = 0;
+    auto deserializedLayer = deserializedGraph.begin();
+    for (armnn::Layer* layer : graph)
+    {
+        BOOST_TEST(std::string((*deserializedLayer)->GetName()) == layer->GetName());
+        BOOST_TEST(((*deserializedLayer)->GetType() == layer->GetType()));
+        BOOST_TEST((*deserializedLayer)->GetBackendId().Get() == layer->GetBackendId().Get());
+        for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
+        {
+            const armnn::OutputSlot& outputSlot = layer->GetOutputSlot(i);
+            const armnn::OutputSlot& deserializedOutputSlot = (*deserializedLayer)->GetOutputSlot(i);
+            BOOST_TEST((deserializedOutputSlot.GetTensorInfo() == outputSlot.GetTensorInfo()));
+            BOOST_TEST(deserializedOutputSlot.GetTensorHandleFactoryId() == outputSlot.GetTensorHandleFactoryId());
+            BOOST_TEST((deserializedOutputSlot.GetEdgeStrategies() == outputSlot.GetEdgeStrategies()));
+        }
+
+        if (layer->GetType() == armnn::LayerType::ConvertFp32ToFp16 ||
+            layer->GetType() == armnn::LayerType::ConvertFp16ToFp32)
+        {
+            ++numConversionLayers;
+        }
+        if (layer->GetType() == armnn::LayerType::Convolution2d)
+        {
+            auto convLayer = armnn::PolymorphicDowncast<armnn::Convolution2dLayer*>(*deserializedLayer);
+            BOOST_TEST((convLayer->m_Weight->GetTensorInfo().GetDataType() == armnn::DataType::Float16));
+        }
+        ++deserializedLayer;
+    }
+    BOOST_TEST(numConversionLayers == 2);
+
+    // Runs without optimizing again and gives the same results
+    std::vector<float> outputData = Run(*runtime, std::move(optimizedNetwork));
+    std::vector<float> deserializedOutputData = Run(*runtime, std::move(deserializedNetwork));
+    BOOST_TEST(deserializedOutputData == outputData, boost::test_tools::per_element());
+
+    // Optimized and non optimized binaries can only be deserialized as such
+    BOOST_CHECK_THROW(parser->CreateNetworkFromBinary(optimizedBinary), armnn::ParseException);
+    BOOST_CHECK_THROW(parser->CreateOptimizedNetworkFromBinary(SerializeToBinary(*network)), armnn::ParseException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -11,6 +11,8 @@
 
 #include <fmt/format.h>
 
+#include <array>
+
 using namespace armnn;
 
 namespace armnnUtils
@@ -60,24 +62,52 @@ std::pair<float, float> FindMinMax(ITensorHandle* tensorHandle)
     auto tensor_data = static_cast<const float *>(tensorHandle->Map(true));
     auto tensor_size = tensorHandle->GetShape().GetNumElements();
 
-    // Set min/max initially to first value in tensor
-    float min = tensor_data[0];
-    float max = tensor_data[0];
+    std::pair<float, float> minMax = FindMinMax(tensor_data, tensor_size);
+
+    tensorHandle->Unmap();
+
+    return minMax;
+}
 
-    // Loop over rest of tensor and update min/max if necessary
-    for (unsigned int val = 1; val < tensor_size; val++)
+std::pair<float, float> FindMinMax(const float* data, unsigned int numElements)
+{
+    if (numElements == 0)
     {
-        if (tensor_data[val] < min)
-        {
-            min = tensor_data[val];
-        }
-        else if (tensor_data[val] > max)
+        throw InvalidArgumentException("Cannot find the min/max of an empty tensor");
+    }
+
+    // Keep a separate min/max for each of a few lanes so that consecutive elements do not depend on each other
+    // and the compiler can turn the loop into vector min/max instructions. Every lane starts from the first value,
+    // and NaNs never compare less or greater, so like a plain scan only a leading NaN can end up in the result.
+    constexpr unsigned int numLanes = 8;
+    std::array<float, numLanes> mins;
+    std::array<float, numLanes> maxs;
+    mins.fill(data[0]);
+    maxs.fill(data[0]);
+
+    unsigned int i = 0;
+    for (; i + numLanes <= numElements; i += numLanes)
+    {
+        for (unsigned int lane = 0; lane < numLanes; ++lane)
         {
-            max = tensor_data[val];
+            const float value = data[i + lane];
+            mins[lane] = value < mins[lane] ? value : mins[lane];
+            maxs[lane] = value > maxs[lane] ? value : maxs[lane];
         }
     }
+    for (; i < numElements; ++i)
+    {
+        mins[0] = data[i] < mins[0] ? data[i] : mins[0];
+        maxs[0] = data[i] > maxs[0] ? data[i] : maxs[0];
+    }
 
-    tensorHandle->Unmap();
+    float min = mins[0];
+    float max = maxs[0];
+    for (unsigned int lane = 1; lane < numLanes; ++lane)
+    {
+        min = mins[lane] < min ? mins[lane] : min;
+        max = maxs[lane] > max ? maxs[lane] : max;
+    }
 
     return std::make_pair(min, max);
 }
@@ -9,6 +9,8 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <vector>
+
 using namespace armnn;
 using namespace armnnUtils;
 
@@ -134,4 +136,24 @@ BOOST_AUTO_TEST_CASE(ExpandDimsInvalidNegativeAxisTest)
     BOOST_CHECK_THROW(ExpandDims(inputShape, -5), armnn::InvalidArgumentException);
 }
 
+BOOST_AUTO_TEST_CASE(FindMinMaxTest)
+{
+    // Lengths around and above the number of lanes scanned at once, with the extremes in the tail
+    for (unsigned int numElements : { 1u, 7u, 8u, 9u, 21u })
+    {
+        std::vector<float> data(numElements);
+        for (unsigned int i = 0; i < numElements; ++i)
+        {
+            data[i] = static_cast<float>(i % 5) - 2.0f;
+        }
+        data[numElements - 1] = -100.0f;
+
+        std::pair<float, float> minMax = FindMinMax(data.data(), numElements);
+        BOOST_TEST(minMax.first == -100.0f);
+        BOOST_TEST(minMax.second == (numElements == 1 ? -100.0f : 2.0f));
+    }
+
+    BOOST_CHECK_THROW(FindMinMax(nullptr, 0), armnn::InvalidArgumentException);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
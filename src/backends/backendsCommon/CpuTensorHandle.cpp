@@ -54,6 +54,7 @@ void* CpuTensorHandle::GetTensor<void>() const
 
 ScopedCpuTensorHandle::ScopedCpuTensorHandle(const TensorInfo& tensorInfo)
 : CpuTensorHandle(tensorInfo)
+, m_IsMemoryBorrowed(false)
 {
 }
 
@@ -63,29 +64,49 @@ ScopedCpuTensorHandle::ScopedCpuTensorHandle(const ConstTensor& tensor)
     CopyFrom(tensor.GetMemoryArea(), tensor.GetNumBytes());
 }
 
+ScopedCpuTensorHandle::ScopedCpuTensorHandle(const ConstTensor& tensor, bool borrowMemory)
+: ScopedCpuTensorHandle(tensor.GetInfo())
+{
+    if (borrowMemory)
+    {
+        Borrow(tensor.GetMemoryArea());
+    }
+    else
+    {
+        CopyFrom(tensor.GetMemoryArea(), tensor.GetNumBytes());
+    }
+}
+
 ScopedCpuTensorHandle::ScopedCpuTensorHandle(const ConstCpuTensorHandle& tensorHandle)
 : ScopedCpuTensorHandle(tensorHandle.GetTensorInfo())
 {
-    CopyFrom(tensorHandle.GetConstTensor<void>(), tensorHandle.GetTensorInfo().GetNumBytes());
+    auto scopedHandle = dynamic_cast<const ScopedCpuTensorHandle*>(&tensorHandle);
+    if (scopedHandle && scopedHandle->IsMemoryBorrowed())
+    {
+        Borrow(tensorHandle.GetConstTensor<void>());
+    }
+    else
+    {
+        CopyFrom(tensorHandle.GetConstTensor<void>(), tensorHandle.GetTensorInfo().GetNumBytes());
+    }
 }
 
 ScopedCpuTensorHandle::ScopedCpuTensorHandle(const ScopedCpuTensorHandle& other)
-: CpuTensorHandle(other.GetTensorInfo())
+: ScopedCpuTensorHandle(other.GetTensorInfo())
 {
     CopyFrom(other);
 }
 
 ScopedCpuTensorHandle& ScopedCpuTensorHandle::operator=(const ScopedCpuTensorHandle& other)
 {
-    ::operator delete(GetTensor<void>());
-    SetMemory(nullptr);
+    Release();
     CopyFrom(other);
     return *this;
 }
 
 ScopedCpuTensorHandle::~ScopedCpuTensorHandle()
 {
-    ::operator delete(GetTensor<void>());
+    Release();
 }
 
 void ScopedCpuTensorHandle::Allocate()
@@ -113,7 +134,14 @@ void ScopedCpuTensorHandle::CopyInFrom(const void* memory)
 
 void ScopedCpuTensorHandle::CopyFrom(const ScopedCpuTensorHandle& other)
 {
-    CopyFrom(other.GetTensor<void>(), other.GetTensorInfo().GetNumBytes());
+    if (other.IsMemoryBorrowed())
+    {
+        Borrow(other.GetTensor<void>());
+    }
+    else
+    {
+        CopyFrom(other.GetTensor<void>(), other.GetTensorInfo().GetNumBytes());
+    }
 }
 
 void ScopedCpuTensorHandle::CopyFrom(const void* srcMemory, unsigned int numBytes)
@@ -128,6 +156,25 @@ void ScopedCpuTensorHandle::CopyFrom(const void* srcMemory, unsigned int numByte
     }
 }
 
+void ScopedCpuTensorHandle::Borrow(const void* memory)
+{
+    ARMNN_ASSERT(GetTensor<void>() == nullptr);
+
+    // Borrowed memory must never be written to; it is only stored as mutable for the CpuTensorHandle base.
+    SetMemory(const_cast<void*>(memory));
+    m_IsMemoryBorrowed = true;
+}
+
+void ScopedCpuTensorHandle::Release()
+{
+    if (!m_IsMemoryBorrowed)
+    {
+        ::operator delete(GetTensor<void>());
+    }
+    SetMemory(nullptr);
+    m_IsMemoryBorrowed = false;
+}
+
 void PassthroughCpuTensorHandle::Allocate()
 {
     throw InvalidArgumentException("PassthroughCpuTensorHandle::Allocate() should never be called");
@@ -111,7 +111,13 @@ public:
     // Copies contents from Tensor.
     explicit ScopedCpuTensorHandle(const ConstTensor& tensor);
 
-    // Copies contents from ConstCpuTensorHandle
+    // Borrows the memory of Tensor instead of copying it when borrowMemory is true.
+    // The caller must keep the memory alive and unchanged for as long as this handle, or any copy of it, exists:
+    // copies of a handle that borrows its memory borrow the same memory.
+    ScopedCpuTensorHandle(const ConstTensor& tensor, bool borrowMemory);
+
+    // Copies contents from ConstCpuTensorHandle, or borrows them when it is a ScopedCpuTensorHandle that
+    // borrows its memory.
     explicit ScopedCpuTensorHandle(const ConstCpuTensorHandle& tensorHandle);
 
     ScopedCpuTensorHandle(const ScopedCpuTensorHandle& other);
@@ -120,6 +126,8 @@ public:
 
     virtual void Allocate() override;
 
+    bool IsMemoryBorrowed() const { return m_IsMemoryBorrowed; }
+
 private:
     // Only used for testing
     void CopyOutTo(void* memory) const override;
@@ -127,6 +135,10 @@ private:
 
     void CopyFrom(const ScopedCpuTensorHandle& other);
     void CopyFrom(const void* srcMemory, unsigned int numBytes);
+    void Borrow(const void* memory);
+    void Release();
+
+    bool m_IsMemoryBorrowed;
 };
 
 // A CpuTensorHandle that wraps an already allocated memory region.
@@ -638,6 +638,13 @@ bool LayerSupportBase::IsSwitchSupported(const TensorInfo&, // input0
     return DefaultLayerSupport(__func__, __FILE__, __LINE__, reasonIfUnsupported);
 }
 
+bool LayerSupportBase::IsTensorStatsSupported(const TensorInfo&, // input
+                                              const TensorStatsDescriptor&, // descriptor
+                                              Optional<std::string&> reasonIfUnsupported) const
+{
+    return DefaultLayerSupport(__func__, __FILE__, __LINE__, reasonIfUnsupported);
+}
+
 bool LayerSupportBase::IsTransposeConvolution2dSupported(const TensorInfo&, // input
                                                          const TensorInfo&, // output
                                                          const TransposeConvolution2dDescriptor&, // descriptor
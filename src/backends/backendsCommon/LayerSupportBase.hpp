@@ -391,6 +391,10 @@ public:
                            const TensorInfo& output1,
                            Optional<std::string&> reasonIfUnsupported = EmptyOptional()) const override;
 
+    bool IsTensorStatsSupported(const TensorInfo& input,
+                                const TensorStatsDescriptor& descriptor,
+                                Optional<std::string&> reasonIfUnsupported = EmptyOptional()) const override;
+
     bool IsTransposeConvolution2dSupported(
         const TensorInfo& input,
         const TensorInfo& output,
@@ -2513,6 +2513,19 @@ void DebugQueueDescriptor::Validate(const WorkloadInfo& workloadInfo) const
     ValidateNumOutputs(workloadInfo, descriptorName, 1);
 }
 
+void TensorStatsQueueDescriptor::Validate(const WorkloadInfo& workloadInfo) const
+{
+    const std::string descriptorName{"TensorStatsQueueDescriptor"};
+
+    ValidateNumInputs(workloadInfo,  descriptorName, 1);
+    ValidateNumOutputs(workloadInfo, descriptorName, 0);
+
+    if (m_Parameters.m_NumBins > 0 && !(m_Parameters.m_HistogramMin < m_Parameters.m_HistogramMax))
+    {
+        throw InvalidArgumentException(descriptorName + ": The histogram minimum must be less than its maximum.");
+    }
+}
+
 void EqualQueueDescriptor::Validate(const WorkloadInfo& workloadInfo) const
 {
     const std::string descriptorName{"EqualQueueDescriptor"};
@@ -47,7 +47,9 @@ protected:
         : m_AdditionalInfoObject(nullptr)
     {}
     QueueDescriptor(QueueDescriptor const&) = default;
+    QueueDescriptor(QueueDescriptor&&) = default;
     QueueDescriptor& operator=(QueueDescriptor const&) = default;
+    QueueDescriptor& operator=(QueueDescriptor&&) = default;
 };
 
 // Base class for queue descriptors which contain parameters.
@@ -60,7 +62,9 @@ protected:
     ~QueueDescriptorWithParameters() = default;
     QueueDescriptorWithParameters() = default;
     QueueDescriptorWithParameters(QueueDescriptorWithParameters const&) = default;
+    QueueDescriptorWithParameters(QueueDescriptorWithParameters&&) = default;
     QueueDescriptorWithParameters& operator=(QueueDescriptorWithParameters const&) = default;
+    QueueDescriptorWithParameters& operator=(QueueDescriptorWithParameters&&) = default;
 };
 
 struct MapQueueDescriptor : QueueDescriptor
@@ -489,6 +493,17 @@ struct DebugQueueDescriptor : QueueDescriptor
     unsigned int m_SlotIndex;
 };
 
+struct TensorStatsQueueDescriptor : QueueDescriptorWithParameters<TensorStatsDescriptor>
+{
+    TensorStatsQueueDescriptor() : m_Guid(0), m_SlotIndex(0) {}
+
+    void Validate(const WorkloadInfo& workloadInfo) const;
+
+    LayerGuid m_Guid;
+    std::string m_LayerName;
+    unsigned int m_SlotIndex;
+};
+
 struct RsqrtQueueDescriptor : QueueDescriptor
 {
     void Validate(const WorkloadInfo& workloadInfo) const;
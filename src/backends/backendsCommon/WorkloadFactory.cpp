@@ -1145,6 +1145,15 @@ bool IWorkloadFactory::IsLayerConfigurationSupported(const BackendId& backendId,
                                                            reason);
             break;
         }
+        case LayerType::TensorStats:
+        {
+            auto cLayer = PolymorphicDowncast<const TensorStatsLayer*>(&layer);
+            const TensorInfo& input = layer.GetInputSlot(0).GetConnection()->GetTensorInfo();
+            result = layerSupportObject->IsTensorStatsSupported(OverrideDataType(input, dataType),
+                                                                cLayer->GetParameters(),
+                                                                reason);
+            break;
+        }
         case LayerType::Mean:
         {
             auto cLayer = PolymorphicDowncast<const MeanLayer*>(&layer);
@@ -1671,6 +1680,12 @@ std::unique_ptr<IWorkload> IWorkloadFactory::CreateSwitch(const SwitchQueueDescr
     return std::unique_ptr<IWorkload>();
 }
 
+std::unique_ptr<IWorkload> IWorkloadFactory::CreateTensorStats(const TensorStatsQueueDescriptor& /*descriptor*/,
+                                                               const WorkloadInfo& /*info*/) const
+{
+    return std::unique_ptr<IWorkload>();
+}
+
 std::unique_ptr<IWorkload> IWorkloadFactory::CreateTranspose(const TransposeQueueDescriptor& /*descriptor*/,
                                                              const WorkloadInfo& /*info*/) const
 {
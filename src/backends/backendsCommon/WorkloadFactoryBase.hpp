@@ -274,6 +274,10 @@ public:
                                             const WorkloadInfo& /*info*/) const override
     { return nullptr; }
 
+    std::unique_ptr<IWorkload> CreateTensorStats(const TensorStatsQueueDescriptor& /*descriptor*/,
+                                                 const WorkloadInfo& /*info*/) const override
+    { return nullptr; }
+
     std::unique_ptr<IWorkload> CreateTranspose(const TransposeQueueDescriptor& /*descriptor*/,
                                                const WorkloadInfo& /*info*/) const override
     { return nullptr; }
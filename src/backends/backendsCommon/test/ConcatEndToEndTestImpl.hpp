@@ -306,4 +306,81 @@ void ConcatDim3EndToEnd(const std::vector<BackendId>& backends)
     EndToEndLayerTestImpl<ArmnnType, ArmnnType>(move(net), inputTensorData, expectedOutputData, backends);
 }
 
+// The inputs of the Concat are produced by other layers, so backends supporting sub-tensors can have those layers
+// write straight into the output of the Concat.
+template<armnn::DataType ArmnnType>
+void ConcatOfActivationsEndToEnd(const std::vector<BackendId>& backends, unsigned int concatAxis)
+{
+    using namespace armnn;
+    using T = ResolveType<ArmnnType>;
+
+    const TensorShape inputShape{ 2, 3, 2, 2 };
+    const std::vector<TensorShape> inputShapes{ inputShape, inputShape };
+
+    std::vector<unsigned int> outputDims{ 2, 3, 2, 2 };
+    outputDims[concatAxis] *= 2;
+    const TensorShape outputShape(4, outputDims.data());
+
+    INetworkPtr net(INetwork::Create());
+
+    OriginsDescriptor descriptor = CreateDescriptorForConcatenation(inputShapes.begin(),
+                                                                    inputShapes.end(),
+                                                                    concatAxis);
+    IConnectableLayer* concat = net->AddConcatLayer(descriptor, "concat");
+
+    ActivationDescriptor doubleDescriptor;
+    doubleDescriptor.m_Function = ActivationFunction::Linear;
+    doubleDescriptor.m_A = 2.0f;
+    doubleDescriptor.m_B = 0.0f;
+
+    const TensorInfo inputTensorInfo(inputShape, ArmnnType, 1.0f, 0);
+    for (unsigned int i = 0; i < inputShapes.size(); ++i)
+    {
+        IConnectableLayer* input = net->AddInputLayer(armnn::numeric_cast<LayerBindingId>(i));
+        IConnectableLayer* activation = net->AddActivationLayer(doubleDescriptor);
+        Connect(input, activation, inputTensorInfo, 0, 0);
+        Connect(activation, concat, inputTensorInfo, 0, i);
+    }
+
+    IConnectableLayer* output = net->AddOutputLayer(0, "output");
+    Connect(concat, output, TensorInfo(outputShape, ArmnnType, 1.0f, 0), 0, 0);
+
+    std::vector<T> inputData0(inputShape.GetNumElements());
+    std::vector<T> inputData1(inputShape.GetNumElements());
+    for (unsigned int i = 0; i < inputShape.GetNumElements(); ++i)
+    {
+        inputData0[i] = static_cast<T>(i + 1);
+        inputData1[i] = static_cast<T>(i + 50);
+    }
+
+    // Places every input element at its position in the output.
+    std::vector<T> expectedOutput(outputShape.GetNumElements());
+    for (unsigned int i = 0; i < inputShape.GetNumElements(); ++i)
+    {
+        unsigned int coords[4];
+        unsigned int remainder = i;
+        for (unsigned int d = 4; d-- > 0;)
+        {
+            coords[d] = remainder % inputShape[d];
+            remainder /= inputShape[d];
+        }
+
+        for (unsigned int view = 0; view < 2; ++view)
+        {
+            unsigned int outputIndex = 0;
+            for (unsigned int d = 0; d < 4; ++d)
+            {
+                const unsigned int coord = d == concatAxis ? coords[d] + view * inputShape[d] : coords[d];
+                outputIndex = outputIndex * outputShape[d] + coord;
+            }
+            expectedOutput[outputIndex] = static_cast<T>(2 * (view == 0 ? inputData0[i] : inputData1[i]));
+        }
+    }
+
+    std::map<int, std::vector<T>> inputTensorData = {{ 0, inputData0 }, { 1, inputData1 }};
+    std::map<int, std::vector<T>> expectedOutputData = {{ 0, expectedOutput }};
+
+    EndToEndLayerTestImpl<ArmnnType, ArmnnType>(move(net), inputTensorData, expectedOutputData, backends);
+}
+
 } // anonymous namespace
@@ -736,8 +736,11 @@ inline void ExportOutputWithSeveralOutputSlotConnectionsTest(std::vector<Backend
         {1,armnn::Tensor(runtime->GetOutputTensorInfo(netId, 1), outputData1.data())}
     };
 
-    // The result of the inference is not important, just the fact that there
-    // should not be CopyMemGeneric workloads.
+    // The first output gets exported and the second one copied from it
+    std::map<LayerBindingId, std::string> copyReasons = runtime->GetOutputCopyReasons(netId);
+    BOOST_TEST(copyReasons.size() == 1);
+    BOOST_TEST(copyReasons.count(1) == 1);
+
     runtime->GetProfiler(netId)->EnableProfiling(true);
 
     // Do the inference
@@ -765,10 +768,10 @@ inline void ExportOutputWithSeveralOutputSlotConnectionsTest(std::vector<Backend
     }
 
     BOOST_TEST(found != std::string::npos);
-    // No contains SyncMemGeneric
+    // Contains SyncMemGeneric for the exported output
     found = dump.find("SyncMemGeneric");
-    BOOST_TEST(found == std::string::npos);
-    // Contains CopyMemGeneric
+    BOOST_TEST(found != std::string::npos);
+    // Contains CopyMemGeneric for the other one
     found = dump.find("CopyMemGeneric");
     BOOST_TEST(found != std::string::npos);
 
@@ -779,6 +782,94 @@ inline void ExportOutputWithSeveralOutputSlotConnectionsTest(std::vector<Backend
                                   expectedOutput.begin(), expectedOutput.end());
 }
 
+inline void ExportOutputReadByOtherLayersTest(std::vector<BackendId> backends)
+{
+    using namespace armnn;
+
+    // Create runtime in which test will run
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    // build up the structure of the network: both the input and the output of the first activation are
+    // outputs of the network as well as inputs of other layers
+    INetworkPtr net(INetwork::Create());
+
+    IConnectableLayer* input = net->AddInputLayer(0);
+
+    ActivationDescriptor descriptor;
+    descriptor.m_Function = ActivationFunction::Square;
+    IConnectableLayer* activation0 = net->AddActivationLayer(descriptor);
+    IConnectableLayer* activation1 = net->AddActivationLayer(descriptor);
+
+    IConnectableLayer* output0 = net->AddOutputLayer(0);
+    IConnectableLayer* output1 = net->AddOutputLayer(1);
+    IConnectableLayer* output2 = net->AddOutputLayer(2);
+
+    input->GetOutputSlot(0).Connect(activation0->GetInputSlot(0));
+    input->GetOutputSlot(0).Connect(output0->GetInputSlot(0));
+    activation0->GetOutputSlot(0).Connect(activation1->GetInputSlot(0));
+    activation0->GetOutputSlot(0).Connect(output1->GetInputSlot(0));
+    activation1->GetOutputSlot(0).Connect(output2->GetInputSlot(0));
+
+    TensorInfo tensorInfo({ 1, 1, 4, 1 }, DataType::Float32);
+    input->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    activation0->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    activation1->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    // Optimize the network
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+
+    // Loads it into the runtime with export only, so that the input is copied straight into output 0
+    NetworkId netId;
+    std::string ignoredErrorMessage;
+    INetworkProperties networkProperties(false, true);
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet), ignoredErrorMessage, networkProperties)
+               == Status::Success);
+
+    BOOST_TEST(runtime->GetOutputCopyReasons(netId).empty());
+
+    std::vector<float> inputData{ 1.0f, 2.0f, 3.0f, 4.0f };
+    std::vector<float> outputData0(4);
+    std::vector<float> outputData1(4);
+    std::vector<float> outputData2(4);
+
+    std::vector<float> expectedOutput1{ 1.0f, 4.0f, 9.0f, 16.0f };
+    std::vector<float> expectedOutput2{ 1.0f, 16.0f, 81.0f, 256.0f };
+
+    InputTensors inputTensors
+    {
+        {0,armnn::ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data())},
+    };
+    OutputTensors outputTensors
+    {
+        {0,armnn::Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData0.data())},
+        {1,armnn::Tensor(runtime->GetOutputTensorInfo(netId, 1), outputData1.data())},
+        {2,armnn::Tensor(runtime->GetOutputTensorInfo(netId, 2), outputData2.data())}
+    };
+
+    runtime->GetProfiler(netId)->EnableProfiling(true);
+
+    // Do the inference
+    runtime->EnqueueWorkload(netId, inputTensors, outputTensors);
+
+    // Retrieve the Profiler.Print() output to get the workload execution
+    ProfilerManager& profilerManager = armnn::ProfilerManager::GetInstance();
+    std::stringstream ss;
+    profilerManager.GetProfiler()->Print(ss);
+    std::string dump = ss.str();
+
+    // The only copy is the one of the input, and all three outputs are exported
+    BOOST_TEST(SubStringCounter(dump, "CopyMemGeneric") == 1);
+    BOOST_TEST(SubStringCounter(dump, "SyncMemGeneric") == 3);
+
+    // Check that the outputs are correct
+    BOOST_CHECK_EQUAL_COLLECTIONS(outputData0.begin(), outputData0.end(), inputData.begin(), inputData.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(outputData1.begin(), outputData1.end(),
+                                  expectedOutput1.begin(), expectedOutput1.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(outputData2.begin(), outputData2.end(),
+                                  expectedOutput2.begin(), expectedOutput2.end());
+}
+
 inline void StridedSliceInvalidSliceEndToEndTest(std::vector<BackendId> backends)
 {
     using namespace armnn;
@@ -8,6 +8,7 @@
 
 #include <armnn/backends/IBackendInternal.hpp>
 #include <armnn/backends/IMemoryManager.hpp>
+#include <armnn/backends/ITensorHandleFactory.hpp>
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadInfo.hpp>
 
@@ -61,6 +62,27 @@ void SetWorkloadOutput(QueueDescriptor& descriptor,
     info.m_OutputTensorInfos[index] = tensorInfo;
 }
 
+// Backends may only support sub-tensors for some views, so fall back to a standalone tensor when the factory cannot
+// create the requested one.
+inline std::unique_ptr<armnn::ITensorHandle> CreateSubTensorHandleOrTensorHandle(
+    const armnn::ITensorHandleFactory& tensorHandleFactory,
+    bool subTensorsSupported,
+    armnn::ITensorHandle& parent,
+    const armnn::TensorInfo& tensorInfo,
+    const unsigned int* subTensorOrigin)
+{
+    std::unique_ptr<armnn::ITensorHandle> handle;
+    if (subTensorsSupported)
+    {
+        handle = tensorHandleFactory.CreateSubTensorHandle(parent, tensorInfo.GetShape(), subTensorOrigin);
+    }
+    if (!handle)
+    {
+        handle = tensorHandleFactory.CreateTensorHandle(tensorInfo);
+    }
+    return handle;
+}
+
 inline void ExecuteWorkload(armnn::IWorkload& workload,
                             const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
                             bool memoryManagementRequested = true)
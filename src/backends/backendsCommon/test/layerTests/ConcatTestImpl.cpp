@@ -352,11 +352,11 @@ template<typename T> void Concatenate(
             const TensorInfo& inputTensorInfo = inputTensorInfos[i];
 
             std::unique_ptr<ITensorHandle> inputHandle =
-                subTensorsSupported ?
-                    tensorHandleFactory.CreateSubTensorHandle(*outputHandle,
-                                                          inputTensorInfo.GetShape(),
-                                                          queueDescriptor.m_ViewOrigins[i].m_Origin.data()) :
-                                                          tensorHandleFactory.CreateTensorHandle(inputTensorInfo);
+                CreateSubTensorHandleOrTensorHandle(tensorHandleFactory,
+                                                    subTensorsSupported,
+                                                    *outputHandle,
+                                                    inputTensorInfo,
+                                                    queueDescriptor.m_ViewOrigins[i].m_Origin.data());
 
             inputHandles.emplace_back(std::move(inputHandle));
         }
@@ -2047,14 +2047,12 @@ LayerTestResult<T, 3> ConcatDifferentInputOutputQParamTest(
     bool subTensorsSupported = useSubtensor && workloadFactory.SupportsSubTensors();
 
     std::unique_ptr<ITensorHandle> inputHandle1 =
-            subTensorsSupported ?
-            tensorHandleFactory.CreateSubTensorHandle(*outputHandle, inputTensorInfo1.GetShape(), wOrigin1.data()) :
-            tensorHandleFactory.CreateTensorHandle(inputTensorInfo1);
+            CreateSubTensorHandleOrTensorHandle(tensorHandleFactory, subTensorsSupported,
+                                                *outputHandle, inputTensorInfo1, wOrigin1.data());
 
     std::unique_ptr<ITensorHandle> inputHandle2 =
-            subTensorsSupported ?
-            tensorHandleFactory.CreateSubTensorHandle(*outputHandle, inputTensorInfo2.GetShape(), wOrigin2.data()) :
-            tensorHandleFactory.CreateTensorHandle(inputTensorInfo2);
+            CreateSubTensorHandleOrTensorHandle(tensorHandleFactory, subTensorsSupported,
+                                                *outputHandle, inputTensorInfo2, wOrigin2.data());
 
     ConcatQueueDescriptor data;
     OriginsDescriptor desc = CreateDescriptorForConcatenation(
@@ -2199,14 +2197,12 @@ LayerTestResult<float,3> ConcatTest(
     bool subTensorsSupported = workloadFactory.SupportsSubTensors();
 
     std::unique_ptr<ITensorHandle> inputHandle1 =
-        subTensorsSupported ?
-            tensorHandleFactory.CreateSubTensorHandle(*outputHandle, inputTensorInfo1.GetShape(), wOrigin1.data()) :
-            tensorHandleFactory.CreateTensorHandle(inputTensorInfo1);
+        CreateSubTensorHandleOrTensorHandle(tensorHandleFactory, subTensorsSupported,
+                                            *outputHandle, inputTensorInfo1, wOrigin1.data());
 
     std::unique_ptr<ITensorHandle> inputHandle2  =
-        subTensorsSupported ?
-            tensorHandleFactory.CreateSubTensorHandle(*outputHandle, inputTensorInfo2.GetShape(), wOrigin2.data()) :
-            tensorHandleFactory.CreateTensorHandle(inputTensorInfo2);
+        CreateSubTensorHandleOrTensorHandle(tensorHandleFactory, subTensorsSupported,
+                                            *outputHandle, inputTensorInfo2, wOrigin2.data());
 
     ConcatQueueDescriptor data;
     WorkloadInfo info;
@@ -2528,17 +2524,17 @@ LayerTestResult<uint8_t, 3> ConcatUint8DifferentQParamsTest(
 
     std::unique_ptr<ITensorHandle> outputHandle = tensorHandleFactory.CreateTensorHandle(outputTensorInfo);
 
-    bool subTensorsSupported = workloadFactory.SupportsSubTensors();
+    // Like the Concat layer, only alias the inputs into the output when their quantization matches, which is not
+    // the case here.
+    bool subTensorsSupported = false;
 
     std::unique_ptr<ITensorHandle> inputHandle1 =
-            subTensorsSupported ?
-            tensorHandleFactory.CreateSubTensorHandle(*outputHandle, inputTensorInfo1.GetShape(), wOrigin1.data()) :
-            tensorHandleFactory.CreateTensorHandle(inputTensorInfo1);
+            CreateSubTensorHandleOrTensorHandle(tensorHandleFactory, subTensorsSupported,
+                                                *outputHandle, inputTensorInfo1, wOrigin1.data());
 
     std::unique_ptr<ITensorHandle> inputHandle2 =
-            subTensorsSupported ?
-            tensorHandleFactory.CreateSubTensorHandle(*outputHandle, inputTensorInfo2.GetShape(), wOrigin2.data()) :
-            tensorHandleFactory.CreateTensorHandle(inputTensorInfo2);
+            CreateSubTensorHandleOrTensorHandle(tensorHandleFactory, subTensorsSupported,
+                                                *outputHandle, inputTensorInfo2, wOrigin2.data());
 
     ConcatQueueDescriptor data;
     WorkloadInfo info;
@@ -2668,14 +2664,12 @@ LayerTestResult<uint8_t, 3> ConcatUint8Test(
     bool subTensorsSupported = workloadFactory.SupportsSubTensors();
 
     std::unique_ptr<ITensorHandle> inputHandle1 =
-        subTensorsSupported ?
-            tensorHandleFactory.CreateSubTensorHandle(*outputHandle, inputTensorInfo1.GetShape(), wOrigin1.data()) :
-            tensorHandleFactory.CreateTensorHandle(inputTensorInfo1);
+        CreateSubTensorHandleOrTensorHandle(tensorHandleFactory, subTensorsSupported,
+                                            *outputHandle, inputTensorInfo1, wOrigin1.data());
 
     std::unique_ptr<ITensorHandle> inputHandle2 =
-        subTensorsSupported ?
-            tensorHandleFactory.CreateSubTensorHandle(*outputHandle, inputTensorInfo2.GetShape(), wOrigin2.data()) :
-            tensorHandleFactory.CreateTensorHandle(inputTensorInfo2);
+        CreateSubTensorHandleOrTensorHandle(tensorHandleFactory, subTensorsSupported,
+                                            *outputHandle, inputTensorInfo2, wOrigin2.data());
 
 
     ConcatQueueDescriptor data;
@@ -2804,14 +2798,12 @@ LayerTestResult<uint16_t, 3> ConcatUint16Test(
     bool subTensorsSupported = workloadFactory.SupportsSubTensors();
 
     std::unique_ptr<ITensorHandle> inputHandle1 =
-            subTensorsSupported ?
-            tensorHandleFactory.CreateSubTensorHandle(*outputHandle, inputTensorInfo1.GetShape(), wOrigin1.data()) :
-            tensorHandleFactory.CreateTensorHandle(inputTensorInfo1);
+            CreateSubTensorHandleOrTensorHandle(tensorHandleFactory, subTensorsSupported,
+                                                *outputHandle, inputTensorInfo1, wOrigin1.data());
 
     std::unique_ptr<ITensorHandle> inputHandle2 =
-            subTensorsSupported ?
-            tensorHandleFactory.CreateSubTensorHandle(*outputHandle, inputTensorInfo2.GetShape(), wOrigin2.data()) :
-            tensorHandleFactory.CreateTensorHandle(inputTensorInfo2);
+            CreateSubTensorHandleOrTensorHandle(tensorHandleFactory, subTensorsSupported,
+                                                *outputHandle, inputTensorInfo2, wOrigin2.data());
     
 
     ConcatQueueDescriptor data;
@@ -18,6 +18,9 @@
 
 #include <test/TensorHelpers.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 namespace
 {
 
@@ -673,6 +676,89 @@ LayerTestResult<T, 4> AlignCornersResizeNearestNeighbourTest(
     return ResizeTestImpl<4, ArmnnType>(workloadFactory, memoryManager, tensorHandleFactory, testParams);
 }
 
+//
+// Upsampling
+//
+
+template<armnn::DataType ArmnnType, typename T>
+LayerTestResult<T, 4> ResizeUpsample2xTest(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    const armnn::ITensorHandleFactory& tensorHandleFactory,
+    const armnn::DataLayout dataLayout,
+    const armnn::ResizeMethod resizeMethod,
+    bool alignCorners,
+    bool halfPixelCenters,
+    float inQuantScale,
+    int32_t inQuantOffset,
+    float outQuantScale,
+    int32_t outQuantOffset)
+{
+    ResizeTestParams testParams;
+    testParams.m_ResizeMethod     = resizeMethod;
+    testParams.m_DataLayout       = dataLayout;
+    testParams.m_AlignCorners     = alignCorners;
+    testParams.m_HalfPixelCenters = halfPixelCenters;
+
+    const unsigned int batches  = 2;
+    const unsigned int channels = 3;
+    const unsigned int inSize   = 4;
+    const unsigned int outSize  = 8;
+
+    testParams.m_InputShape  = { batches, channels, inSize, inSize };
+    testParams.m_OutputShape = { batches, channels, outSize, outSize };
+
+    // The input is linear in x and y, so bilinear interpolation reproduces it exactly at the (clamped)
+    // source coordinate and the expected output can be written in closed form.
+    auto value = [](unsigned int n, unsigned int c, float y, float x)
+    {
+        return 20.0f * static_cast<float>(n) + 8.0f * static_cast<float>(c) + 4.0f * y + 2.0f * x;
+    };
+
+    const float scale = alignCorners ? static_cast<float>(inSize - 1) / static_cast<float>(outSize - 1)
+                                     : static_cast<float>(inSize) / static_cast<float>(outSize);
+    const float maxCoord = static_cast<float>(inSize - 1);
+
+    auto sourceCoordinate = [&](unsigned int i)
+    {
+        const float pixel = static_cast<float>(i);
+        if (resizeMethod == armnn::ResizeMethod::Bilinear)
+        {
+            const float coord = halfPixelCenters ? (pixel + 0.5f) * scale - 0.5f : pixel * scale;
+            return std::min(std::max(coord, 0.0f), maxCoord);
+        }
+        const float coord = halfPixelCenters ? (pixel + 0.5f) * scale : pixel * scale;
+        return std::min(alignCorners ? std::round(coord) : std::floor(coord), maxCoord);
+    };
+
+    for (unsigned int n = 0; n < batches; ++n)
+    {
+        for (unsigned int c = 0; c < channels; ++c)
+        {
+            for (unsigned int y = 0; y < inSize; ++y)
+            {
+                for (unsigned int x = 0; x < inSize; ++x)
+                {
+                    testParams.m_InputData.push_back(value(n, c, static_cast<float>(y), static_cast<float>(x)));
+                }
+            }
+            for (unsigned int y = 0; y < outSize; ++y)
+            {
+                for (unsigned int x = 0; x < outSize; ++x)
+                {
+                    testParams.m_ExpectedOutputData.push_back(
+                        value(n, c, sourceCoordinate(y), sourceCoordinate(x)));
+                }
+            }
+        }
+    }
+
+    testParams.SetInQuantParams(inQuantScale, inQuantOffset);
+    testParams.SetOutQuantParams(outQuantScale, outQuantOffset);
+
+    return ResizeTestImpl<4, ArmnnType>(workloadFactory, memoryManager, tensorHandleFactory, testParams);
+}
+
 //
 // Explicit template instantiations
 //
@@ -780,6 +866,20 @@ AlignCornersResizeNearestNeighbourTest<armnn::DataType::Float32>(
     const armnn::ITensorHandleFactory& tensorHandleFactory,
     const armnn::DataLayout dataLayout);
 
+template LayerTestResult<armnn::ResolveType<armnn::DataType::Float32>, 4>
+ResizeUpsample2xTest<armnn::DataType::Float32>(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    const armnn::ITensorHandleFactory& tensorHandleFactory,
+    const armnn::DataLayout dataLayout,
+    const armnn::ResizeMethod resizeMethod,
+    bool alignCorners,
+    bool halfPixelCenters,
+    float inQuantScale,
+    int32_t inQuantOffset,
+    float outQuantScale,
+    int32_t outQuantOffset);
+
 // Float16
 template LayerTestResult<armnn::ResolveType<armnn::DataType::Float16>, 4>
 ResizeBilinearNopTest<armnn::DataType::Float16>(
@@ -883,6 +983,20 @@ AlignCornersResizeNearestNeighbourTest<armnn::DataType::Float16>(
     const armnn::ITensorHandleFactory& tensorHandleFactory,
         const armnn::DataLayout dataLayout);
 
+template LayerTestResult<armnn::ResolveType<armnn::DataType::Float16>, 4>
+ResizeUpsample2xTest<armnn::DataType::Float16>(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    const armnn::ITensorHandleFactory& tensorHandleFactory,
+    const armnn::DataLayout dataLayout,
+    const armnn::ResizeMethod resizeMethod,
+    bool alignCorners,
+    bool halfPixelCenters,
+    float inQuantScale,
+    int32_t inQuantOffset,
+    float outQuantScale,
+    int32_t outQuantOffset);
+
 // QAsymm8
 template LayerTestResult<armnn::ResolveType<armnn::DataType::QAsymmU8>, 4>
 ResizeBilinearNopTest<armnn::DataType::QAsymmU8>(
@@ -986,6 +1100,20 @@ AlignCornersResizeNearestNeighbourTest<armnn::DataType::QAsymmS8>(
     const armnn::ITensorHandleFactory& tensorHandleFactory,
         const armnn::DataLayout dataLayout);
 
+template LayerTestResult<armnn::ResolveType<armnn::DataType::QAsymmU8>, 4>
+ResizeUpsample2xTest<armnn::DataType::QAsymmU8>(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    const armnn::ITensorHandleFactory& tensorHandleFactory,
+    const armnn::DataLayout dataLayout,
+    const armnn::ResizeMethod resizeMethod,
+    bool alignCorners,
+    bool halfPixelCenters,
+    float inQuantScale,
+    int32_t inQuantOffset,
+    float outQuantScale,
+    int32_t outQuantOffset);
+
 // QAsymmS8
 template LayerTestResult<armnn::ResolveType<armnn::DataType::QAsymmS8>, 4>
 ResizeBilinearNopTest<armnn::DataType::QAsymmS8>(
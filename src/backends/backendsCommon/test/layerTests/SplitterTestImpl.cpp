@@ -184,24 +184,20 @@ std::vector<LayerTestResult<T,3>> SplitterTestCommon(
     std::unique_ptr<armnn::ITensorHandle> inputHandle  = tensorHandleFactory.CreateTensorHandle(inputTensorInfo);
 
     std::unique_ptr<armnn::ITensorHandle> outputHandle1 =
-        subTensorsSupported ?
-        tensorHandleFactory.CreateSubTensorHandle(*inputHandle, outputTensorInfo1.GetShape(), wOrigin1.data()) :
-        tensorHandleFactory.CreateTensorHandle(outputTensorInfo1);
+        CreateSubTensorHandleOrTensorHandle(tensorHandleFactory, subTensorsSupported,
+                                            *inputHandle, outputTensorInfo1, wOrigin1.data());
 
     std::unique_ptr<armnn::ITensorHandle> outputHandle2 =
-        subTensorsSupported ?
-        tensorHandleFactory.CreateSubTensorHandle(*inputHandle, outputTensorInfo2.GetShape(), wOrigin2.data()) :
-        tensorHandleFactory.CreateTensorHandle(outputTensorInfo2);
+        CreateSubTensorHandleOrTensorHandle(tensorHandleFactory, subTensorsSupported,
+                                            *inputHandle, outputTensorInfo2, wOrigin2.data());
 
     std::unique_ptr<armnn::ITensorHandle> outputHandle3 =
-        subTensorsSupported ?
-        tensorHandleFactory.CreateSubTensorHandle(*outputHandle2, outputTensorInfo3.GetShape(), wOrigin3.data()) :
-        tensorHandleFactory.CreateTensorHandle(outputTensorInfo3);
+        CreateSubTensorHandleOrTensorHandle(tensorHandleFactory, subTensorsSupported,
+                                            *outputHandle2, outputTensorInfo3, wOrigin3.data());
 
     std::unique_ptr<armnn::ITensorHandle> outputHandle4 =
-        subTensorsSupported ?
-        tensorHandleFactory.CreateSubTensorHandle(*outputHandle2, outputTensorInfo4.GetShape(), wOrigin4.data()) :
-        tensorHandleFactory.CreateTensorHandle(outputTensorInfo4);
+        CreateSubTensorHandleOrTensorHandle(tensorHandleFactory, subTensorsSupported,
+                                            *outputHandle2, outputTensorInfo4, wOrigin4.data());
 
     // Do the first split
     armnn::SplitterQueueDescriptor data;
@@ -293,9 +289,8 @@ LayerTestResult<T, 3> CopyViaSplitterTestImpl(
     std::unique_ptr<armnn::ITensorHandle> inputHandle = tensorHandleFactory.CreateTensorHandle(tensorInfo);
 
     std::unique_ptr<armnn::ITensorHandle> outputHandle =
-        subTensorsSupported ?
-        tensorHandleFactory.CreateSubTensorHandle(*inputHandle, tensorInfo.GetShape(), origin.data()) :
-        tensorHandleFactory.CreateTensorHandle(tensorInfo);
+        CreateSubTensorHandleOrTensorHandle(tensorHandleFactory, subTensorsSupported,
+                                            *inputHandle, tensorInfo, origin.data());
 
     armnn::SplitterQueueDescriptor data;
     armnn::WorkloadInfo info;
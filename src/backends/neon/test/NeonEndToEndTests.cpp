@@ -435,6 +435,11 @@ BOOST_AUTO_TEST_CASE(NeonExportOutputWithSeveralOutputSlotConnectionsTest)
     ExportOutputWithSeveralOutputSlotConnectionsTest(defaultBackends);
 }
 
+BOOST_AUTO_TEST_CASE(NeonExportOutputReadByOtherLayersTest)
+{
+    ExportOutputReadByOtherLayersTest(defaultBackends);
+}
+
 // InstanceNormalization
 BOOST_AUTO_TEST_CASE(NeonInstanceNormalizationNchwEndToEndTest1)
 {
@@ -9,16 +9,230 @@
 #include "RefLayerSupport.hpp"
 #include "RefTensorHandleFactory.hpp"
 
+#include "workloads/RefFusedElementwiseWorkload.hpp"
+
 #include <armnn/BackendRegistry.hpp>
 #include <armnn/backends/IBackendContext.hpp>
 #include <armnn/backends/IMemoryManager.hpp>
 #include <armnn/utility/PolymorphicDowncast.hpp>
 
 #include <Optimizer.hpp>
+#include <layers/ActivationLayer.hpp>
+#include <layers/PreCompiledLayer.hpp>
+
+#include <map>
+#include <memory>
+#include <set>
 
 namespace armnn
 {
 
+namespace
+{
+
+bool GetFusedOperation(const Layer& layer, RefFusedElementwiseChain::Operation& operation)
+{
+    using Operation = RefFusedElementwiseChain::Operation;
+
+    switch (layer.GetType())
+    {
+        case LayerType::Activation:     operation = Operation::Activation;     return true;
+        case LayerType::Addition:       operation = Operation::Addition;       return true;
+        case LayerType::Division:       operation = Operation::Division;       return true;
+        case LayerType::Maximum:        operation = Operation::Maximum;        return true;
+        case LayerType::Minimum:        operation = Operation::Minimum;        return true;
+        case LayerType::Multiplication: operation = Operation::Multiplication; return true;
+        case LayerType::Subtraction:    operation = Operation::Subtraction;    return true;
+        default:                        return false;
+    }
+}
+
+/// Whether layer can be part of a fused chain: a Float32 elementwise layer whose inputs all have the shape of its
+/// output, so that a tile of the output only depends on the same tile of each input.
+bool IsFusable(const Layer& layer)
+{
+    RefFusedElementwiseChain::Operation operation;
+    if (!GetFusedOperation(layer, operation) || layer.GetNumOutputSlots() != 1)
+    {
+        return false;
+    }
+
+    const TensorInfo& outputInfo = layer.GetOutputSlot(0).GetTensorInfo();
+    if (outputInfo.GetDataType() != DataType::Float32)
+    {
+        return false;
+    }
+
+    for (unsigned int i = 0; i < layer.GetNumInputSlots(); ++i)
+    {
+        const OutputSlot* connectedSlot = layer.GetInputSlot(i).GetConnectedOutputSlot();
+        if (connectedSlot == nullptr ||
+            connectedSlot->GetTensorInfo().GetDataType() != DataType::Float32 ||
+            connectedSlot->GetTensorInfo().GetShape() != outputInfo.GetShape())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// The layer the output of layer can be fused into: its only consumer, if that is fusable and in the subgraph.
+Layer* GetNextInChain(const Layer& layer, const std::set<const Layer*>& fusableLayers)
+{
+    const OutputSlot& outputSlot = layer.GetOutputSlot(0);
+    if (outputSlot.GetNumConnections() != 1)
+    {
+        return nullptr;
+    }
+
+    Layer& consumer = outputSlot.GetConnection(0)->GetOwningLayer();
+    return fusableLayers.count(&consumer) > 0 ? &consumer : nullptr;
+}
+
+/// Replaces chain with a PreCompiled layer running it as a RefFusedElementwiseWorkload.
+void FuseChain(OptimizationViews& optimizationViews, const std::vector<Layer*>& chain)
+{
+    auto fusedChain = std::make_unique<RefFusedElementwiseChain>();
+    SubgraphView::InputSlots inputSlots;
+
+    for (unsigned int i = 0; i < chain.size(); ++i)
+    {
+        Layer& layer = *chain[i];
+
+        RefFusedElementwiseChain::Step step;
+        GetFusedOperation(layer, step.m_Operation);
+        step.m_OtherInput = 0;
+        step.m_PreviousIsFirst = true;
+        if (step.m_Operation == RefFusedElementwiseChain::Operation::Activation)
+        {
+            step.m_Activation = PolymorphicDowncast<ActivationLayer*>(&layer)->GetParameters();
+        }
+
+        // The first layer reads input 0 of the fused layer in place of a previous result
+        unsigned int previousInput = 0;
+        if (i == 0)
+        {
+            inputSlots.push_back(&layer.GetInputSlot(0));
+        }
+        else
+        {
+            previousInput = layer.GetInputSlot(0).GetConnectedOutputSlot() == &chain[i - 1]->GetOutputSlot(0) ? 0 : 1;
+        }
+
+        if (layer.GetNumInputSlots() == 2)
+        {
+            const unsigned int otherInput = 1 - previousInput;
+            step.m_OtherInput = static_cast<unsigned int>(inputSlots.size());
+            step.m_PreviousIsFirst = previousInput == 0;
+            inputSlots.push_back(&layer.GetInputSlot(otherInput));
+        }
+
+        fusedChain->m_Steps.push_back(step);
+    }
+
+    const std::string name = std::string("fused-") + chain.front()->GetName() + "-to-" + chain.back()->GetName();
+    PreCompiledLayer* preCompiledLayer = optimizationViews.GetGraph().AddLayer<PreCompiledLayer>(
+        PreCompiledDescriptor(static_cast<unsigned int>(inputSlots.size()), 1), name.c_str());
+    preCompiledLayer->SetPreCompiledObject(PreCompiledObjectPtr(fusedChain.release(), [](const void* chainPtr)
+    {
+        delete static_cast<const RefFusedElementwiseChain*>(chainPtr);
+    }));
+
+    SubgraphView substitutionSubgraph(std::move(inputSlots),
+                                      { &chain.back()->GetOutputSlot(0) },
+                                      SubgraphView::Layers(chain.begin(), chain.end()));
+    optimizationViews.AddSubstitution({ std::move(substitutionSubgraph), SubgraphView(preCompiledLayer) });
+}
+
+OptimizationViews FuseElementwiseChains(const SubgraphView& subgraph)
+{
+    OptimizationViews optimizationViews;
+
+    std::set<const Layer*> fusableLayers;
+    for (const Layer* layer : subgraph)
+    {
+        if (IsFusable(*layer))
+        {
+            fusableLayers.insert(layer);
+        }
+    }
+
+    // A chain starts at a fusable layer that no other fusable layer can be fused into. Every other fusable layer is
+    // reached from one of them, as a binary layer whose two inputs both come from chains joins only one of them.
+    std::set<const Layer*> followers;
+    for (const Layer* layer : fusableLayers)
+    {
+        if (Layer* next = GetNextInChain(*layer, fusableLayers))
+        {
+            followers.insert(next);
+        }
+    }
+
+    std::set<const Layer*> fusedLayers;
+    std::map<LayerGuid, Layer*> untouched;
+    for (Layer* layer : subgraph)
+    {
+        untouched.insert({ layer->GetGuid(), layer });
+    }
+
+    for (Layer* head : subgraph)
+    {
+        if (fusableLayers.count(head) == 0 || followers.count(head) > 0)
+        {
+            continue;
+        }
+
+        std::vector<Layer*> chain;
+        for (Layer* layer = head; layer != nullptr && fusedLayers.count(layer) == 0;
+             layer = GetNextInChain(*layer, fusableLayers))
+        {
+            chain.push_back(layer);
+            fusedLayers.insert(layer);
+        }
+
+        if (chain.size() > 1)
+        {
+            FuseChain(optimizationViews, chain);
+            for (Layer* layer : chain)
+            {
+                untouched.erase(layer->GetGuid());
+            }
+        }
+        else
+        {
+            // A single layer gains nothing from fusion and can still head the chain of a later layer
+            fusedLayers.erase(head);
+        }
+    }
+
+    if (optimizationViews.GetSubstitutions().empty())
+    {
+        optimizationViews.AddUntouchedSubgraph(SubgraphView(subgraph));
+        return optimizationViews;
+    }
+
+    for (const auto& pair : untouched)
+    {
+        Layer* layer = pair.second;
+
+        SubgraphView::InputSlots inputSlots;
+        for (auto it = layer->BeginInputSlots(); it != layer->EndInputSlots(); ++it)
+        {
+            inputSlots.push_back(&(*it));
+        }
+        SubgraphView::OutputSlots outputSlots;
+        for (auto it = layer->BeginOutputSlots(); it != layer->EndOutputSlots(); ++it)
+        {
+            outputSlots.push_back(&(*it));
+        }
+
+        optimizationViews.AddUntouchedSubgraph(SubgraphView(std::move(inputSlots), std::move(outputSlots), { layer }));
+    }
+    return optimizationViews;
+}
+
+} // anonymous namespace
+
 const BackendId& RefBackend::GetIdStatic()
 {
     static const BackendId s_Id{RefBackendId()};
@@ -42,6 +256,20 @@ IBackendInternal::IWorkloadFactoryPtr RefBackend::CreateWorkloadFactory(
     return std::make_unique<RefWorkloadFactory>(PolymorphicPointerDowncast<RefMemoryManager>(memoryManager));
 }
 
+// The reference workloads and layer support take no model options. The "CpuRef" ones only steer
+// OptimizeSubgraphView, so they must not make the base class turn the backend down.
+IBackendInternal::IWorkloadFactoryPtr RefBackend::CreateWorkloadFactory(
+    const IBackendInternal::IMemoryManagerSharedPtr& memoryManager, const ModelOptions&) const
+{
+    return CreateWorkloadFactory(memoryManager);
+}
+
+IBackendInternal::IWorkloadFactoryPtr RefBackend::CreateWorkloadFactory(
+    class TensorHandleFactoryRegistry& tensorHandleFactoryRegistry, const ModelOptions&) const
+{
+    return CreateWorkloadFactory(tensorHandleFactoryRegistry);
+}
+
 IBackendInternal::IBackendContextPtr RefBackend::CreateBackendContext(const IRuntime::CreationOptions&) const
 {
     return IBackendContextPtr{};
@@ -69,6 +297,11 @@ IBackendInternal::ILayerSupportSharedPtr RefBackend::GetLayerSupport() const
     return layerSupport;
 }
 
+IBackendInternal::ILayerSupportSharedPtr RefBackend::GetLayerSupport(const ModelOptions&) const
+{
+    return GetLayerSupport();
+}
+
 OptimizationViews RefBackend::OptimizeSubgraphView(const SubgraphView& subgraph) const
 {
     OptimizationViews optimizationViews;
@@ -78,6 +311,21 @@ OptimizationViews RefBackend::OptimizeSubgraphView(const SubgraphView& subgraph)
     return optimizationViews;
 }
 
+OptimizationViews RefBackend::OptimizeSubgraphView(const SubgraphView& subgraph,
+                                                   const ModelOptions& modelOptions) const
+{
+    bool fuseElementwiseLayers = false;
+    ParseOptions(modelOptions, GetIdStatic(), [&](std::string name, const BackendOptions::Var& value)
+    {
+        if (name == "FuseElementwiseLayers" && value.IsBool())
+        {
+            fuseElementwiseLayers = value.AsBool();
+        }
+    });
+
+    return fuseElementwiseLayers ? FuseElementwiseChains(subgraph) : OptimizeSubgraphView(subgraph);
+}
+
 std::vector<ITensorHandleFactory::FactoryId> RefBackend::GetHandleFactoryPreferences() const
 {
     return std::vector<ITensorHandleFactory::FactoryId> { RefTensorHandleFactory::GetIdStatic() };
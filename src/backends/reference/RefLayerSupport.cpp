@@ -2103,6 +2103,39 @@ bool RefLayerSupport::IsPreluSupported(const TensorInfo& input,
     return supported;
 }
 
+bool RefLayerSupport::IsTensorStatsSupported(const TensorInfo& input,
+                                             const TensorStatsDescriptor& descriptor,
+                                             Optional<std::string&> reasonIfUnsupported) const
+{
+    bool supported = true;
+
+    std::array<DataType, 8> supportedTypes =
+    {
+        DataType::BFloat16,
+        DataType::Float16,
+        DataType::Float32,
+        DataType::QAsymmS8,
+        DataType::QAsymmU8,
+        DataType::QSymmS8,
+        DataType::QSymmS16,
+        DataType::Signed32
+    };
+
+    supported &= CheckSupportRule(TypeAnyOf(input, supportedTypes), reasonIfUnsupported,
+                                  "Reference TensorStats: input type not supported");
+
+    if (descriptor.m_NumBins > 0 && !(descriptor.m_HistogramMin < descriptor.m_HistogramMax))
+    {
+        if (reasonIfUnsupported)
+        {
+            reasonIfUnsupported.value() += "Reference TensorStats: histogram minimum must be less than its maximum\n";
+        }
+        supported = false;
+    }
+
+    return supported;
+}
+
 bool RefLayerSupport::IsTransposeConvolution2dSupported(const TensorInfo& input,
                                                         const TensorInfo& output,
                                                         const TransposeConvolution2dDescriptor& descriptor,
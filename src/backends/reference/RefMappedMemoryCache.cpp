@@ -0,0 +1,96 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "RefMappedMemoryCache.hpp"
+
+#include <armnn/Logging.hpp>
+#include <armnn/utility/IgnoreUnused.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace armnn
+{
+
+RefMappedMemoryCache::~RefMappedMemoryCache()
+{
+    for (auto&& mapping : m_Mappings)
+    {
+        Unmap(mapping.second);
+    }
+    for (auto&& mapping : m_StaleMappings)
+    {
+        Unmap(mapping);
+    }
+}
+
+void* RefMappedMemoryCache::GetPointer(const FileDescriptorMemory& fdMemory, size_t numBytes)
+{
+#if defined(__unix__) || defined(__APPLE__)
+    struct stat fileStat;
+    if (fdMemory.m_Fd < 0 || fstat(fdMemory.m_Fd, &fileStat) != 0)
+    {
+        return nullptr;
+    }
+
+    const size_t end = fdMemory.m_Offset + numBytes;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    const auto key = std::make_pair(static_cast<uint64_t>(fileStat.st_dev), static_cast<uint64_t>(fileStat.st_ino));
+    auto it = m_Mappings.find(key);
+    if (it != m_Mappings.end() && end <= it->second.m_Length)
+    {
+        return static_cast<unsigned char*>(it->second.m_Address) + fdMemory.m_Offset;
+    }
+
+    // dma-bufs report no size to fstat, but give it as their end offset
+    size_t length = static_cast<size_t>(fileStat.st_size);
+    if (length == 0)
+    {
+        const off_t size = lseek(fdMemory.m_Fd, 0, SEEK_END);
+        length = size > 0 ? static_cast<size_t>(size) : 0;
+    }
+    if (end > length)
+    {
+        return nullptr;
+    }
+
+    void* address = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fdMemory.m_Fd, 0);
+    if (address == MAP_FAILED)
+    {
+        ARMNN_LOG(warning) << "RefMappedMemoryCache: Failed to map file descriptor " << fdMemory.m_Fd;
+        return nullptr;
+    }
+
+    if (it != m_Mappings.end())
+    {
+        m_StaleMappings.push_back(it->second);
+        it->second = { address, length };
+    }
+    else
+    {
+        m_Mappings.emplace(key, Mapping{ address, length });
+    }
+
+    return static_cast<unsigned char*>(address) + fdMemory.m_Offset;
+#else
+    IgnoreUnused(fdMemory, numBytes);
+    return nullptr;
+#endif
+}
+
+void RefMappedMemoryCache::Unmap(const Mapping& mapping)
+{
+#if defined(__unix__) || defined(__APPLE__)
+    munmap(mapping.m_Address, mapping.m_Length);
+#else
+    IgnoreUnused(mapping);
+#endif
+}
+
+} // namespace armnn
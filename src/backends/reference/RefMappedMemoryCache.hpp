@@ -0,0 +1,50 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/MemorySources.hpp>
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace armnn
+{
+
+// Maps the files behind the file descriptors imported by RefTensorHandles into the address space of the process.
+// Each file is mapped whole the first time it is imported and the mapping reused afterwards, so that a ring of
+// buffers in one shared memory object costs a single mmap. Files are told apart by device and inode rather than
+// by descriptor, as descriptors are duplicated and reused. The mappings last as long as the cache.
+class RefMappedMemoryCache
+{
+public:
+    RefMappedMemoryCache() = default;
+    ~RefMappedMemoryCache();
+
+    RefMappedMemoryCache(const RefMappedMemoryCache&) = delete;
+    RefMappedMemoryCache& operator=(const RefMappedMemoryCache&) = delete;
+
+    /// Returns the address of the numBytes of memory described by fdMemory, or nullptr if they cannot be mapped.
+    void* GetPointer(const FileDescriptorMemory& fdMemory, size_t numBytes);
+
+private:
+    struct Mapping
+    {
+        void* m_Address;
+        size_t m_Length;
+    };
+
+    void Unmap(const Mapping& mapping);
+
+    std::mutex m_Mutex;
+    std::map<std::pair<uint64_t, uint64_t>, Mapping> m_Mappings;
+
+    // Mappings replaced by larger ones after their file grew, which imported tensors may still point to
+    std::vector<Mapping> m_StaleMappings;
+};
+
+} // namespace armnn
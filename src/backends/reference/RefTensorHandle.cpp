@@ -4,6 +4,9 @@
 //
 #include "RefTensorHandle.hpp"
 
+#include <armnn/TypesUtils.hpp>
+#include <armnn/utility/PolymorphicDowncast.hpp>
+
 namespace armnn
 {
 
@@ -14,23 +17,45 @@ RefTensorHandle::RefTensorHandle(const TensorInfo &tensorInfo, std::shared_ptr<R
     m_UnmanagedMemory(nullptr),
     m_ImportFlags(static_cast<MemorySourceFlags>(MemorySource::Undefined)),
     m_Imported(false),
-    m_IsImportEnabled(false)
+    m_IsImportEnabled(false),
+    m_Parent(nullptr),
+    m_ParentOffset(0)
 {
 
 }
 
 RefTensorHandle::RefTensorHandle(const TensorInfo& tensorInfo,
-                                 MemorySourceFlags importFlags)
+                                 MemorySourceFlags importFlags,
+                                 std::shared_ptr<RefMappedMemoryCache> mappedMemoryCache)
                                  : m_TensorInfo(tensorInfo),
+                                   m_MappedMemoryCache(std::move(mappedMemoryCache)),
                                    m_Pool(nullptr),
                                    m_UnmanagedMemory(nullptr),
                                    m_ImportFlags(importFlags),
                                    m_Imported(false),
-                                   m_IsImportEnabled(true)
+                                   m_IsImportEnabled(true),
+                                   m_Parent(nullptr),
+                                   m_ParentOffset(0)
 {
 
 }
 
+RefTensorHandle::RefTensorHandle(const TensorInfo& subTensorInfo,
+                                 RefTensorHandle* parent,
+                                 unsigned int offsetInBytes)
+                                 : m_TensorInfo(subTensorInfo),
+                                   m_Pool(nullptr),
+                                   m_UnmanagedMemory(nullptr),
+                                   m_ImportFlags(static_cast<MemorySourceFlags>(MemorySource::Undefined)),
+                                   m_Imported(false),
+                                   m_IsImportEnabled(false),
+                                   m_Parent(parent),
+                                   m_ParentOffset(offsetInBytes)
+{
+    ARMNN_ASSERT(parent);
+    ARMNN_ASSERT(offsetInBytes + subTensorInfo.GetNumBytes() <= parent->GetTensorInfo().GetNumBytes());
+}
+
 RefTensorHandle::~RefTensorHandle()
 {
     if (!m_Pool)
@@ -45,7 +70,8 @@ RefTensorHandle::~RefTensorHandle()
 
 void RefTensorHandle::Manage()
 {
-    if (!m_IsImportEnabled)
+    // Sub-tensors use the memory of their parent
+    if (!m_IsImportEnabled && !m_Parent)
     {
         ARMNN_ASSERT_MSG(!m_Pool, "RefTensorHandle::Manage() called twice");
         ARMNN_ASSERT_MSG(!m_UnmanagedMemory, "RefTensorHandle::Manage() called after Allocate()");
@@ -56,8 +82,8 @@ void RefTensorHandle::Manage()
 
 void RefTensorHandle::Allocate()
 {
-    // If import is enabled, do not allocate the tensor
-    if (!m_IsImportEnabled)
+    // If import is enabled, do not allocate the tensor. Sub-tensors use the memory of their parent.
+    if (!m_IsImportEnabled && !m_Parent)
     {
 
         if (!m_UnmanagedMemory)
@@ -87,7 +113,11 @@ const void* RefTensorHandle::Map(bool /*unused*/) const
 
 void* RefTensorHandle::GetPointer() const
 {
-    if (m_UnmanagedMemory)
+    if (m_Parent)
+    {
+        return static_cast<unsigned char*>(m_Parent->GetPointer()) + m_ParentOffset;
+    }
+    else if (m_UnmanagedMemory)
     {
         return m_UnmanagedMemory;
     }
@@ -119,6 +149,22 @@ bool RefTensorHandle::Import(void* memory, MemorySource source)
 {
     if (m_ImportFlags & static_cast<MemorySourceFlags>(source))
     {
+        if (m_IsImportEnabled && (source == MemorySource::DmaBuf || source == MemorySource::PosixShm))
+        {
+            // The memory holds the file descriptor, whose mapping then gets imported like malloc'd memory
+            if (!memory || !m_MappedMemoryCache)
+            {
+                return false;
+            }
+            memory = m_MappedMemoryCache->GetPointer(*static_cast<const FileDescriptorMemory*>(memory),
+                                                     m_TensorInfo.GetNumBytes());
+            if (!memory)
+            {
+                return false;
+            }
+            source = MemorySource::Malloc;
+        }
+
         if (m_IsImportEnabled && source == MemorySource::Malloc)
         {
             // Check memory alignment
@@ -160,4 +206,61 @@ bool RefTensorHandle::Import(void* memory, MemorySource source)
     return false;
 }
 
+std::unique_ptr<ITensorHandle> CreateRefSubTensorHandle(ITensorHandle& parent,
+                                                        const TensorShape& subTensorShape,
+                                                        const unsigned int* subTensorOrigin)
+{
+    RefTensorHandle* refParent = PolymorphicDowncast<RefTensorHandle*>(&parent);
+    const TensorInfo& parentInfo = refParent->GetTensorInfo();
+    const TensorShape& parentShape = parentInfo.GetShape();
+
+    const unsigned int numDims = parentShape.GetNumDimensions();
+    if (subTensorShape.GetNumDimensions() != numDims)
+    {
+        return nullptr;
+    }
+
+    for (unsigned int d = 0; d < numDims; ++d)
+    {
+        if (subTensorOrigin[d] + subTensorShape[d] > parentShape[d])
+        {
+            return nullptr;
+        }
+    }
+
+    // The only dimension the sub-tensor may cover partially while staying contiguous.
+    unsigned int partialDim = 0;
+    for (unsigned int d = numDims; d-- > 0;)
+    {
+        if (subTensorShape[d] != parentShape[d])
+        {
+            partialDim = d;
+            break;
+        }
+    }
+
+    unsigned int offset = 0;
+    unsigned int stride = 1;
+    for (unsigned int d = numDims; d-- > 0;)
+    {
+        if (d > partialDim && subTensorOrigin[d] != 0)
+        {
+            return nullptr;
+        }
+        if (d < partialDim && subTensorShape[d] != 1)
+        {
+            return nullptr;
+        }
+        offset += subTensorOrigin[d] * stride;
+        stride *= parentShape[d];
+    }
+
+    TensorInfo subTensorInfo(parentInfo);
+    subTensorInfo.SetShape(subTensorShape);
+
+    return std::make_unique<RefTensorHandle>(subTensorInfo,
+                                             refParent,
+                                             offset * GetDataTypeSize(parentInfo.GetDataType()));
+}
+
 }
@@ -6,6 +6,7 @@
 
 #include <backendsCommon/CpuTensorHandle.hpp>
 
+#include "RefMappedMemoryCache.hpp"
 #include "RefMemoryManager.hpp"
 
 namespace armnn
@@ -17,7 +18,15 @@ class RefTensorHandle : public ITensorHandle
 public:
     RefTensorHandle(const TensorInfo& tensorInfo, std::shared_ptr<RefMemoryManager> &memoryManager);
 
-    RefTensorHandle(const TensorInfo& tensorInfo, MemorySourceFlags importFlags);
+    /// Creates a tensor handle for imported memory only. File descriptors are imported through mappedMemoryCache,
+    /// so importing from MemorySource::DmaBuf or MemorySource::PosixShm fails without one.
+    RefTensorHandle(const TensorInfo& tensorInfo,
+                    MemorySourceFlags importFlags,
+                    std::shared_ptr<RefMappedMemoryCache> mappedMemoryCache = nullptr);
+
+    /// Creates a sub-tensor that aliases the memory of parent, starting offsetInBytes into it. The caller
+    /// guarantees that the sub-tensor is contiguous in the parent.
+    RefTensorHandle(const TensorInfo& subTensorInfo, RefTensorHandle* parent, unsigned int offsetInBytes);
 
     ~RefTensorHandle();
 
@@ -27,7 +36,7 @@ public:
 
     virtual ITensorHandle* GetParent() const override
     {
-        return nullptr;
+        return m_Parent;
     }
 
     virtual const void* Map(bool /* blocking = true */) const override;
@@ -71,11 +80,22 @@ private:
     TensorInfo m_TensorInfo;
 
     std::shared_ptr<RefMemoryManager> m_MemoryManager;
+    std::shared_ptr<RefMappedMemoryCache> m_MappedMemoryCache;
     RefMemoryManager::Pool* m_Pool;
     mutable void* m_UnmanagedMemory;
     MemorySourceFlags m_ImportFlags;
     bool m_Imported;
     bool m_IsImportEnabled;
+    RefTensorHandle* m_Parent;
+    unsigned int m_ParentOffset;
 };
 
+/// Creates a RefTensorHandle aliasing the region of parent that starts at subTensorOrigin. Reference workloads
+/// expect dense tensors, so this returns nullptr unless the region is contiguous in the parent, i.e. it only
+/// partially covers one dimension, covers all of the dimensions inside it and is one element wide in the
+/// dimensions outside it.
+std::unique_ptr<ITensorHandle> CreateRefSubTensorHandle(ITensorHandle& parent,
+                                                        const TensorShape& subTensorShape,
+                                                        const unsigned int* subTensorOrigin);
+
 }
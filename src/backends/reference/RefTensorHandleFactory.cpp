@@ -23,8 +23,7 @@ std::unique_ptr<ITensorHandle> RefTensorHandleFactory::CreateSubTensorHandle(ITe
                                                                              TensorShape const& subTensorShape,
                                                                              unsigned int const* subTensorOrigin) const
 {
-    IgnoreUnused(parent, subTensorShape, subTensorOrigin);
-    return nullptr;
+    return CreateRefSubTensorHandle(parent, subTensorShape, subTensorOrigin);
 }
 
 std::unique_ptr<ITensorHandle> RefTensorHandleFactory::CreateTensorHandle(const TensorInfo& tensorInfo) const
@@ -48,7 +47,7 @@ std::unique_ptr<ITensorHandle> RefTensorHandleFactory::CreateTensorHandle(const
     }
     else
     {
-        return std::make_unique<RefTensorHandle>(tensorInfo, m_ImportFlags);
+        return std::make_unique<RefTensorHandle>(tensorInfo, m_ImportFlags, m_MappedMemoryCache);
     }
 }
 
@@ -63,7 +62,7 @@ std::unique_ptr<ITensorHandle> RefTensorHandleFactory::CreateTensorHandle(const
     }
     else
     {
-        return std::make_unique<RefTensorHandle>(tensorInfo, m_ImportFlags);
+        return std::make_unique<RefTensorHandle>(tensorInfo, m_ImportFlags, m_MappedMemoryCache);
     }
 }
 
@@ -74,7 +73,7 @@ const FactoryId& RefTensorHandleFactory::GetId() const
 
 bool RefTensorHandleFactory::SupportsSubTensors() const
 {
-    return false;
+    return true;
 }
 
 MemorySourceFlags RefTensorHandleFactory::GetExportFlags() const
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include "RefMappedMemoryCache.hpp"
 #include "RefMemoryManager.hpp"
 
 #include <armnn/backends/ITensorHandleFactory.hpp>
@@ -20,7 +21,8 @@ class RefTensorHandleFactory : public ITensorHandleFactory
 public:
     RefTensorHandleFactory(std::shared_ptr<RefMemoryManager> mgr)
     : m_MemoryManager(mgr),
-      m_ImportFlags(static_cast<MemorySourceFlags>(MemorySource::Malloc)),
+      m_MappedMemoryCache(std::make_shared<RefMappedMemoryCache>()),
+      m_ImportFlags(Combine(MemorySource::Malloc, MemorySource::DmaBuf, MemorySource::PosixShm)),
       m_ExportFlags(static_cast<MemorySourceFlags>(MemorySource::Malloc))
     {}
 
@@ -52,6 +54,7 @@ public:
 
 private:
     mutable std::shared_ptr<RefMemoryManager> m_MemoryManager;
+    std::shared_ptr<RefMappedMemoryCache> m_MappedMemoryCache;
     MemorySourceFlags m_ImportFlags;
     MemorySourceFlags m_ExportFlags;
 
@@ -111,6 +111,13 @@ bool RefWorkloadFactory::IsLayerSupported(const IConnectableLayer& layer,
     return IWorkloadFactory::IsLayerSupported(s_Id, layer, dataType, outReasonIfUnsupported, modelOptions);
 }
 
+std::unique_ptr<ITensorHandle> RefWorkloadFactory::CreateSubTensorHandle(ITensorHandle& parent,
+                                                                         TensorShape const& subTensorShape,
+                                                                         unsigned int const* subTensorOrigin) const
+{
+    return CreateRefSubTensorHandle(parent, subTensorShape, subTensorOrigin);
+}
+
 std::unique_ptr<ITensorHandle> RefWorkloadFactory::CreateTensorHandle(const TensorInfo& tensorInfo,
                                                                       const bool isMemoryManaged) const
 {
@@ -550,10 +557,15 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreatePooling2d(const Pooling2dQu
     return std::make_unique<RefPooling2dWorkload>(descriptor, info);
 }
 
-std::unique_ptr<IWorkload> RefWorkloadFactory::CreatePreCompiled(const PreCompiledQueueDescriptor& /*descriptor*/,
-                                                                 const WorkloadInfo& /*info*/) const
+std::unique_ptr<IWorkload> RefWorkloadFactory::CreatePreCompiled(const PreCompiledQueueDescriptor& descriptor,
+                                                                 const WorkloadInfo& info) const
 {
-    return nullptr;
+    // The only layers the reference backend pre-compiles are the elementwise chains fused by OptimizeSubgraphView
+    if (descriptor.m_PreCompiledObject == nullptr)
+    {
+        return nullptr;
+    }
+    return std::make_unique<RefFusedElementwiseWorkload>(descriptor, info);
 }
 
 std::unique_ptr<IWorkload> RefWorkloadFactory::CreatePrelu(const PreluQueueDescriptor& descriptor,
@@ -669,6 +681,12 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreateSubtraction(const Subtracti
     }
 }
 
+std::unique_ptr<IWorkload> RefWorkloadFactory::CreateTensorStats(const TensorStatsQueueDescriptor& descriptor,
+                                                                 const WorkloadInfo& info) const
+{
+    return std::make_unique<RefTensorStatsWorkload>(descriptor, info);
+}
+
 std::unique_ptr<IWorkload> RefWorkloadFactory::CreateTranspose(const TransposeQueueDescriptor& descriptor,
                                                                const WorkloadInfo& info) const
 {
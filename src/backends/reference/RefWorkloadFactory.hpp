@@ -46,16 +46,12 @@ public:
                                  std::string& outReasonIfUnsupported,
                                  const ModelOptions& modelOptions);
 
-    bool SupportsSubTensors() const override { return false; }
+    bool SupportsSubTensors() const override { return true; }
 
     ARMNN_DEPRECATED_MSG("Use ITensorHandleFactory::CreateSubTensorHandle instead")
     std::unique_ptr<ITensorHandle> CreateSubTensorHandle(ITensorHandle& parent,
                                                          TensorShape const& subTensorShape,
-                                                         unsigned int const* subTensorOrigin) const override
-    {
-        IgnoreUnused(parent, subTensorShape, subTensorOrigin);
-        return nullptr;
-    }
+                                                         unsigned int const* subTensorOrigin) const override;
 
     ARMNN_DEPRECATED_MSG("Use ITensorHandleFactory::CreateTensorHandle instead")
     std::unique_ptr<ITensorHandle> CreateTensorHandle(const TensorInfo& tensorInfo,
@@ -261,6 +257,9 @@ public:
     std::unique_ptr<IWorkload> CreateSubtraction(const SubtractionQueueDescriptor& descriptor,
                                                  const WorkloadInfo& info) const override;
 
+    std::unique_ptr<IWorkload> CreateTensorStats(const TensorStatsQueueDescriptor& descriptor,
+                                                 const WorkloadInfo& info) const override;
+
     std::unique_ptr<IWorkload> CreateTranspose(const TransposeQueueDescriptor& descriptor,
                                                const WorkloadInfo& info) const override;
 
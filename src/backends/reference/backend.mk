@@ -16,6 +16,7 @@ ifeq ($(ARMNN_REF_ENABLED),1)
 BACKEND_SOURCES := \
         RefBackend.cpp \
         RefLayerSupport.cpp \
+        RefMappedMemoryCache.cpp \
         RefMemoryManager.cpp \
         RefTensorHandle.cpp \
         RefWorkloadFactory.cpp \
@@ -27,6 +28,7 @@ BACKEND_SOURCES := \
         workloads/BatchToSpaceNd.cpp \
         workloads/Broadcast.cpp \
         workloads/ConvImpl.cpp \
+        workloads/ConvKernels.cpp \
         workloads/Debug.cpp \
         workloads/DepthToSpace.cpp \
         workloads/DetectionPostProcess.cpp \
@@ -66,6 +68,7 @@ BACKEND_SOURCES := \
         workloads/RefFillWorkload.cpp \
         workloads/RefFloorWorkload.cpp \
         workloads/RefFullyConnectedWorkload.cpp \
+        workloads/RefFusedElementwiseWorkload.cpp \
         workloads/RefGatherWorkload.cpp \
         workloads/RefInstanceNormalizationWorkload.cpp \
         workloads/RefL2NormalizationWorkload.cpp \
@@ -91,6 +94,7 @@ BACKEND_SOURCES := \
         workloads/RefStackWorkload.cpp \
         workloads/RefStridedSliceWorkload.cpp \
         workloads/RefSplitterWorkload.cpp \
+        workloads/RefTensorStatsWorkload.cpp \
         workloads/RefTransposeConvolution2dWorkload.cpp \
         workloads/RefTransposeWorkload.cpp \
         workloads/Resize.cpp \
@@ -102,6 +106,8 @@ BACKEND_SOURCES := \
         workloads/StringMapping.cpp \
         workloads/Softmax.cpp \
         workloads/Splitter.cpp \
+        workloads/TensorStats.cpp \
+        workloads/TensorViewCopy.cpp \
         workloads/TransposeConvolution2d.cpp
 else
 
@@ -124,6 +130,8 @@ ifeq ($(ARMNN_REF_ENABLED),1)
 
 BACKEND_TEST_SOURCES := \
         test/ArgMinMaxTests.cpp \
+        test/BroadcastTests.cpp \
+        test/ConvKernelsTests.cpp \
         test/RefCreateWorkloadTests.cpp \
         test/RefDetectionPostProcessTests.cpp \
         test/RefEndToEndTests.cpp \
@@ -133,7 +141,8 @@ BACKEND_TEST_SOURCES := \
         test/RefMemoryManagerTests.cpp \
         test/RefOptimizedNetworkTests.cpp \
         test/RefRuntimeTests.cpp \
-        test/RefTensorHandleTests.cpp
+        test/RefTensorHandleTests.cpp \
+        test/TensorViewCopyTests.cpp
 else
 
 # ARMNN_REF_ENABLED == 0
@@ -0,0 +1,103 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <reference/workloads/Broadcast.hpp>
+#include <reference/workloads/Decoders.hpp>
+#include <reference/workloads/Encoders.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <functional>
+
+using namespace armnn;
+
+namespace
+{
+
+// Runs the typed loop and the Decoder/Encoder loop over the same data and checks that they agree with each other
+// and with the expected output.
+void CheckBroadcast(const TensorShape& shape0,
+                    const TensorShape& shape1,
+                    const TensorShape& outShape,
+                    BroadcastPattern expectedPattern)
+{
+    BroadcastLoop loop(shape0, shape1, outShape);
+    BOOST_TEST((loop.GetPattern() == expectedPattern));
+
+    std::vector<float> input0(shape0.GetNumElements());
+    std::vector<float> input1(shape1.GetNumElements());
+    for (unsigned int i = 0; i < input0.size(); ++i)
+    {
+        input0[i] = static_cast<float>(i);
+    }
+    for (unsigned int i = 0; i < input1.size(); ++i)
+    {
+        input1[i] = 1000.0f * static_cast<float>(i + 1);
+    }
+
+    // Reference result computed from the full coordinates of every output element.
+    const unsigned int numDims = outShape.GetNumDimensions();
+    std::vector<float> expected(outShape.GetNumElements());
+    for (unsigned int flat = 0; flat < expected.size(); ++flat)
+    {
+        unsigned int remainder = flat;
+        unsigned int index0 = 0;
+        unsigned int index1 = 0;
+        unsigned int stride0 = 1;
+        unsigned int stride1 = 1;
+        for (unsigned int d = numDims; d-- > 0;)
+        {
+            const unsigned int coord = remainder % outShape[d];
+            remainder /= outShape[d];
+            index0 += (shape0[d] > 1 ? coord : 0) * stride0;
+            index1 += (shape1[d] > 1 ? coord : 0) * stride1;
+            stride0 *= shape0[d];
+            stride1 *= shape1[d];
+        }
+        expected[flat] = input0[index0] + input1[index1];
+    }
+
+    std::vector<float> typedOutput(expected.size());
+    loop.Unroll(std::plus<float>(), input0.data(), input1.data(), typedOutput.data());
+    BOOST_CHECK_EQUAL_COLLECTIONS(typedOutput.begin(), typedOutput.end(), expected.begin(), expected.end());
+
+    std::vector<float> decodedOutput(expected.size());
+    auto decoder0 = MakeDecoder<float>(TensorInfo(shape0, DataType::Float32), input0.data());
+    auto decoder1 = MakeDecoder<float>(TensorInfo(shape1, DataType::Float32), input1.data());
+    auto encoder  = MakeEncoder<float>(TensorInfo(outShape, DataType::Float32), decodedOutput.data());
+    loop.Unroll(std::plus<float>(), 0, *decoder0, *decoder1, *encoder);
+    BOOST_CHECK_EQUAL_COLLECTIONS(decodedOutput.begin(), decodedOutput.end(), expected.begin(), expected.end());
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(RefBroadcast)
+
+BOOST_AUTO_TEST_CASE(BroadcastSameShape)
+{
+    CheckBroadcast({ 2, 3, 4, 5 }, { 2, 3, 4, 5 }, { 2, 3, 4, 5 }, BroadcastPattern::SameShape);
+}
+
+BOOST_AUTO_TEST_CASE(BroadcastScalar)
+{
+    CheckBroadcast({ 2, 3, 4, 5 }, { 1, 1, 1, 1 }, { 2, 3, 4, 5 }, BroadcastPattern::Scalar);
+    CheckBroadcast({ 1, 1, 1, 1 }, { 2, 3, 4, 5 }, { 2, 3, 4, 5 }, BroadcastPattern::Scalar);
+}
+
+BOOST_AUTO_TEST_CASE(BroadcastPerChannel)
+{
+    // NHWC bias
+    CheckBroadcast({ 2, 3, 4, 5 }, { 1, 1, 1, 5 }, { 2, 3, 4, 5 }, BroadcastPattern::PerChannel);
+    CheckBroadcast({ 1, 1, 4, 5 }, { 2, 3, 4, 5 }, { 2, 3, 4, 5 }, BroadcastPattern::PerChannel);
+}
+
+BOOST_AUTO_TEST_CASE(BroadcastGeneral)
+{
+    // NCHW per-channel scale and an outer product
+    CheckBroadcast({ 2, 3, 4, 5 }, { 1, 3, 1, 1 }, { 2, 3, 4, 5 }, BroadcastPattern::General);
+    CheckBroadcast({ 1, 3, 2, 1 }, { 1, 1, 2, 3 }, { 1, 3, 2, 3 }, BroadcastPattern::General);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
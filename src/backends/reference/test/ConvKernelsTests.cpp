@@ -0,0 +1,251 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <reference/workloads/ConvImpl.hpp>
+#include <reference/workloads/ConvKernels.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <armnnUtils/DataLayoutIndexed.hpp>
+
+using namespace armnn;
+
+namespace
+{
+
+std::vector<float> MakeData(unsigned int size, unsigned int seed)
+{
+    std::vector<float> data(size);
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        // Small varied values, so that float rounding stays far below the comparison tolerance.
+        data[i] = static_cast<float>(static_cast<int>((i * 7 + seed * 13) % 17) - 8) * 0.125f;
+    }
+    return data;
+}
+
+TensorShape MakeShape(DataLayout dataLayout, unsigned int n, unsigned int c, unsigned int h, unsigned int w)
+{
+    return dataLayout == DataLayout::NHWC ? TensorShape({ n, h, w, c }) : TensorShape({ n, c, h, w });
+}
+
+// Output of the generic Convolve for the same arguments, used as the reference for the specialised kernels.
+std::vector<float> ConvolveGeneric(const TensorShape& inputShape,
+                                   const std::vector<float>& input,
+                                   const TensorShape& outputShape,
+                                   const TensorShape& filterShape,
+                                   const std::vector<float>& filter,
+                                   const std::vector<float>& bias,
+                                   DataLayout dataLayout,
+                                   unsigned int padTop,
+                                   unsigned int padLeft,
+                                   unsigned int strideX,
+                                   unsigned int strideY,
+                                   bool depthwise)
+{
+    std::vector<float> output(outputShape.GetNumElements());
+    Float32Decoder inputDecoder(input.data());
+    Float32Decoder filterDecoder(filter.data());
+    Float32Decoder biasDecoder(bias.data());
+    Float32Encoder outputEncoder(output.data());
+
+    Convolve(inputShape, inputDecoder, outputShape, outputEncoder, filterShape, filterDecoder,
+             !bias.empty(), &biasDecoder, dataLayout, padTop, padLeft, strideX, strideY, 1, 1, depthwise);
+    return output;
+}
+
+void CheckConvolution(DataLayout dataLayout,
+                      unsigned int filterSize,
+                      unsigned int padding,
+                      unsigned int inputHeight,
+                      unsigned int inputWidth,
+                      bool biasEnabled,
+                      ConvolutionKernel expectedKernel)
+{
+    const unsigned int batches = 2;
+    const unsigned int inputChannels = 3;
+    const unsigned int outputChannels = 4;
+    const unsigned int outputHeight = inputHeight + 2 * padding - filterSize + 1;
+    const unsigned int outputWidth = inputWidth + 2 * padding - filterSize + 1;
+
+    const TensorShape inputShape  = MakeShape(dataLayout, batches, inputChannels, inputHeight, inputWidth);
+    const TensorShape outputShape = MakeShape(dataLayout, batches, outputChannels, outputHeight, outputWidth);
+    const TensorShape filterShape = MakeShape(dataLayout, outputChannels, inputChannels, filterSize, filterSize);
+
+    Convolution2dDescriptor descriptor;
+    descriptor.m_PadTop = descriptor.m_PadBottom = descriptor.m_PadLeft = descriptor.m_PadRight = padding;
+    descriptor.m_StrideX = descriptor.m_StrideY = 1;
+    descriptor.m_BiasEnabled = biasEnabled;
+    descriptor.m_DataLayout = dataLayout;
+
+    const TensorInfo inputInfo(inputShape, DataType::Float32);
+    const TensorInfo outputInfo(outputShape, DataType::Float32);
+    const TensorInfo filterInfo(filterShape, DataType::Float32);
+    const TensorInfo biasInfo({ outputChannels }, DataType::Float32);
+
+    const ConvolutionKernel kernel =
+        SelectConvolution2dKernel(descriptor, inputInfo, filterInfo, outputInfo, biasEnabled ? &biasInfo : nullptr);
+    BOOST_TEST((kernel == expectedKernel));
+
+    const std::vector<float> input  = MakeData(inputShape.GetNumElements(), 1);
+    const std::vector<float> filter = MakeData(filterShape.GetNumElements(), 2);
+    const std::vector<float> bias   = biasEnabled ? MakeData(outputChannels, 3) : std::vector<float>();
+
+    const std::vector<float> expected = ConvolveGeneric(inputShape, input, outputShape, filterShape, filter, bias,
+                                                        dataLayout, padding, padding, 1, 1, false);
+
+    std::vector<float> output(outputShape.GetNumElements(), -1000.0f);
+    const float* biasData = biasEnabled ? bias.data() : nullptr;
+    if (kernel == ConvolutionKernel::Pointwise)
+    {
+        PointwiseConvolution(inputShape, input.data(), outputShape, output.data(), filter.data(), biasData,
+                             dataLayout);
+    }
+    else
+    {
+        std::vector<float> scratch(GetWinograd3x3ScratchSize(inputShape, outputShape, dataLayout));
+        Winograd3x3Convolution(inputShape, input.data(), outputShape, output.data(),
+                               TransformWinograd3x3Filter(filterShape, filter.data(), dataLayout),
+                               biasData, dataLayout, padding, padding, scratch);
+    }
+
+    for (unsigned int i = 0; i < output.size(); ++i)
+    {
+        BOOST_TEST(output[i] == expected[i], boost::test_tools::tolerance(0.0001f));
+    }
+}
+
+void CheckDepthwiseConvolution(DataLayout dataLayout,
+                               unsigned int padding,
+                               unsigned int stride,
+                               unsigned int depthMultiplier,
+                               bool biasEnabled)
+{
+    const unsigned int batches = 2;
+    const unsigned int channels = 3;
+    const unsigned int inputHeight = 7;
+    const unsigned int inputWidth = 6;
+    const unsigned int outputHeight = (inputHeight + 2 * padding - 3) / stride + 1;
+    const unsigned int outputWidth = (inputWidth + 2 * padding - 3) / stride + 1;
+    const unsigned int outputChannels = channels * depthMultiplier;
+
+    const TensorShape inputShape  = MakeShape(dataLayout, batches, channels, inputHeight, inputWidth);
+    const TensorShape outputShape = MakeShape(dataLayout, batches, outputChannels, outputHeight, outputWidth);
+    const TensorShape filterShape({ depthMultiplier, channels, 3, 3 });
+
+    DepthwiseConvolution2dDescriptor descriptor;
+    descriptor.m_PadTop = descriptor.m_PadBottom = descriptor.m_PadLeft = descriptor.m_PadRight = padding;
+    descriptor.m_StrideX = descriptor.m_StrideY = stride;
+    descriptor.m_BiasEnabled = biasEnabled;
+    descriptor.m_DataLayout = dataLayout;
+
+    const TensorInfo biasInfo({ outputChannels }, DataType::Float32);
+    BOOST_TEST((SelectDepthwiseConvolution2dKernel(descriptor,
+                                                   TensorInfo(inputShape, DataType::Float32),
+                                                   TensorInfo(filterShape, DataType::Float32),
+                                                   TensorInfo(outputShape, DataType::Float32),
+                                                   biasEnabled ? &biasInfo : nullptr)
+                == ConvolutionKernel::Depthwise3x3));
+
+    const std::vector<float> input  = MakeData(inputShape.GetNumElements(), 4);
+    const std::vector<float> filter = MakeData(filterShape.GetNumElements(), 5);
+    const std::vector<float> bias   = biasEnabled ? MakeData(outputChannels, 6) : std::vector<float>();
+
+    const std::vector<float> expected = ConvolveGeneric(inputShape, input, outputShape, filterShape, filter, bias,
+                                                        dataLayout, padding, padding, stride, stride, true);
+
+    std::vector<float> output(outputShape.GetNumElements(), -1000.0f);
+    Depthwise3x3Convolution(inputShape, input.data(), outputShape, output.data(), filterShape, filter.data(),
+                            biasEnabled ? bias.data() : nullptr, dataLayout, padding, padding, stride, stride);
+
+    for (unsigned int i = 0; i < output.size(); ++i)
+    {
+        BOOST_TEST(output[i] == expected[i], boost::test_tools::tolerance(0.0001f));
+    }
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(RefConvKernels)
+
+BOOST_AUTO_TEST_CASE(PointwiseNhwc)
+{
+    CheckConvolution(DataLayout::NHWC, 1, 0, 5, 4, true, ConvolutionKernel::Pointwise);
+}
+
+BOOST_AUTO_TEST_CASE(PointwiseNchw)
+{
+    CheckConvolution(DataLayout::NCHW, 1, 0, 5, 4, false, ConvolutionKernel::Pointwise);
+}
+
+BOOST_AUTO_TEST_CASE(Winograd3x3EvenOutputNhwc)
+{
+    CheckConvolution(DataLayout::NHWC, 3, 1, 6, 8, true, ConvolutionKernel::Winograd3x3);
+}
+
+BOOST_AUTO_TEST_CASE(Winograd3x3OddOutputNchw)
+{
+    // Partial tiles on the bottom and right edges
+    CheckConvolution(DataLayout::NCHW, 3, 0, 7, 5, true, ConvolutionKernel::Winograd3x3);
+}
+
+BOOST_AUTO_TEST_CASE(Winograd3x3LargePaddingNchw)
+{
+    CheckConvolution(DataLayout::NCHW, 3, 2, 4, 3, false, ConvolutionKernel::Winograd3x3);
+}
+
+BOOST_AUTO_TEST_CASE(Depthwise3x3Nhwc)
+{
+    CheckDepthwiseConvolution(DataLayout::NHWC, 1, 1, 1, true);
+}
+
+BOOST_AUTO_TEST_CASE(Depthwise3x3Stride2Nchw)
+{
+    CheckDepthwiseConvolution(DataLayout::NCHW, 1, 2, 2, true);
+}
+
+BOOST_AUTO_TEST_CASE(Depthwise3x3NoPaddingNchw)
+{
+    CheckDepthwiseConvolution(DataLayout::NCHW, 0, 1, 2, false);
+}
+
+BOOST_AUTO_TEST_CASE(Depthwise3x3LargePaddingNhwc)
+{
+    // Windows can cover the padding on both sides of the input at once
+    CheckDepthwiseConvolution(DataLayout::NHWC, 3, 1, 1, false);
+}
+
+BOOST_AUTO_TEST_CASE(GenericFallback)
+{
+    const TensorInfo inputInfo({ 1, 5, 5, 2 }, DataType::Float32);
+    const TensorInfo outputInfo({ 1, 3, 3, 2 }, DataType::Float32);
+
+    Convolution2dDescriptor descriptor;
+    descriptor.m_DataLayout = DataLayout::NHWC;
+
+    // Quantized tensors
+    const TensorInfo quantizedInput({ 1, 5, 5, 2 }, DataType::QAsymmU8, 0.5f, 0);
+    const TensorInfo filter3x3({ 2, 3, 3, 2 }, DataType::Float32);
+    BOOST_TEST((SelectConvolution2dKernel(descriptor, quantizedInput, filter3x3, outputInfo, nullptr)
+                == ConvolutionKernel::Generic));
+
+    // Dilated 3x3
+    descriptor.m_DilationX = 2;
+    BOOST_TEST((SelectConvolution2dKernel(descriptor, inputInfo, filter3x3, TensorInfo({ 1, 3, 1, 2 },
+                DataType::Float32), nullptr) == ConvolutionKernel::Generic));
+    descriptor.m_DilationX = 1;
+
+    // Strided 1x1 and 5x5 filters
+    descriptor.m_StrideX = 2;
+    const TensorInfo filter1x1({ 2, 1, 1, 2 }, DataType::Float32);
+    BOOST_TEST((SelectConvolution2dKernel(descriptor, inputInfo, filter1x1, outputInfo, nullptr)
+                == ConvolutionKernel::Generic));
+    descriptor.m_StrideX = 1;
+    const TensorInfo filter5x5({ 2, 5, 5, 2 }, DataType::Float32);
+    BOOST_TEST((SelectConvolution2dKernel(descriptor, inputInfo, filter5x5, TensorInfo({ 1, 1, 1, 2 },
+                DataType::Float32), nullptr) == ConvolutionKernel::Generic));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -554,6 +554,23 @@ BOOST_AUTO_TEST_CASE(RefConcatEndToEndDim3Uint8Test)
     ConcatDim3EndToEnd<armnn::DataType::QAsymmU8>(defaultBackends);
 }
 
+BOOST_AUTO_TEST_CASE(RefConcatOfActivationsEndToEndDim0Test)
+{
+    // Contiguous views: the activations write into the concat output through sub-tensors
+    ConcatOfActivationsEndToEnd<armnn::DataType::Float32>(defaultBackends, 0);
+}
+
+BOOST_AUTO_TEST_CASE(RefConcatOfActivationsEndToEndDim1Uint8Test)
+{
+    ConcatOfActivationsEndToEnd<armnn::DataType::QAsymmU8>(defaultBackends, 1);
+}
+
+BOOST_AUTO_TEST_CASE(RefConcatOfActivationsEndToEndDim3Test)
+{
+    // Non-contiguous views fall back to copying in the concat workload
+    ConcatOfActivationsEndToEnd<armnn::DataType::Float32>(defaultBackends, 3);
+}
+
 BOOST_AUTO_TEST_CASE(RefEluEndToEndTestFloat32)
 {
     EluEndToEndTest<armnn::DataType::Float32>(defaultBackends);
@@ -1325,6 +1342,11 @@ BOOST_AUTO_TEST_CASE(RefExportOutputWithSeveralOutputSlotConnectionsTest)
     ExportOutputWithSeveralOutputSlotConnectionsTest(defaultBackends);
 }
 
+BOOST_AUTO_TEST_CASE(RefExportOutputReadByOtherLayersTest)
+{
+    ExportOutputReadByOtherLayersTest(defaultBackends);
+}
+
 BOOST_AUTO_TEST_CASE(RefStridedSliceInvalidSliceEndToEndTest)
 {
     StridedSliceInvalidSliceEndToEndTest(defaultBackends);
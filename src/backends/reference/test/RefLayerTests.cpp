@@ -608,9 +608,9 @@ ARMNN_AUTO_TEST_CASE_WITH_THF(ConcatUint8, ConcatUint8Test)
 ARMNN_AUTO_TEST_CASE_WITH_THF(ConcatUint8DifferentQParams, ConcatUint8DifferentQParamsTest)
 ARMNN_AUTO_TEST_CASE_WITH_THF(ConcatUint16, ConcatUint16Test)
 ARMNN_AUTO_TEST_CASE_WITH_THF(ConcatUint8DifferentInputOutputQParam,
-                              ConcatDifferentInputOutputQParamTest<DataType::QAsymmU8>, true)
+                              ConcatDifferentInputOutputQParamTest<DataType::QAsymmU8>, false)
 ARMNN_AUTO_TEST_CASE_WITH_THF(ConcatInt16DifferentInputOutputQParam,
-                              ConcatDifferentInputOutputQParamTest<DataType::QSymmS16>, true)
+                              ConcatDifferentInputOutputQParamTest<DataType::QSymmS16>, false)
 
 // Add
 ARMNN_AUTO_TEST_CASE_WITH_THF(SimpleAdd, AdditionTest)
@@ -1244,6 +1244,59 @@ ARMNN_AUTO_TEST_CASE_WITH_THF(AlignCornersResizeNearestNeighbourUint16Nchw,
                               AlignCornersResizeNearestNeighbourTest<DataType::QSymmS16>,
                               DataLayout::NCHW)
 
+// Resize - 2x upsampling, covers the precomputed lookup path and the Decoder fallback
+ARMNN_AUTO_TEST_CASE_WITH_THF(ResizeBilinearUpsample2xNchw,
+                              ResizeUpsample2xTest<DataType::Float32>,
+                              DataLayout::NCHW, ResizeMethod::Bilinear, false, false, 1.0f, 0, 1.0f, 0)
+ARMNN_AUTO_TEST_CASE_WITH_THF(ResizeBilinearUpsample2xAlignCornersNchw,
+                              ResizeUpsample2xTest<DataType::Float32>,
+                              DataLayout::NCHW, ResizeMethod::Bilinear, true, false, 1.0f, 0, 1.0f, 0)
+ARMNN_AUTO_TEST_CASE_WITH_THF(ResizeBilinearUpsample2xHalfPixelCentersNchw,
+                              ResizeUpsample2xTest<DataType::Float32>,
+                              DataLayout::NCHW, ResizeMethod::Bilinear, false, true, 1.0f, 0, 1.0f, 0)
+ARMNN_AUTO_TEST_CASE_WITH_THF(ResizeBilinearUpsample2xNhwc,
+                              ResizeUpsample2xTest<DataType::Float32>,
+                              DataLayout::NHWC, ResizeMethod::Bilinear, false, false, 1.0f, 0, 1.0f, 0)
+ARMNN_AUTO_TEST_CASE_WITH_THF(ResizeBilinearUpsample2xAlignCornersNhwc,
+                              ResizeUpsample2xTest<DataType::Float32>,
+                              DataLayout::NHWC, ResizeMethod::Bilinear, true, false, 1.0f, 0, 1.0f, 0)
+ARMNN_AUTO_TEST_CASE_WITH_THF(ResizeBilinearUpsample2xHalfPixelCentersNhwc,
+                              ResizeUpsample2xTest<DataType::Float32>,
+                              DataLayout::NHWC, ResizeMethod::Bilinear, false, true, 1.0f, 0, 1.0f, 0)
+ARMNN_AUTO_TEST_CASE_WITH_THF(ResizeNearestNeighborUpsample2xNchw,
+                              ResizeUpsample2xTest<DataType::Float32>,
+                              DataLayout::NCHW, ResizeMethod::NearestNeighbor, false, false, 1.0f, 0, 1.0f, 0)
+ARMNN_AUTO_TEST_CASE_WITH_THF(ResizeNearestNeighborUpsample2xAlignCornersNchw,
+                              ResizeUpsample2xTest<DataType::Float32>,
+                              DataLayout::NCHW, ResizeMethod::NearestNeighbor, true, false, 1.0f, 0, 1.0f, 0)
+ARMNN_AUTO_TEST_CASE_WITH_THF(ResizeNearestNeighborUpsample2xHalfPixelCentersNchw,
+                              ResizeUpsample2xTest<DataType::Float32>,
+                              DataLayout::NCHW, ResizeMethod::NearestNeighbor, false, true, 1.0f, 0, 1.0f, 0)
+ARMNN_AUTO_TEST_CASE_WITH_THF(ResizeNearestNeighborUpsample2xNhwc,
+                              ResizeUpsample2xTest<DataType::Float32>,
+                              DataLayout::NHWC, ResizeMethod::NearestNeighbor, false, false, 1.0f, 0, 1.0f, 0)
+ARMNN_AUTO_TEST_CASE_WITH_THF(ResizeNearestNeighborUpsample2xAlignCornersNhwc,
+                              ResizeUpsample2xTest<DataType::Float32>,
+                              DataLayout::NHWC, ResizeMethod::NearestNeighbor, true, false, 1.0f, 0, 1.0f, 0)
+ARMNN_AUTO_TEST_CASE_WITH_THF(ResizeNearestNeighborUpsample2xHalfPixelCentersNhwc,
+                              ResizeUpsample2xTest<DataType::Float32>,
+                              DataLayout::NHWC, ResizeMethod::NearestNeighbor, false, true, 1.0f, 0, 1.0f, 0)
+ARMNN_AUTO_TEST_CASE_WITH_THF(ResizeNearestNeighborUpsample2xFloat16Nhwc,
+                              ResizeUpsample2xTest<DataType::Float16>,
+                              DataLayout::NHWC, ResizeMethod::NearestNeighbor, false, false, 1.0f, 0, 1.0f, 0)
+ARMNN_AUTO_TEST_CASE_WITH_THF(ResizeNearestNeighborUpsample2xUint8Nhwc,
+                              ResizeUpsample2xTest<DataType::QAsymmU8>,
+                              DataLayout::NHWC, ResizeMethod::NearestNeighbor, false, false, 0.5f, 10, 0.5f, 10)
+ARMNN_AUTO_TEST_CASE_WITH_THF(ResizeNearestNeighborUpsample2xUint8Nchw,
+                              ResizeUpsample2xTest<DataType::QAsymmU8>,
+                              DataLayout::NCHW, ResizeMethod::NearestNeighbor, false, true, 0.5f, 10, 0.5f, 10)
+ARMNN_AUTO_TEST_CASE_WITH_THF(ResizeNearestNeighborUpsample2xUint8RequantizeNhwc,
+                              ResizeUpsample2xTest<DataType::QAsymmU8>,
+                              DataLayout::NHWC, ResizeMethod::NearestNeighbor, false, false, 1.0f, 0, 0.5f, 10)
+ARMNN_AUTO_TEST_CASE_WITH_THF(ResizeBilinearUpsample2xUint8Nhwc,
+                              ResizeUpsample2xTest<DataType::QAsymmU8>,
+                              DataLayout::NHWC, ResizeMethod::Bilinear, false, false, 0.25f, 0, 0.25f, 0)
+
 // Fake Quantization
 ARMNN_AUTO_TEST_CASE_WITH_THF(FakeQuantization, FakeQuantizationTest)
 
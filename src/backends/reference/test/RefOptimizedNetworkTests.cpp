@@ -11,6 +11,8 @@
 #include <boost/test/unit_test.hpp>
 #include <test/GraphUtils.hpp>
 
+#include <algorithm>
+
 BOOST_AUTO_TEST_SUITE(RefOptimizedNetwork)
 
 BOOST_AUTO_TEST_CASE(OptimizeValidateCpuRefWorkloads)
@@ -193,4 +195,88 @@ BOOST_AUTO_TEST_CASE(DebugTestOnCpuRef)
     BOOST_TEST(GraphHasNamedLayer(graph, "OutputLayer"));
 }
 
+BOOST_AUTO_TEST_CASE(FuseElementwiseLayersOnCpuRef)
+{
+    // Large enough for the fused workload to run over several tiles
+    const armnn::TensorInfo info({ 1, 2500 }, armnn::DataType::Float32);
+
+    //  in0  in1
+    //    \  /
+    //     ad   in2
+    //     |     |
+    //     ac    |
+    //      \   /
+    //       sb
+    //       |
+    //       ot
+    armnn::Network net;
+    armnn::IConnectableLayer* input0 = net.AddInputLayer(0, "in0");
+    armnn::IConnectableLayer* input1 = net.AddInputLayer(1, "in1");
+    armnn::IConnectableLayer* input2 = net.AddInputLayer(2, "in2");
+    armnn::IConnectableLayer* addition = net.AddAdditionLayer("ad");
+    armnn::ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = armnn::ActivationFunction::ReLu;
+    armnn::IConnectableLayer* activation = net.AddActivationLayer(activationDescriptor, "ac");
+    armnn::IConnectableLayer* subtraction = net.AddSubtractionLayer("sb");
+    armnn::IConnectableLayer* output = net.AddOutputLayer(0, "ot");
+
+    input0->GetOutputSlot(0).Connect(addition->GetInputSlot(0));
+    input1->GetOutputSlot(0).Connect(addition->GetInputSlot(1));
+    addition->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    input2->GetOutputSlot(0).Connect(subtraction->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(subtraction->GetInputSlot(1));
+    subtraction->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    for (armnn::IConnectableLayer* layer : { input0, input1, input2, addition, activation, subtraction })
+    {
+        layer->GetOutputSlot(0).SetTensorInfo(info);
+    }
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    std::vector<armnn::BackendId> backends = {armnn::Compute::CpuRef};
+
+    armnn::OptimizerOptions optimizerOptions;
+    optimizerOptions.m_ModelOptions.push_back(armnn::BackendOptions("CpuRef", {{ "FuseElementwiseLayers", true }}));
+
+    armnn::IOptimizedNetworkPtr optimizedNet = armnn::Optimize(net, backends, runtime->GetDeviceSpec(),
+                                                               optimizerOptions);
+
+    // Tests that the three elementwise layers were replaced by a single one
+    const armnn::Graph& graph = static_cast<armnn::OptimizedNetwork*>(optimizedNet.get())->GetGraph();
+    BOOST_TEST(graph.GetNumLayers() == 5);
+    BOOST_TEST(GraphHasNamedLayer(graph, "fused-ad-to-sb"));
+
+    armnn::NetworkId networkId;
+    BOOST_TEST((runtime->LoadNetwork(networkId, std::move(optimizedNet)) == armnn::Status::Success));
+
+    std::vector<float> inputData0(info.GetNumElements());
+    std::vector<float> inputData1(info.GetNumElements());
+    std::vector<float> inputData2(info.GetNumElements());
+    std::vector<float> expectedOutput(info.GetNumElements());
+    for (unsigned int i = 0; i < info.GetNumElements(); ++i)
+    {
+        inputData0[i] = static_cast<float>(i % 7) - 3.0f;
+        inputData1[i] = static_cast<float>(i % 5) - 2.0f;
+        inputData2[i] = static_cast<float>(i % 3);
+        expectedOutput[i] = inputData2[i] - std::max(inputData0[i] + inputData1[i], 0.0f);
+    }
+    std::vector<float> outputData(info.GetNumElements());
+
+    armnn::InputTensors inputTensors
+    {
+        { 0, armnn::ConstTensor(runtime->GetInputTensorInfo(networkId, 0), inputData0.data()) },
+        { 1, armnn::ConstTensor(runtime->GetInputTensorInfo(networkId, 1), inputData1.data()) },
+        { 2, armnn::ConstTensor(runtime->GetInputTensorInfo(networkId, 2), inputData2.data()) }
+    };
+    armnn::OutputTensors outputTensors
+    {
+        { 0, armnn::Tensor(runtime->GetOutputTensorInfo(networkId, 0), outputData.data()) }
+    };
+
+    BOOST_TEST((runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) == armnn::Status::Success));
+    BOOST_TEST(outputData == expectedOutput, boost::test_tools::per_element());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -7,6 +7,11 @@
 
 #include <boost/test/unit_test.hpp>
 
+#if defined(__unix__)
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
 BOOST_AUTO_TEST_SUITE(RefTensorHandleTests)
 using namespace armnn;
 
@@ -167,6 +172,73 @@ BOOST_AUTO_TEST_CASE(RefTensorHandleSupportsInPlaceComputation)
     ARMNN_ASSERT(!(handleFactory.SupportsInPlaceComputation()));
 }
 
+BOOST_AUTO_TEST_CASE(RefTensorHandleFactorySubTensors)
+{
+    std::shared_ptr<RefMemoryManager> memoryManager = std::make_shared<RefMemoryManager>();
+    RefTensorHandleFactory handleFactory(memoryManager);
+    BOOST_CHECK(handleFactory.SupportsSubTensors());
+
+    TensorInfo info({ 4, 3, 2 }, DataType::Float32);
+    auto parent = handleFactory.CreateTensorHandle(info, true);
+
+    // Rows 1 and 2 of the outermost dimension
+    const unsigned int origin[] = { 1, 0, 0 };
+    auto subTensor = handleFactory.CreateSubTensorHandle(*parent, TensorShape({ 2, 3, 2 }), origin);
+    BOOST_CHECK(subTensor);
+    BOOST_CHECK(subTensor->GetParent() == parent.get());
+    BOOST_CHECK(subTensor->GetShape() == TensorShape({ 2, 3, 2 }));
+
+    // Nested sub-tensors chain their offsets: element { 2, 1, 0 } of the parent
+    const unsigned int nestedOrigin[] = { 1, 1, 0 };
+    auto nestedSubTensor = handleFactory.CreateSubTensorHandle(*subTensor, TensorShape({ 1, 2, 2 }), nestedOrigin);
+    BOOST_CHECK(nestedSubTensor);
+
+    // Sub-tensors take part in memory management through their parent only
+    subTensor->Manage();
+    nestedSubTensor->Manage();
+    parent->Manage();
+    parent->Allocate();
+    subTensor->Allocate();
+    nestedSubTensor->Allocate();
+
+    memoryManager->Acquire();
+    {
+        const float* parentBuffer = reinterpret_cast<const float*>(parent->Map());
+        BOOST_CHECK(reinterpret_cast<const float*>(subTensor->Map()) == parentBuffer + 6);
+        BOOST_CHECK(reinterpret_cast<const float*>(nestedSubTensor->Map()) == parentBuffer + 14);
+    }
+    memoryManager->Release();
+
+    float testPtr[12];
+    // Sub-tensors cannot import memory
+    BOOST_CHECK(!subTensor->Import(static_cast<void*>(testPtr), MemorySource::Malloc));
+}
+
+BOOST_AUTO_TEST_CASE(RefTensorHandleFactoryNonContiguousSubTensors)
+{
+    std::shared_ptr<RefMemoryManager> memoryManager = std::make_shared<RefMemoryManager>();
+    RefTensorHandleFactory handleFactory(memoryManager);
+
+    TensorInfo info({ 4, 3, 2 }, DataType::Float32);
+    auto parent = handleFactory.CreateTensorHandle(info, true);
+
+    // Partially covers two dimensions
+    const unsigned int origin0[] = { 0, 1, 0 };
+    BOOST_CHECK(!handleFactory.CreateSubTensorHandle(*parent, TensorShape({ 2, 2, 2 }), origin0));
+
+    // Offset in a dimension inside the partially covered one
+    const unsigned int origin1[] = { 1, 0, 1 };
+    BOOST_CHECK(!handleFactory.CreateSubTensorHandle(*parent, TensorShape({ 1, 3, 1 }), origin1));
+
+    // Out of bounds
+    const unsigned int origin2[] = { 3, 0, 0 };
+    BOOST_CHECK(!handleFactory.CreateSubTensorHandle(*parent, TensorShape({ 2, 3, 2 }), origin2));
+
+    // A single row of the innermost dimension is contiguous
+    const unsigned int origin3[] = { 2, 1, 0 };
+    BOOST_CHECK(handleFactory.CreateSubTensorHandle(*parent, TensorShape({ 1, 1, 2 }), origin3));
+}
+
 #if !defined(__ANDROID__)
 // Only run these tests on non Android platforms
 BOOST_AUTO_TEST_CASE(CheckSourceType)
@@ -219,6 +291,58 @@ BOOST_AUTO_TEST_CASE(MisalignedPointer)
     delete[] testPtr;
 }
 
+#if defined(__unix__)
+BOOST_AUTO_TEST_CASE(RefTensorHandleFactoryImportFileDescriptor)
+{
+    std::shared_ptr<RefMemoryManager> memoryManager = std::make_shared<RefMemoryManager>();
+    RefTensorHandleFactory handleFactory(memoryManager);
+    BOOST_CHECK(CheckFlag(handleFactory.GetImportFlags(), MemorySource::PosixShm));
+
+    // A file holding two buffers of two floats, like a ring buffer shared with another process
+    char fileName[] = "/tmp/RefTensorHandleTestsXXXXXX";
+    int fd = mkstemp(fileName);
+    BOOST_REQUIRE(fd >= 0);
+    unlink(fileName);
+
+    const float values[4] = { 1.0f, 2.0f, 3.0f, 4.0f };
+    BOOST_REQUIRE(write(fd, values, sizeof(values)) == static_cast<ssize_t>(sizeof(values)));
+
+    TensorInfo info({ 1, 1, 2, 1 }, DataType::Float32);
+    auto handle = handleFactory.CreateTensorHandle(info, false);
+
+    FileDescriptorMemory first(fd, 0);
+    BOOST_CHECK(handle->Import(&first, MemorySource::PosixShm));
+    const float* firstBuffer = reinterpret_cast<const float*>(handle->Map());
+    BOOST_CHECK(firstBuffer[0] == 1.0f);
+    BOOST_CHECK(firstBuffer[1] == 2.0f);
+
+    // The second buffer comes from the same mapping
+    FileDescriptorMemory second(fd, 2 * sizeof(float));
+    BOOST_CHECK(handle->Import(&second, MemorySource::PosixShm));
+    const float* secondBuffer = reinterpret_cast<const float*>(handle->Map());
+    BOOST_CHECK(secondBuffer == firstBuffer + 2);
+    BOOST_CHECK(secondBuffer[0] == 3.0f);
+    BOOST_CHECK(secondBuffer[1] == 4.0f);
+
+    // Writes go to the file
+    float* writableBuffer = reinterpret_cast<float*>(handle->Map());
+    writableBuffer[1] = 8.0f;
+    float readBack = 0.0f;
+    BOOST_CHECK(pread(fd, &readBack, sizeof(float), 3 * sizeof(float)) == static_cast<ssize_t>(sizeof(float)));
+    BOOST_CHECK(readBack == 8.0f);
+
+    // Past the end of the file
+    FileDescriptorMemory outOfRange(fd, 3 * sizeof(float));
+    BOOST_CHECK(!handle->Import(&outOfRange, MemorySource::PosixShm));
+
+    // Handles without a mapped memory cache cannot import file descriptors
+    RefTensorHandle unmappedHandle(info, handleFactory.GetImportFlags());
+    BOOST_CHECK(!unmappedHandle.Import(&first, MemorySource::PosixShm));
+
+    close(fd);
+}
+#endif
+
 #endif
 
 BOOST_AUTO_TEST_SUITE_END()
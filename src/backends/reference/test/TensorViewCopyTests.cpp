@@ -0,0 +1,115 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <reference/workloads/TensorViewCopy.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+
+using namespace armnn;
+
+namespace
+{
+
+unsigned int FlatIndex(const TensorShape& shape, const std::vector<unsigned int>& coords)
+{
+    unsigned int index = 0;
+    for (unsigned int d = 0; d < shape.GetNumDimensions(); ++d)
+    {
+        index = index * shape[d] + coords[d];
+    }
+    return index;
+}
+
+// Copies a view into a tensor and back out again, checking every element against its full coordinates.
+void CheckViewCopy(const TensorShape& tensorShape,
+                   const TensorShape& viewShape,
+                   const std::vector<unsigned int>& viewOrigin)
+{
+    const unsigned int numDims = tensorShape.GetNumDimensions();
+
+    std::vector<int16_t> view(viewShape.GetNumElements());
+    for (unsigned int i = 0; i < view.size(); ++i)
+    {
+        view[i] = static_cast<int16_t>(i + 1);
+    }
+
+    std::vector<int16_t> tensor(tensorShape.GetNumElements(), 0);
+    CopyViewToTensor(tensorShape, viewShape, viewOrigin, sizeof(int16_t), view.data(), tensor.data());
+
+    std::vector<unsigned int> coords(numDims, 0);
+    for (unsigned int i = 0; i < tensor.size(); ++i)
+    {
+        unsigned int remainder = i;
+        for (unsigned int d = numDims; d-- > 0;)
+        {
+            coords[d] = remainder % tensorShape[d];
+            remainder /= tensorShape[d];
+        }
+
+        bool insideView = true;
+        std::vector<unsigned int> viewCoords(numDims);
+        for (unsigned int d = 0; d < numDims; ++d)
+        {
+            insideView = insideView && coords[d] >= viewOrigin[d] && coords[d] < viewOrigin[d] + viewShape[d];
+            viewCoords[d] = coords[d] - viewOrigin[d];
+        }
+
+        const int16_t expected = insideView ? view[FlatIndex(viewShape, viewCoords)] : int16_t(0);
+        BOOST_TEST(tensor[i] == expected);
+    }
+
+    std::vector<int16_t> roundTrip(view.size(), 0);
+    CopyTensorToView(tensorShape, viewShape, viewOrigin, sizeof(int16_t), tensor.data(), roundTrip.data());
+    BOOST_TEST(roundTrip == view, boost::test_tools::per_element());
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(RefTensorViewCopy)
+
+BOOST_AUTO_TEST_CASE(ViewCopyOuterDimension)
+{
+    // The view is a single contiguous block of the tensor.
+    CheckViewCopy({ 4, 3, 5 }, { 2, 3, 5 }, { 1, 0, 0 });
+}
+
+BOOST_AUTO_TEST_CASE(ViewCopyInnerDimension)
+{
+    // One run per row of the view.
+    CheckViewCopy({ 2, 3, 5 }, { 2, 3, 2 }, { 0, 0, 3 });
+}
+
+BOOST_AUTO_TEST_CASE(ViewCopyMiddleDimension)
+{
+    CheckViewCopy({ 2, 4, 3, 2 }, { 2, 2, 3, 2 }, { 0, 1, 0, 0 });
+}
+
+BOOST_AUTO_TEST_CASE(ViewCopyAllDimensionsPartial)
+{
+    CheckViewCopy({ 3, 4, 5 }, { 2, 2, 3 }, { 1, 1, 2 });
+}
+
+BOOST_AUTO_TEST_CASE(ViewCopyWholeTensor)
+{
+    CheckViewCopy({ 2, 3, 4 }, { 2, 3, 4 }, { 0, 0, 0 });
+}
+
+BOOST_AUTO_TEST_CASE(RawCopyCompatibility)
+{
+    const TensorInfo float32({ 2, 2 }, DataType::Float32);
+    const TensorInfo quantized({ 2, 2 }, DataType::QAsymmU8, 0.5f, 10);
+    const TensorInfo requantized({ 2, 2 }, DataType::QAsymmU8, 0.25f, 10);
+    const TensorInfo perAxis({ 2, 2 }, DataType::QSymmS8, std::vector<float>{ 0.5f, 0.25f }, 0);
+
+    BOOST_TEST(IsRawCopyCompatible(float32, float32));
+    BOOST_TEST(IsRawCopyCompatible(quantized, quantized));
+    BOOST_TEST(!IsRawCopyCompatible(float32, quantized));
+    BOOST_TEST(!IsRawCopyCompatible(quantized, requantized));
+    BOOST_TEST(!IsRawCopyCompatible(perAxis, perAxis));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
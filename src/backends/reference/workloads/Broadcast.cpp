@@ -28,6 +28,8 @@ BroadcastLoop::BroadcastLoop(const TensorShape& inShape0, const TensorShape& inS
         sIn1 *= inShape1[j];
         sOut *= outShape[j];
     }
+
+    CollapseDimensions();
 }
 
 BroadcastLoop::BroadcastLoop(const TensorShape& inShape, const TensorShape& outShape)
@@ -42,11 +44,72 @@ BroadcastLoop::BroadcastLoop(const TensorShape& inShape, const TensorShape& outS
     {
         m_DimData[j].m_DimSize = outShape[j];
         m_DimData[j].m_Stride1 = (inShape[j] > 1) ? sIn : 0;
+        m_DimData[j].m_Stride2 = 0;
         m_DimData[j].m_StrideOut = sOut;
 
         sIn *= inShape[j];
         sOut *= outShape[j];
     }
+
+    CollapseDimensions();
+}
+
+void BroadcastLoop::CollapseDimensions()
+{
+    std::vector<BroadcastDimensionData> collapsed;
+    collapsed.reserve(m_DimData.size());
+
+    for (const BroadcastDimensionData& dimData : m_DimData)
+    {
+        // Dimensions of size 1 never move any of the iterators.
+        if (dimData.m_DimSize == 1)
+        {
+            continue;
+        }
+
+        // An outer dimension can be folded into the next inner one if stepping over it is the same as stepping
+        // over the whole inner dimension, for the output and for both inputs (broadcast inputs have stride 0).
+        if (!collapsed.empty())
+        {
+            BroadcastDimensionData& outer = collapsed.back();
+            if (outer.m_StrideOut == dimData.m_StrideOut * dimData.m_DimSize &&
+                outer.m_Stride1 == dimData.m_Stride1 * dimData.m_DimSize &&
+                outer.m_Stride2 == dimData.m_Stride2 * dimData.m_DimSize)
+            {
+                outer.m_DimSize  *= dimData.m_DimSize;
+                outer.m_StrideOut = dimData.m_StrideOut;
+                outer.m_Stride1   = dimData.m_Stride1;
+                outer.m_Stride2   = dimData.m_Stride2;
+                continue;
+            }
+        }
+
+        collapsed.push_back(dimData);
+    }
+
+    if (collapsed.empty())
+    {
+        // Every dimension has size 1: a single element.
+        collapsed.push_back({ 1, 1, 0, 0 });
+    }
+
+    m_DimData = std::move(collapsed);
+
+    const BroadcastDimensionData& inner = m_DimData.back();
+    if (m_DimData.size() == 1)
+    {
+        m_Pattern = (inner.m_Stride1 != 0 && inner.m_Stride2 != 0) ? BroadcastPattern::SameShape
+                                                                   : BroadcastPattern::Scalar;
+    }
+    else if (m_DimData.size() == 2 && inner.m_Stride1 != 0 && inner.m_Stride2 != 0 &&
+             (m_DimData[0].m_Stride1 == 0 || m_DimData[0].m_Stride2 == 0))
+    {
+        m_Pattern = BroadcastPattern::PerChannel;
+    }
+    else
+    {
+        m_Pattern = BroadcastPattern::General;
+    }
 }
 
 } // namespace armnn
@@ -3,6 +3,8 @@
 // SPDX-License-Identifier: MIT
 //
 
+#pragma once
+
 #include "BaseIterator.hpp"
 #include <armnn/Tensor.hpp>
 
@@ -11,23 +13,73 @@
 namespace armnn
 {
 
+/// How the inputs of a binary elementwise operation map onto its output, after collapsing contiguous dimensions.
+enum class BroadcastPattern
+{
+    SameShape,  ///< Both inputs have the same shape as the output.
+    Scalar,     ///< One input holds a single value, the other has the same shape as the output.
+    PerChannel, ///< One input is repeated along the outer dimensions of the other, e.g. a bias added per channel.
+    General
+};
+
+/// Iterates over the output of an elementwise operation and moves the inputs along with it, broadcasting where
+/// an input dimension is 1. Neighbouring dimensions that are contiguous in all tensors are collapsed into one when
+/// the loop is constructed, so the common patterns end up as one or two flat loops.
 struct BroadcastLoop
 {
     BroadcastLoop(const TensorShape& inShape0, const TensorShape& inShape1, const TensorShape& outShape);
 
     BroadcastLoop(const TensorShape& inShape, const TensorShape& outShape);
 
-    unsigned int GetNumDimensions()
+    unsigned int GetNumDimensions() const
     {
         return static_cast<unsigned int>(m_DimData.size());
     }
 
+    BroadcastPattern GetPattern() const
+    {
+        return m_Pattern;
+    }
+
+    /// Runs the operation directly on typed tensor memory. Only valid when the tensors hold InType/OutType values
+    /// without any quantization, otherwise the Decoder/Encoder overloads below must be used.
+    template <typename Func, typename InType, typename OutType>
+    void Unroll(Func operationFunc,
+                const InType* inData0,
+                const InType* inData1,
+                OutType* outData) const
+    {
+        switch (m_Pattern)
+        {
+            case BroadcastPattern::SameShape:
+            case BroadcastPattern::Scalar:
+                UnrollInnermost(operationFunc, m_DimData[0], inData0, inData1, outData);
+                break;
+            case BroadcastPattern::PerChannel:
+            {
+                const BroadcastDimensionData& outer = m_DimData[0];
+                for (unsigned int i = 0; i < outer.m_DimSize; ++i)
+                {
+                    UnrollInnermost(operationFunc,
+                                    m_DimData[1],
+                                    inData0 + i * outer.m_Stride1,
+                                    inData1 + i * outer.m_Stride2,
+                                    outData + i * outer.m_StrideOut);
+                }
+                break;
+            }
+            default:
+                UnrollStrided(operationFunc, 0, inData0, inData1, outData);
+                break;
+        }
+    }
+
     template <typename Func, typename DecoderOp, typename EncoderOp>
     void Unroll(Func operationFunc,
                 unsigned int dimension,
                 DecoderOp& inData0,
                 DecoderOp& inData1,
-                EncoderOp& outData)
+                EncoderOp& outData) const
     {
         if (dimension >= GetNumDimensions())
         {
@@ -62,7 +114,7 @@ struct BroadcastLoop
     void Unroll(Func operationFunc,
                 unsigned int dimension,
                 DecoderOp& inData,
-                EncoderOp& outData)
+                EncoderOp& outData) const
     {
         if (dimension >= GetNumDimensions())
         {
@@ -99,7 +151,77 @@ private:
         unsigned int m_Stride2;
     };
 
+    void CollapseDimensions();
+
+    template <typename Func, typename InType, typename OutType>
+    void UnrollStrided(Func operationFunc,
+                       unsigned int dimension,
+                       const InType* inData0,
+                       const InType* inData1,
+                       OutType* outData) const
+    {
+        const BroadcastDimensionData& dimData = m_DimData[dimension];
+        if (dimension + 1 == GetNumDimensions())
+        {
+            UnrollInnermost(operationFunc, dimData, inData0, inData1, outData);
+            return;
+        }
+
+        for (unsigned int i = 0; i < dimData.m_DimSize; ++i)
+        {
+            UnrollStrided(operationFunc,
+                          dimension + 1,
+                          inData0 + i * dimData.m_Stride1,
+                          inData1 + i * dimData.m_Stride2,
+                          outData + i * dimData.m_StrideOut);
+        }
+    }
+
+    // The output is always contiguous in its innermost dimension and each input either moves with it or is
+    // broadcast, so every combination gets its own plain loop that the compiler can vectorize.
+    template <typename Func, typename InType, typename OutType>
+    static void UnrollInnermost(Func operationFunc,
+                                const BroadcastDimensionData& dimData,
+                                const InType* inData0,
+                                const InType* inData1,
+                                OutType* outData)
+    {
+        const unsigned int size = dimData.m_DimSize;
+        if (dimData.m_Stride1 != 0 && dimData.m_Stride2 != 0)
+        {
+            for (unsigned int i = 0; i < size; ++i)
+            {
+                outData[i] = operationFunc(inData0[i], inData1[i]);
+            }
+        }
+        else if (dimData.m_Stride1 != 0)
+        {
+            const InType value1 = *inData1;
+            for (unsigned int i = 0; i < size; ++i)
+            {
+                outData[i] = operationFunc(inData0[i], value1);
+            }
+        }
+        else if (dimData.m_Stride2 != 0)
+        {
+            const InType value0 = *inData0;
+            for (unsigned int i = 0; i < size; ++i)
+            {
+                outData[i] = operationFunc(value0, inData1[i]);
+            }
+        }
+        else
+        {
+            const OutType value = operationFunc(*inData0, *inData1);
+            for (unsigned int i = 0; i < size; ++i)
+            {
+                outData[i] = value;
+            }
+        }
+    }
+
     std::vector<BroadcastDimensionData> m_DimData;
+    BroadcastPattern m_Pattern = BroadcastPattern::General;
 };
 
 } //namespace armnn
\ No newline at end of file
@@ -7,6 +7,9 @@
 #include "RefWorkloadUtils.hpp"
 #include "Decoders.hpp"
 #include "Encoders.hpp"
+#include "TensorViewCopy.hpp"
+
+#include <algorithm>
 
 namespace armnn
 {
@@ -15,6 +18,33 @@ void Concatenate(const ConcatQueueDescriptor &data)
 {
     const TensorInfo& outputInfo0 = GetTensorInfo(data.m_Outputs[0]);
 
+    const bool canCopyRaw = std::all_of(data.m_Inputs.begin(), data.m_Inputs.end(),
+                                        [&outputInfo0](const ITensorHandle* input)
+                                        {
+                                            return IsRawCopyCompatible(GetTensorInfo(input), outputInfo0);
+                                        });
+    if (canCopyRaw)
+    {
+        // Views are copied in reverse order so that, like below, the first view wins where views overlap.
+        const unsigned int elementSize = GetDataTypeSize(outputInfo0.GetDataType());
+        for (unsigned int viewIdx = static_cast<unsigned int>(data.m_ViewOrigins.size()); viewIdx-- > 0;)
+        {
+            // Nothing to copy for views that already alias the output tensor
+            if (data.m_Inputs[viewIdx]->GetParent() == data.m_Outputs[0])
+            {
+                continue;
+            }
+
+            CopyViewToTensor(outputInfo0.GetShape(),
+                             GetTensorInfo(data.m_Inputs[viewIdx]).GetShape(),
+                             data.m_ViewOrigins[viewIdx].m_Origin,
+                             elementSize,
+                             data.m_Inputs[viewIdx]->Map(),
+                             data.m_Outputs[0]->Map());
+        }
+        return;
+    }
+
     std::unique_ptr<Encoder<float>> encoderPtr = MakeEncoder<float>(outputInfo0, data.m_Outputs[0]->Map());
     Encoder<float>& encoder = *encoderPtr;
 
@@ -0,0 +1,499 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "ConvKernels.hpp"
+
+#include <armnn/utility/Assert.hpp>
+
+#include <armnnUtils/DataLayoutIndexed.hpp>
+
+#include <algorithm>
+
+namespace armnn
+{
+
+namespace
+{
+
+// Element strides of a 4D tensor, so that the kernels can address NCHW and NHWC data the same way.
+struct TensorStrides
+{
+    TensorStrides(const TensorShape& shape, DataLayout dataLayout)
+    {
+        const armnnUtils::DataLayoutIndexed dataLayoutIndexed(dataLayout);
+        m_Channels = shape[dataLayoutIndexed.GetChannelsIndex()];
+        m_Height   = shape[dataLayoutIndexed.GetHeightIndex()];
+        m_Width    = shape[dataLayoutIndexed.GetWidthIndex()];
+
+        m_BatchStride = m_Channels * m_Height * m_Width;
+        if (dataLayout == DataLayout::NHWC)
+        {
+            m_ChannelStride = 1;
+            m_RowStride     = m_Width * m_Channels;
+            m_ColumnStride  = m_Channels;
+        }
+        else
+        {
+            m_ChannelStride = m_Height * m_Width;
+            m_RowStride     = m_Width;
+            m_ColumnStride  = 1;
+        }
+    }
+
+    unsigned int m_Channels;
+    unsigned int m_Height;
+    unsigned int m_Width;
+
+    unsigned int m_BatchStride;
+    unsigned int m_ChannelStride;
+    unsigned int m_RowStride;
+    unsigned int m_ColumnStride;
+};
+
+bool IsFloat32(const TensorInfo& inputInfo,
+               const TensorInfo& filterInfo,
+               const TensorInfo& outputInfo,
+               const TensorInfo* biasInfo)
+{
+    return inputInfo.GetDataType() == DataType::Float32 &&
+           filterInfo.GetDataType() == DataType::Float32 &&
+           outputInfo.GetDataType() == DataType::Float32 &&
+           (biasInfo == nullptr || biasInfo->GetDataType() == DataType::Float32);
+}
+
+// First and one past the last output position whose 3-wide window, starting at position * stride - padding,
+// lies entirely inside an input of the given size.
+std::pair<unsigned int, unsigned int> GetInteriorRange(unsigned int inputSize,
+                                                       unsigned int outputSize,
+                                                       unsigned int padding,
+                                                       unsigned int stride)
+{
+    const unsigned int begin = std::min((padding + stride - 1) / stride, outputSize);
+    const unsigned int end   = inputSize + padding >= 3 ? std::min((inputSize + padding - 3) / stride + 1, outputSize)
+                                                        : 0;
+    return { begin, std::max(begin, end) };
+}
+
+} // anonymous namespace
+
+ConvolutionKernel SelectConvolution2dKernel(const Convolution2dDescriptor& descriptor,
+                                            const TensorInfo& inputInfo,
+                                            const TensorInfo& filterInfo,
+                                            const TensorInfo& outputInfo,
+                                            const TensorInfo* biasInfo)
+{
+    if (!IsFloat32(inputInfo, filterInfo, outputInfo, biasInfo))
+    {
+        return ConvolutionKernel::Generic;
+    }
+
+    const armnnUtils::DataLayoutIndexed dataLayoutIndexed(descriptor.m_DataLayout);
+    const unsigned int filterHeight = filterInfo.GetShape()[dataLayoutIndexed.GetHeightIndex()];
+    const unsigned int filterWidth  = filterInfo.GetShape()[dataLayoutIndexed.GetWidthIndex()];
+
+    const bool unitStrides = descriptor.m_StrideX == 1 && descriptor.m_StrideY == 1;
+
+    if (filterHeight == 1 && filterWidth == 1 && unitStrides &&
+        descriptor.m_PadTop == 0 && descriptor.m_PadBottom == 0 &&
+        descriptor.m_PadLeft == 0 && descriptor.m_PadRight == 0)
+    {
+        return ConvolutionKernel::Pointwise;
+    }
+
+    if (filterHeight == 3 && filterWidth == 3 && unitStrides &&
+        descriptor.m_DilationX == 1 && descriptor.m_DilationY == 1)
+    {
+        return ConvolutionKernel::Winograd3x3;
+    }
+
+    return ConvolutionKernel::Generic;
+}
+
+ConvolutionKernel SelectDepthwiseConvolution2dKernel(const DepthwiseConvolution2dDescriptor& descriptor,
+                                                     const TensorInfo& inputInfo,
+                                                     const TensorInfo& filterInfo,
+                                                     const TensorInfo& outputInfo,
+                                                     const TensorInfo* biasInfo)
+{
+    if (!IsFloat32(inputInfo, filterInfo, outputInfo, biasInfo))
+    {
+        return ConvolutionKernel::Generic;
+    }
+
+    // Depthwise filters are [M, C, H, W] whatever the data layout.
+    const TensorShape& filterShape = filterInfo.GetShape();
+    if (filterShape[2] == 3 && filterShape[3] == 3 && descriptor.m_DilationX == 1 && descriptor.m_DilationY == 1)
+    {
+        return ConvolutionKernel::Depthwise3x3;
+    }
+
+    return ConvolutionKernel::Generic;
+}
+
+void PointwiseConvolution(const TensorShape& inputShape,
+                          const float* input,
+                          const TensorShape& outputShape,
+                          float* output,
+                          const float* filter,
+                          const float* bias,
+                          DataLayout dataLayout)
+{
+    const TensorStrides in(inputShape, dataLayout);
+    const TensorStrides out(outputShape, dataLayout);
+    ARMNN_ASSERT(in.m_Height == out.m_Height && in.m_Width == out.m_Width);
+
+    // 1x1 filters are [O, I] in both layouts.
+    const unsigned int inputChannels  = in.m_Channels;
+    const unsigned int outputChannels = out.m_Channels;
+    const unsigned int numPixels      = in.m_Height * in.m_Width;
+
+    for (unsigned int b = 0; b < outputShape[0]; ++b)
+    {
+        const float* inputBatch = input + b * in.m_BatchStride;
+        float* outputBatch = output + b * out.m_BatchStride;
+
+        if (dataLayout == DataLayout::NHWC)
+        {
+            // Every output pixel is the filter matrix times the contiguous input channels of that pixel.
+            for (unsigned int p = 0; p < numPixels; ++p)
+            {
+                const float* inputPixel = inputBatch + p * inputChannels;
+                float* outputPixel = outputBatch + p * outputChannels;
+                for (unsigned int co = 0; co < outputChannels; ++co)
+                {
+                    const float* filterRow = filter + co * inputChannels;
+                    float sum = 0.0f;
+                    for (unsigned int ci = 0; ci < inputChannels; ++ci)
+                    {
+                        sum += filterRow[ci] * inputPixel[ci];
+                    }
+                    outputPixel[co] = bias ? sum + bias[co] : sum;
+                }
+            }
+        }
+        else
+        {
+            // Every output plane accumulates the input planes scaled by one filter row.
+            for (unsigned int co = 0; co < outputChannels; ++co)
+            {
+                float* outputPlane = outputBatch + co * numPixels;
+                std::fill(outputPlane, outputPlane + numPixels, 0.0f);
+
+                const float* filterRow = filter + co * inputChannels;
+                for (unsigned int ci = 0; ci < inputChannels; ++ci)
+                {
+                    const float weight = filterRow[ci];
+                    const float* inputPlane = inputBatch + ci * numPixels;
+                    for (unsigned int p = 0; p < numPixels; ++p)
+                    {
+                        outputPlane[p] += weight * inputPlane[p];
+                    }
+                }
+
+                if (bias)
+                {
+                    for (unsigned int p = 0; p < numPixels; ++p)
+                    {
+                        outputPlane[p] += bias[co];
+                    }
+                }
+            }
+        }
+    }
+}
+
+std::vector<float> TransformWinograd3x3Filter(const TensorShape& filterShape,
+                                              const float* filter,
+                                              DataLayout dataLayout)
+{
+    const armnnUtils::DataLayoutIndexed dataLayoutIndexed(dataLayout);
+    const unsigned int outputChannels = filterShape[0];
+    const unsigned int inputChannels  = filterShape[dataLayoutIndexed.GetChannelsIndex()];
+
+    // Filters are [O, 3, 3, I] for NHWC and [O, I, 3, 3] for NCHW.
+    auto filterAt = [&](unsigned int co, unsigned int ci, unsigned int y, unsigned int x)
+    {
+        return dataLayout == DataLayout::NHWC ? filter[((co * 3 + y) * 3 + x) * inputChannels + ci]
+                                              : filter[((co * inputChannels + ci) * 3 + y) * 3 + x];
+    };
+
+    // U = G g G^T, stored as 16 values per (output channel, input channel) pair.
+    std::vector<float> transformed(outputChannels * inputChannels * 16);
+    for (unsigned int co = 0; co < outputChannels; ++co)
+    {
+        for (unsigned int ci = 0; ci < inputChannels; ++ci)
+        {
+            float gg[4][3];
+            for (unsigned int x = 0; x < 3; ++x)
+            {
+                const float g0 = filterAt(co, ci, 0, x);
+                const float g1 = filterAt(co, ci, 1, x);
+                const float g2 = filterAt(co, ci, 2, x);
+                gg[0][x] = g0;
+                gg[1][x] = 0.5f * (g0 + g1 + g2);
+                gg[2][x] = 0.5f * (g0 - g1 + g2);
+                gg[3][x] = g2;
+            }
+
+            float* u = transformed.data() + (co * inputChannels + ci) * 16;
+            for (unsigned int y = 0; y < 4; ++y)
+            {
+                u[y * 4 + 0] = gg[y][0];
+                u[y * 4 + 1] = 0.5f * (gg[y][0] + gg[y][1] + gg[y][2]);
+                u[y * 4 + 2] = 0.5f * (gg[y][0] - gg[y][1] + gg[y][2]);
+                u[y * 4 + 3] = gg[y][2];
+            }
+        }
+    }
+    return transformed;
+}
+
+unsigned int GetWinograd3x3ScratchSize(const TensorShape& inputShape,
+                                       const TensorShape& outputShape,
+                                       DataLayout dataLayout)
+{
+    const TensorStrides in(inputShape, dataLayout);
+    const TensorStrides out(outputShape, dataLayout);
+
+    // Zero padded input planes covering every 2x2 output tile, plus the transformed input of one tile.
+    const unsigned int planeHeight = ((out.m_Height + 1) / 2) * 2 + 2;
+    const unsigned int planeWidth  = ((out.m_Width + 1) / 2) * 2 + 2;
+    return in.m_Channels * (planeHeight * planeWidth + 16);
+}
+
+void Winograd3x3Convolution(const TensorShape& inputShape,
+                            const float* input,
+                            const TensorShape& outputShape,
+                            float* output,
+                            const std::vector<float>& transformedFilter,
+                            const float* bias,
+                            DataLayout dataLayout,
+                            unsigned int paddingTop,
+                            unsigned int paddingLeft,
+                            std::vector<float>& scratch)
+{
+    const TensorStrides in(inputShape, dataLayout);
+    const TensorStrides out(outputShape, dataLayout);
+
+    const unsigned int inputChannels  = in.m_Channels;
+    const unsigned int outputChannels = out.m_Channels;
+    ARMNN_ASSERT(transformedFilter.size() == outputChannels * inputChannels * 16);
+
+    const unsigned int tilesY      = (out.m_Height + 1) / 2;
+    const unsigned int tilesX      = (out.m_Width + 1) / 2;
+    const unsigned int planeHeight = tilesY * 2 + 2;
+    const unsigned int planeWidth  = tilesX * 2 + 2;
+    const unsigned int planeSize   = planeHeight * planeWidth;
+    ARMNN_ASSERT(scratch.size() >= GetWinograd3x3ScratchSize(inputShape, outputShape, dataLayout));
+
+    float* planes = scratch.data();
+    float* transformedInput = planes + inputChannels * planeSize;
+
+    const unsigned int copyHeight = std::min(in.m_Height, planeHeight > paddingTop ? planeHeight - paddingTop : 0u);
+    const unsigned int copyWidth  = std::min(in.m_Width, planeWidth > paddingLeft ? planeWidth - paddingLeft : 0u);
+
+    for (unsigned int b = 0; b < outputShape[0]; ++b)
+    {
+        // Gathers the input into zero padded planes, so that the tiles need no bounds checks.
+        std::fill(planes, planes + inputChannels * planeSize, 0.0f);
+        const float* inputBatch = input + b * in.m_BatchStride;
+        for (unsigned int ci = 0; ci < inputChannels; ++ci)
+        {
+            for (unsigned int y = 0; y < copyHeight; ++y)
+            {
+                const float* inputRow = inputBatch + ci * in.m_ChannelStride + y * in.m_RowStride;
+                float* planeRow = planes + ci * planeSize + (y + paddingTop) * planeWidth + paddingLeft;
+                for (unsigned int x = 0; x < copyWidth; ++x)
+                {
+                    planeRow[x] = inputRow[x * in.m_ColumnStride];
+                }
+            }
+        }
+
+        float* outputBatch = output + b * out.m_BatchStride;
+        for (unsigned int ty = 0; ty < tilesY; ++ty)
+        {
+            for (unsigned int tx = 0; tx < tilesX; ++tx)
+            {
+                // V = B^T d B for the 4x4 input tile of every input channel.
+                for (unsigned int ci = 0; ci < inputChannels; ++ci)
+                {
+                    const float* d = planes + ci * planeSize + ty * 2 * planeWidth + tx * 2;
+                    float t[4][4];
+                    for (unsigned int x = 0; x < 4; ++x)
+                    {
+                        const float d0 = d[x];
+                        const float d1 = d[planeWidth + x];
+                        const float d2 = d[2 * planeWidth + x];
+                        const float d3 = d[3 * planeWidth + x];
+                        t[0][x] = d0 - d2;
+                        t[1][x] = d1 + d2;
+                        t[2][x] = d2 - d1;
+                        t[3][x] = d1 - d3;
+                    }
+
+                    float* v = transformedInput + ci * 16;
+                    for (unsigned int y = 0; y < 4; ++y)
+                    {
+                        v[y * 4 + 0] = t[y][0] - t[y][2];
+                        v[y * 4 + 1] = t[y][1] + t[y][2];
+                        v[y * 4 + 2] = t[y][2] - t[y][1];
+                        v[y * 4 + 3] = t[y][1] - t[y][3];
+                    }
+                }
+
+                const unsigned int outputY = ty * 2;
+                const unsigned int outputX = tx * 2;
+                const unsigned int rows    = std::min(2u, out.m_Height - outputY);
+                const unsigned int columns = std::min(2u, out.m_Width - outputX);
+
+                for (unsigned int co = 0; co < outputChannels; ++co)
+                {
+                    // M = sum over the input channels of U (.) V, then Y = A^T M A.
+                    float m[16] = {};
+                    const float* u = transformedFilter.data() + co * inputChannels * 16;
+                    for (unsigned int ci = 0; ci < inputChannels; ++ci)
+                    {
+                        const float* v = transformedInput + ci * 16;
+                        for (unsigned int k = 0; k < 16; ++k)
+                        {
+                            m[k] += u[ci * 16 + k] * v[k];
+                        }
+                    }
+
+                    float s[2][4];
+                    for (unsigned int x = 0; x < 4; ++x)
+                    {
+                        s[0][x] = m[x] + m[4 + x] + m[8 + x];
+                        s[1][x] = m[4 + x] - m[8 + x] - m[12 + x];
+                    }
+
+                    const float biasValue = bias ? bias[co] : 0.0f;
+                    for (unsigned int y = 0; y < rows; ++y)
+                    {
+                        const float tile[2] = { s[y][0] + s[y][1] + s[y][2], s[y][1] - s[y][2] - s[y][3] };
+                        float* outputRow = outputBatch + co * out.m_ChannelStride + (outputY + y) * out.m_RowStride;
+                        for (unsigned int x = 0; x < columns; ++x)
+                        {
+                            outputRow[(outputX + x) * out.m_ColumnStride] = tile[x] + biasValue;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+void Depthwise3x3Convolution(const TensorShape& inputShape,
+                             const float* input,
+                             const TensorShape& outputShape,
+                             float* output,
+                             const TensorShape& filterShape,
+                             const float* filter,
+                             const float* bias,
+                             DataLayout dataLayout,
+                             unsigned int paddingTop,
+                             unsigned int paddingLeft,
+                             unsigned int xStride,
+                             unsigned int yStride)
+{
+    const TensorStrides in(inputShape, dataLayout);
+    const TensorStrides out(outputShape, dataLayout);
+
+    // Depthwise filters are [M, C, 3, 3]; output channel c * M + m reads input channel c.
+    const unsigned int depthMultiplier = filterShape[0];
+    const unsigned int inputChannels   = filterShape[1];
+    ARMNN_ASSERT(in.m_Channels == inputChannels && out.m_Channels == inputChannels * depthMultiplier);
+
+    const auto rows    = GetInteriorRange(in.m_Height, out.m_Height, paddingTop, yStride);
+    const auto columns = GetInteriorRange(in.m_Width, out.m_Width, paddingLeft, xStride);
+
+    const int inputHeight = static_cast<int>(in.m_Height);
+    const int inputWidth  = static_cast<int>(in.m_Width);
+
+    for (unsigned int b = 0; b < outputShape[0]; ++b)
+    {
+        for (unsigned int ci = 0; ci < inputChannels; ++ci)
+        {
+            const float* inputPlane = input + b * in.m_BatchStride + ci * in.m_ChannelStride;
+
+            for (unsigned int dm = 0; dm < depthMultiplier; ++dm)
+            {
+                const unsigned int co = ci * depthMultiplier + dm;
+                const float* w = filter + (dm * inputChannels + ci) * 9;
+                const float biasValue = bias ? bias[co] : 0.0f;
+                float* outputPlane = output + b * out.m_BatchStride + co * out.m_ChannelStride;
+
+                // Window partly in the padding: check every tap.
+                auto border = [&](unsigned int oy, unsigned int ox)
+                {
+                    const int y0 = static_cast<int>(oy * yStride) - static_cast<int>(paddingTop);
+                    const int x0 = static_cast<int>(ox * xStride) - static_cast<int>(paddingLeft);
+                    float sum = biasValue;
+                    for (int ky = 0; ky < 3; ++ky)
+                    {
+                        const int y = y0 + ky;
+                        if (y < 0 || y >= inputHeight)
+                        {
+                            continue;
+                        }
+                        for (int kx = 0; kx < 3; ++kx)
+                        {
+                            const int x = x0 + kx;
+                            if (x < 0 || x >= inputWidth)
+                            {
+                                continue;
+                            }
+                            sum += w[ky * 3 + kx] *
+                                   inputPlane[static_cast<unsigned int>(y) * in.m_RowStride +
+                                              static_cast<unsigned int>(x) * in.m_ColumnStride];
+                        }
+                    }
+                    outputPlane[oy * out.m_RowStride + ox * out.m_ColumnStride] = sum;
+                };
+
+                for (unsigned int oy = 0; oy < out.m_Height; ++oy)
+                {
+                    if (oy < rows.first || oy >= rows.second)
+                    {
+                        for (unsigned int ox = 0; ox < out.m_Width; ++ox)
+                        {
+                            border(oy, ox);
+                        }
+                        continue;
+                    }
+
+                    for (unsigned int ox = 0; ox < columns.first; ++ox)
+                    {
+                        border(oy, ox);
+                    }
+
+                    // Window entirely inside the input.
+                    const unsigned int y0 = oy * yStride - paddingTop;
+                    const float* row0 = inputPlane + y0 * in.m_RowStride;
+                    const float* row1 = row0 + in.m_RowStride;
+                    const float* row2 = row1 + in.m_RowStride;
+                    const unsigned int c = in.m_ColumnStride;
+                    for (unsigned int ox = columns.first; ox < columns.second; ++ox)
+                    {
+                        const unsigned int x0 = (ox * xStride - paddingLeft) * c;
+                        const float sum = biasValue +
+                            w[0] * row0[x0] + w[1] * row0[x0 + c] + w[2] * row0[x0 + 2 * c] +
+                            w[3] * row1[x0] + w[4] * row1[x0 + c] + w[5] * row1[x0 + 2 * c] +
+                            w[6] * row2[x0] + w[7] * row2[x0 + c] + w[8] * row2[x0 + 2 * c];
+                        outputPlane[oy * out.m_RowStride + ox * out.m_ColumnStride] = sum;
+                    }
+
+                    for (unsigned int ox = columns.second; ox < out.m_Width; ++ox)
+                    {
+                        border(oy, ox);
+                    }
+                }
+            }
+        }
+    }
+}
+
+} //namespace armnn
@@ -0,0 +1,91 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/Tensor.hpp>
+
+#include <vector>
+
+namespace armnn
+{
+
+/// Float32 kernels for the convolutions that dominate typical models. They take filters in the same layouts as
+/// Convolve and compute the same result, so the workloads pick one from the descriptor and fall back to Convolve
+/// for every other case.
+enum class ConvolutionKernel
+{
+    Generic,
+    Pointwise,
+    Winograd3x3,
+    Depthwise3x3
+};
+
+/// Picks Pointwise for 1x1 filters with unit strides and no padding, and Winograd3x3 for 3x3 filters with unit
+/// strides and dilations. Every tensor must be Float32; pass nullptr for biasInfo when bias is disabled.
+ConvolutionKernel SelectConvolution2dKernel(const Convolution2dDescriptor& descriptor,
+                                            const TensorInfo& inputInfo,
+                                            const TensorInfo& filterInfo,
+                                            const TensorInfo& outputInfo,
+                                            const TensorInfo* biasInfo);
+
+/// Picks Depthwise3x3 for 3x3 filters with unit dilations. Every tensor must be Float32; pass nullptr for biasInfo
+/// when bias is disabled.
+ConvolutionKernel SelectDepthwiseConvolution2dKernel(const DepthwiseConvolution2dDescriptor& descriptor,
+                                                     const TensorInfo& inputInfo,
+                                                     const TensorInfo& filterInfo,
+                                                     const TensorInfo& outputInfo,
+                                                     const TensorInfo* biasInfo);
+
+/// 1x1 convolution computed as a matrix multiplication of the filter with the input pixels.
+void PointwiseConvolution(const TensorShape& inputShape,
+                          const float* input,
+                          const TensorShape& outputShape,
+                          float* output,
+                          const float* filter,
+                          const float* bias,
+                          DataLayout dataLayout);
+
+/// Transforms a 3x3 filter into the Winograd F(2x2, 3x3) domain. This only depends on the weights, so it is done
+/// once ahead of Winograd3x3Convolution.
+std::vector<float> TransformWinograd3x3Filter(const TensorShape& filterShape,
+                                              const float* filter,
+                                              DataLayout dataLayout);
+
+/// Number of floats of scratch memory Winograd3x3Convolution needs.
+unsigned int GetWinograd3x3ScratchSize(const TensorShape& inputShape,
+                                       const TensorShape& outputShape,
+                                       DataLayout dataLayout);
+
+/// 3x3 convolution with unit strides and dilations using Winograd F(2x2, 3x3): each 2x2 output tile takes 16
+/// multiplications per input channel instead of 36.
+void Winograd3x3Convolution(const TensorShape& inputShape,
+                            const float* input,
+                            const TensorShape& outputShape,
+                            float* output,
+                            const std::vector<float>& transformedFilter,
+                            const float* bias,
+                            DataLayout dataLayout,
+                            unsigned int paddingTop,
+                            unsigned int paddingLeft,
+                            std::vector<float>& scratch);
+
+/// 3x3 depthwise convolution with unit dilations. Outputs whose window lies inside the input skip the padding
+/// checks; only the border is computed with them.
+void Depthwise3x3Convolution(const TensorShape& inputShape,
+                             const float* input,
+                             const TensorShape& outputShape,
+                             float* output,
+                             const TensorShape& filterShape,
+                             const float* filter,
+                             const float* bias,
+                             DataLayout dataLayout,
+                             unsigned int paddingTop,
+                             unsigned int paddingLeft,
+                             unsigned int xStride,
+                             unsigned int yStride);
+
+} //namespace armnn
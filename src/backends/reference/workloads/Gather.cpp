@@ -11,6 +11,8 @@
 #include <armnn/utility/IgnoreUnused.hpp>
 #include <armnn/utility/NumericCast.hpp>
 
+#include <cstring>
+
 namespace armnn
 {
 
@@ -56,4 +58,37 @@ void Gather(const TensorInfo& paramsInfo,
     ARMNN_ASSERT(outIndex == outputInfo.GetNumElements());
 }
 
+void Gather(const TensorInfo& paramsInfo,
+            const TensorInfo& indicesInfo,
+            const TensorInfo& outputInfo,
+            const void* params,
+            const int32_t* indices,
+            void* output)
+{
+    const TensorShape& paramsShape = paramsInfo.GetShape();
+
+    unsigned int paramsProduct = 1;
+    for (unsigned int i = 1; i < paramsInfo.GetNumDimensions(); ++i)
+    {
+        paramsProduct = paramsProduct * paramsShape[i];
+    }
+
+    const size_t sliceSize = paramsProduct * GetDataTypeSize(paramsInfo.GetDataType());
+    const unsigned char* paramsData = static_cast<const unsigned char*>(params);
+    unsigned char* outputData = static_cast<unsigned char*>(output);
+
+    const unsigned int numIndices = indicesInfo.GetNumElements();
+    for (unsigned int i = 0; i < numIndices; ++i)
+    {
+        unsigned int indx = armnn::numeric_cast<unsigned int>(indices[i]);
+
+        ARMNN_ASSERT(indices[i] >= 0 && indx < paramsShape[0]);
+
+        std::memcpy(outputData + i * sliceSize, paramsData + indx * sliceSize, sliceSize);
+    }
+
+    ARMNN_ASSERT(numIndices * paramsProduct == outputInfo.GetNumElements());
+    IgnoreUnused(outputInfo);
+}
+
 } //namespace armnn
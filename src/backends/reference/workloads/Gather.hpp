@@ -22,4 +22,13 @@ void Gather(const TensorInfo& paramsInfo,
             Encoder<float>& output,
             const int32_t = 0);
 
+/// Gather for params and output of the same data type and quantization: every index copies a whole slice of params
+/// with a single memcpy.
+void Gather(const TensorInfo& paramsInfo,
+            const TensorInfo& indicesInfo,
+            const TensorInfo& outputInfo,
+            const void* params,
+            const int32_t* indices,
+            void* output);
+
 } //namespace armnn
@@ -6,7 +6,6 @@
 #include "RefComparisonWorkload.hpp"
 
 #include "Decoders.hpp"
-#include "ElementwiseFunction.hpp"
 #include "Encoders.hpp"
 #include "RefWorkloadUtils.hpp"
 
@@ -34,61 +33,70 @@ void RefComparisonWorkload::PostAllocationConfigure()
     m_Input1 = MakeDecoder<InType>(inputInfo1);
 
     m_Output = MakeEncoder<OutType>(outputInfo);
-}
 
-void RefComparisonWorkload::Execute() const
-{
-    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefComparisonWorkload_Execute");
+    m_Broadcast = std::make_unique<BroadcastLoop>(inputInfo0.GetShape(),
+                                                  inputInfo1.GetShape(),
+                                                  outputInfo.GetShape());
 
-    const TensorInfo& inputInfo0 = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& inputInfo1 = GetTensorInfo(m_Data.m_Inputs[1]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+    // Float32 inputs and Boolean outputs can be read and written directly, without the decoders.
+    m_UseTypedData = inputInfo0.GetDataType() == DataType::Float32 &&
+                     inputInfo1.GetDataType() == DataType::Float32 &&
+                     outputInfo.GetDataType() == DataType::Boolean;
+}
 
-    const TensorShape& inShape0 = inputInfo0.GetShape();
-    const TensorShape& inShape1 = inputInfo1.GetShape();
-    const TensorShape& outShape = outputInfo.GetShape();
+template <typename Functor>
+void RefComparisonWorkload::Compare(Functor comparison) const
+{
+    if (m_UseTypedData)
+    {
+        m_Broadcast->Unroll(comparison,
+                            GetInputTensorData<InType>(0, m_Data),
+                            GetInputTensorData<InType>(1, m_Data),
+                            GetOutputTensorData<uint8_t>(0, m_Data));
+        return;
+    }
 
     m_Input0->Reset(m_Data.m_Inputs[0]->Map());
     m_Input1->Reset(m_Data.m_Inputs[1]->Map());
     m_Output->Reset(m_Data.m_Outputs[0]->Map());
 
-    using EqualFunction          = ElementwiseBinaryFunction<std::equal_to<InType>>;
-    using GreaterFunction        = ElementwiseBinaryFunction<std::greater<InType>>;
-    using GreaterOrEqualFunction = ElementwiseBinaryFunction<std::greater_equal<InType>>;
-    using LessFunction           = ElementwiseBinaryFunction<std::less<InType>>;
-    using LessOrEqualFunction    = ElementwiseBinaryFunction<std::less_equal<InType>>;
-    using NotEqualFunction       = ElementwiseBinaryFunction<std::not_equal_to<InType>>;
+    m_Broadcast->Unroll(comparison, 0, *m_Input0, *m_Input1, *m_Output);
+}
+
+void RefComparisonWorkload::Execute() const
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefComparisonWorkload_Execute");
 
     switch (m_Data.m_Parameters.m_Operation)
     {
         case ComparisonOperation::Equal:
         {
-            EqualFunction(inShape0, inShape1, outShape, *m_Input0, *m_Input1, *m_Output);
+            Compare(std::equal_to<InType>());
             break;
         }
         case ComparisonOperation::Greater:
         {
-            GreaterFunction(inShape0, inShape1, outShape, *m_Input0, *m_Input1, *m_Output);
+            Compare(std::greater<InType>());
             break;
         }
         case ComparisonOperation::GreaterOrEqual:
         {
-            GreaterOrEqualFunction(inShape0, inShape1, outShape, *m_Input0, *m_Input1, *m_Output);
+            Compare(std::greater_equal<InType>());
             break;
         }
         case ComparisonOperation::Less:
         {
-            LessFunction(inShape0, inShape1, outShape, *m_Input0, *m_Input1, *m_Output);
+            Compare(std::less<InType>());
             break;
         }
         case ComparisonOperation::LessOrEqual:
         {
-            LessOrEqualFunction(inShape0, inShape1, outShape, *m_Input0, *m_Input1, *m_Output);
+            Compare(std::less_equal<InType>());
             break;
         }
         case ComparisonOperation::NotEqual:
         {
-            NotEqualFunction(inShape0, inShape1, outShape, *m_Input0, *m_Input1, *m_Output);
+            Compare(std::not_equal_to<InType>());
             break;
         }
         default:
@@ -39,11 +39,45 @@ void RefConvolution2dWorkload::PostAllocationConfigure()
     const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
     m_OutputShape = outputInfo.GetShape();
     m_OutputEncoder = MakeEncoder<float>(outputInfo);
+
+    const Convolution2dDescriptor& params = m_Data.m_Parameters;
+    m_Kernel = SelectConvolution2dKernel(params,
+                                         inputInfo,
+                                         m_Weight->GetTensorInfo(),
+                                         outputInfo,
+                                         m_Bias ? &m_Bias->GetTensorInfo() : nullptr);
+
+    if (m_Kernel == ConvolutionKernel::Winograd3x3)
+    {
+        m_WinogradFilter = TransformWinograd3x3Filter(m_FilterShape,
+                                                      m_Weight->GetConstTensor<float>(),
+                                                      params.m_DataLayout);
+        m_Scratch.resize(GetWinograd3x3ScratchSize(m_InputShape, m_OutputShape, params.m_DataLayout));
+    }
 }
 
 void RefConvolution2dWorkload::Execute() const {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefConvolution2dWorkload_Execute");
 
+    const Convolution2dDescriptor& params = m_Data.m_Parameters;
+    const float* bias = m_Bias ? m_Bias->GetConstTensor<float>() : nullptr;
+    switch (m_Kernel)
+    {
+        case ConvolutionKernel::Pointwise:
+            PointwiseConvolution(m_InputShape, GetInputTensorData<float>(0, m_Data),
+                                 m_OutputShape, GetOutputTensorData<float>(0, m_Data),
+                                 m_Weight->GetConstTensor<float>(), bias, params.m_DataLayout);
+            return;
+        case ConvolutionKernel::Winograd3x3:
+            Winograd3x3Convolution(m_InputShape, GetInputTensorData<float>(0, m_Data),
+                                   m_OutputShape, GetOutputTensorData<float>(0, m_Data),
+                                   m_WinogradFilter, bias, params.m_DataLayout,
+                                   params.m_PadTop, params.m_PadLeft, m_Scratch);
+            return;
+        default:
+            break;
+    }
+
     m_InputDecoder->Reset(m_Data.m_Inputs[0]->Map());
     m_OutputEncoder->Reset(m_Data.m_Outputs[0]->Map());
 
@@ -7,6 +7,7 @@
 
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadData.hpp>
+#include "ConvKernels.hpp"
 #include "Decoders.hpp"
 #include "Encoders.hpp"
 
@@ -35,6 +36,10 @@ private:
     TensorShape m_InputShape;
     TensorShape m_OutputShape;
     TensorShape m_FilterShape;
+
+    ConvolutionKernel m_Kernel = ConvolutionKernel::Generic;
+    std::vector<float> m_WinogradFilter;
+    mutable std::vector<float> m_Scratch;
 };
 
 } //namespace armnn
@@ -41,6 +41,12 @@ void RefDepthwiseConvolution2dWorkload::PostAllocationConfigure()
     const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
     m_OutputShape = outputInfo.GetShape();
     m_OutputEncoder = MakeEncoder<float>(outputInfo);
+
+    m_Kernel = SelectDepthwiseConvolution2dKernel(m_Data.m_Parameters,
+                                                  inputInfo,
+                                                  m_Weight->GetTensorInfo(),
+                                                  outputInfo,
+                                                  m_Bias ? &m_Bias->GetTensorInfo() : nullptr);
 }
 
 void RefDepthwiseConvolution2dWorkload::Execute() const
@@ -48,6 +54,18 @@ void RefDepthwiseConvolution2dWorkload::Execute() const
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefDepthwiseConvolution2dWorkload_Execute");
     std::unique_ptr<Decoder<float>> pBiasDecoder{};
 
+    if (m_Kernel == ConvolutionKernel::Depthwise3x3)
+    {
+        const DepthwiseConvolution2dDescriptor& params = m_Data.m_Parameters;
+        Depthwise3x3Convolution(m_InputShape, GetInputTensorData<float>(0, m_Data),
+                                m_OutputShape, GetOutputTensorData<float>(0, m_Data),
+                                m_FilterShape, m_Weight->GetConstTensor<float>(),
+                                m_Bias ? m_Bias->GetConstTensor<float>() : nullptr,
+                                params.m_DataLayout, params.m_PadTop, params.m_PadLeft,
+                                params.m_StrideX, params.m_StrideY);
+        return;
+    }
+
     m_InputDecoder->Reset(m_Data.m_Inputs[0]->Map());
     m_OutputEncoder->Reset(m_Data.m_Outputs[0]->Map());
 
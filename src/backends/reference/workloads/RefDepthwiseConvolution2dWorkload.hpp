@@ -4,6 +4,7 @@
 //
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadData.hpp>
+#include "ConvKernels.hpp"
 #include "Decoders.hpp"
 #include "Encoders.hpp"
 
@@ -34,6 +35,8 @@ private:
     TensorShape m_InputShape;
     TensorShape m_OutputShape;
     TensorShape m_FilterShape;
+
+    ConvolutionKernel m_Kernel = ConvolutionKernel::Generic;
 };
 
 } //namespace armnn
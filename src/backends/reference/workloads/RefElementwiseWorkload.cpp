@@ -12,6 +12,7 @@
 #include "RefWorkloadUtils.hpp"
 #include "StringMapping.hpp"
 #include <ResolveType.hpp>
+#include <type_traits>
 #include <vector>
 
 namespace armnn
@@ -35,30 +36,37 @@ void RefElementwiseWorkload<Functor, ParentDescriptor, DebugString>::PostAllocat
     m_Input0 = MakeDecoder<InType>(inputInfo0);
     m_Input1 = MakeDecoder<InType>(inputInfo1);
     m_Output = MakeEncoder<OutType>(outputInfo);
+
+    m_Broadcast = std::make_unique<BroadcastLoop>(inputInfo0.GetShape(),
+                                                  inputInfo1.GetShape(),
+                                                  outputInfo.GetShape());
+
+    // Float32 and Signed32 tensors hold InType/OutType values as they are, so they skip the decoders.
+    const DataType nativeType = std::is_same<InType, float>::value ? DataType::Float32 : DataType::Signed32;
+    m_UseTypedData = inputInfo0.GetDataType() == nativeType &&
+                     inputInfo1.GetDataType() == nativeType &&
+                     outputInfo.GetDataType() == nativeType;
 }
 
 template <typename Functor, typename ParentDescriptor, typename armnn::StringMapping::Id DebugString>
 void RefElementwiseWorkload<Functor, ParentDescriptor, DebugString>::Execute() const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, StringMapping::Instance().Get(DebugString));
-    const TensorInfo& inputInfo0 = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& inputInfo1 = GetTensorInfo(m_Data.m_Inputs[1]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
 
-    const TensorShape& inShape0 = inputInfo0.GetShape();
-    const TensorShape& inShape1 = inputInfo1.GetShape();
-    const TensorShape& outShape = outputInfo.GetShape();
+    if (m_UseTypedData)
+    {
+        m_Broadcast->Unroll(Functor(),
+                            GetInputTensorData<InType>(0, m_Data),
+                            GetInputTensorData<InType>(1, m_Data),
+                            GetOutputTensorData<OutType>(0, m_Data));
+        return;
+    }
 
     m_Input0->Reset(m_Data.m_Inputs[0]->Map());
     m_Input1->Reset(m_Data.m_Inputs[1]->Map());
     m_Output->Reset(m_Data.m_Outputs[0]->Map());
 
-    ElementwiseBinaryFunction<Functor>(inShape0,
-                                       inShape1,
-                                       outShape,
-                                       *m_Input0,
-                                       *m_Input1,
-                                       *m_Output);
+    m_Broadcast->Unroll(Functor(), 0, *m_Input0, *m_Input1, *m_Output);
 }
 
 } //namespace armnn
@@ -9,6 +9,7 @@
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadData.hpp>
 #include "BaseIterator.hpp"
+#include "Broadcast.hpp"
 #include "ElementwiseFunction.hpp"
 #include "Maximum.hpp"
 #include "Minimum.hpp"
@@ -33,6 +34,8 @@ private:
     std::unique_ptr<Decoder<InType>> m_Input0;
     std::unique_ptr<Decoder<InType>> m_Input1;
     std::unique_ptr<Encoder<OutType>> m_Output;
+    std::unique_ptr<BroadcastLoop> m_Broadcast;
+    bool m_UseTypedData = false;
 };
 
 template <typename DataType = float>
@@ -0,0 +1,113 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "RefFusedElementwiseWorkload.hpp"
+
+#include "Activation.hpp"
+#include "Maximum.hpp"
+#include "Minimum.hpp"
+#include "RefWorkloadUtils.hpp"
+
+#include "Profiling.hpp"
+
+#include <algorithm>
+#include <functional>
+
+namespace armnn
+{
+
+namespace
+{
+
+/// Number of elements processed by every step of the chain before moving on to the next ones.
+constexpr unsigned int g_TileSize = 1024;
+
+template <typename Functor>
+void ApplyBinary(float* values, const float* other, unsigned int count, bool previousIsFirst)
+{
+    Functor functor;
+    if (previousIsFirst)
+    {
+        std::transform(values, values + count, other, values, functor);
+    }
+    else
+    {
+        std::transform(other, other + count, values, values, functor);
+    }
+}
+
+void ApplyStep(const RefFusedElementwiseChain::Step& step, float* values, const float* other, unsigned int count)
+{
+    using Operation = RefFusedElementwiseChain::Operation;
+
+    switch (step.m_Operation)
+    {
+        case Operation::Activation:
+            for (unsigned int i = 0; i < count; ++i)
+            {
+                values[i] = Activation(values[i], step.m_Activation.m_Function,
+                                       step.m_Activation.m_A, step.m_Activation.m_B);
+            }
+            break;
+        case Operation::Addition:
+            ApplyBinary<std::plus<float>>(values, other, count, step.m_PreviousIsFirst);
+            break;
+        case Operation::Division:
+            ApplyBinary<std::divides<float>>(values, other, count, step.m_PreviousIsFirst);
+            break;
+        case Operation::Maximum:
+            ApplyBinary<maximum<float>>(values, other, count, step.m_PreviousIsFirst);
+            break;
+        case Operation::Minimum:
+            ApplyBinary<minimum<float>>(values, other, count, step.m_PreviousIsFirst);
+            break;
+        case Operation::Multiplication:
+            ApplyBinary<std::multiplies<float>>(values, other, count, step.m_PreviousIsFirst);
+            break;
+        case Operation::Subtraction:
+            ApplyBinary<std::minus<float>>(values, other, count, step.m_PreviousIsFirst);
+            break;
+        default:
+            throw InvalidArgumentException("Unknown operation in fused elementwise chain");
+    }
+}
+
+} // anonymous namespace
+
+RefFusedElementwiseWorkload::RefFusedElementwiseWorkload(const PreCompiledQueueDescriptor& descriptor,
+                                                         const WorkloadInfo& info)
+    : BaseWorkload<PreCompiledQueueDescriptor>(descriptor, info)
+    , m_Chain(*static_cast<const RefFusedElementwiseChain*>(descriptor.m_PreCompiledObject))
+{}
+
+void RefFusedElementwiseWorkload::Execute() const
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefFusedElementwiseWorkload_Execute");
+
+    std::vector<const float*> inputs;
+    inputs.reserve(m_Data.m_Inputs.size());
+    for (unsigned int i = 0; i < m_Data.m_Inputs.size(); ++i)
+    {
+        inputs.push_back(GetInputTensorDataFloat(i, m_Data));
+    }
+    float* output = GetOutputTensorDataFloat(0, m_Data);
+
+    // The tile is computed in the output, which only ever holds the part of the chain computed so far
+    const unsigned int numElements = GetTensorInfo(m_Data.m_Outputs[0]).GetNumElements();
+    for (unsigned int start = 0; start < numElements; start += g_TileSize)
+    {
+        const unsigned int count = std::min(g_TileSize, numElements - start);
+        float* tile = output + start;
+        std::copy(inputs[0] + start, inputs[0] + start + count, tile);
+
+        for (const RefFusedElementwiseChain::Step& step : m_Chain.m_Steps)
+        {
+            const bool isBinary = step.m_Operation != RefFusedElementwiseChain::Operation::Activation;
+            ApplyStep(step, tile, isBinary ? inputs[step.m_OtherInput] + start : nullptr, count);
+        }
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,60 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <backendsCommon/Workload.hpp>
+#include <backendsCommon/WorkloadData.hpp>
+
+#include <armnn/Descriptors.hpp>
+
+#include <vector>
+
+namespace armnn
+{
+
+/// A chain of Float32 elementwise layers with tensors of the same shape, fused by RefBackend::OptimizeSubgraphView
+/// into a PreCompiled layer that holds it as its pre-compiled object.
+struct RefFusedElementwiseChain
+{
+    enum class Operation
+    {
+        Activation,
+        Addition,
+        Division,
+        Maximum,
+        Minimum,
+        Multiplication,
+        Subtraction
+    };
+
+    /// One layer of the chain. The first step reads input 0 of the fused layer in place of the result of a previous
+    /// step. Binary steps also read the input m_OtherInput of the fused layer.
+    struct Step
+    {
+        Operation            m_Operation;
+        ActivationDescriptor m_Activation;
+        unsigned int         m_OtherInput;
+        /// Whether the result of the previous step is the first operand of a binary step rather than the second.
+        bool                 m_PreviousIsFirst;
+    };
+
+    std::vector<Step> m_Steps;
+};
+
+/// Runs a fused chain one tile at a time, so that the results of the layers inside the chain stay in cache rather
+/// than being written out as whole tensors.
+class RefFusedElementwiseWorkload : public BaseWorkload<PreCompiledQueueDescriptor>
+{
+public:
+    RefFusedElementwiseWorkload(const PreCompiledQueueDescriptor& descriptor, const WorkloadInfo& info);
+
+    void Execute() const override;
+
+private:
+    RefFusedElementwiseChain m_Chain;
+};
+
+} // namespace armnn
@@ -8,6 +8,7 @@
 #include "Gather.hpp"
 #include "Profiling.hpp"
 #include "RefWorkloadUtils.hpp"
+#include "TensorViewCopy.hpp"
 #include <ResolveType.hpp>
 
 namespace armnn
@@ -21,6 +22,17 @@ void RefGatherWorkload::Execute() const
     const TensorInfo& inputInfo1 = GetTensorInfo(m_Data.m_Inputs[1]);
     const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
 
+    if (IsRawCopyCompatible(inputInfo0, outputInfo))
+    {
+        Gather(inputInfo0,
+               inputInfo1,
+               outputInfo,
+               m_Data.m_Inputs[0]->Map(),
+               GetInputTensorData<int32_t>(1, m_Data),
+               m_Data.m_Outputs[0]->Map());
+        return;
+    }
+
     std::unique_ptr<Decoder<float>> decoderPtr = MakeDecoder<float>(inputInfo0, m_Data.m_Inputs[0]->Map());
     Decoder<float>& decoder = *decoderPtr;
 
@@ -6,7 +6,6 @@
 #include "RefLogicalBinaryWorkload.hpp"
 
 #include "Decoders.hpp"
-#include "ElementwiseFunction.hpp"
 #include "Encoders.hpp"
 #include "RefWorkloadUtils.hpp"
 
@@ -14,6 +13,8 @@
 
 #include <armnn/TypesUtils.hpp>
 
+#include <functional>
+
 namespace armnn
 {
 
@@ -31,37 +32,50 @@ void RefLogicalBinaryWorkload::PostAllocationConfigure()
     m_Input0 = MakeDecoder<InType>(inputInfo0);
     m_Input1 = MakeDecoder<InType>(inputInfo1);
     m_Output = MakeEncoder<OutType>(outputInfo);
-}
 
-void RefLogicalBinaryWorkload::Execute() const
-{
-    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefLogicalBinaryWorkload_Execute");
+    m_Broadcast = std::make_unique<BroadcastLoop>(inputInfo0.GetShape(),
+                                                  inputInfo1.GetShape(),
+                                                  outputInfo.GetShape());
 
-    const TensorInfo& inputInfo0 = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& inputInfo1 = GetTensorInfo(m_Data.m_Inputs[1]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+    // Boolean tensors are stored as one byte per value and can be used without the decoders.
+    m_UseTypedData = inputInfo0.GetDataType() == DataType::Boolean &&
+                     inputInfo1.GetDataType() == DataType::Boolean &&
+                     outputInfo.GetDataType() == DataType::Boolean;
+}
 
-    const TensorShape& inShape0 = inputInfo0.GetShape();
-    const TensorShape& inShape1 = inputInfo1.GetShape();
-    const TensorShape& outShape = outputInfo.GetShape();
+template <typename Functor>
+void RefLogicalBinaryWorkload::Compute(Functor operation) const
+{
+    if (m_UseTypedData)
+    {
+        m_Broadcast->Unroll(operation,
+                            GetInputTensorData<uint8_t>(0, m_Data),
+                            GetInputTensorData<uint8_t>(1, m_Data),
+                            GetOutputTensorData<uint8_t>(0, m_Data));
+        return;
+    }
 
     m_Input0->Reset(m_Data.m_Inputs[0]->Map());
     m_Input1->Reset(m_Data.m_Inputs[1]->Map());
     m_Output->Reset(m_Data.m_Outputs[0]->Map());
 
-    using AndFunction = LogicalBinaryFunction<std::logical_and<bool>>;
-    using OrFunction  = LogicalBinaryFunction<std::logical_or<bool>>;
+    m_Broadcast->Unroll(operation, 0, *m_Input0, *m_Input1, *m_Output);
+}
+
+void RefLogicalBinaryWorkload::Execute() const
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefLogicalBinaryWorkload_Execute");
 
     switch (m_Data.m_Parameters.m_Operation)
     {
         case LogicalBinaryOperation::LogicalAnd:
         {
-            AndFunction(inShape0, inShape1, outShape, *m_Input0, *m_Input1, *m_Output);
+            Compute(std::logical_and<bool>());
             break;
         }
         case LogicalBinaryOperation::LogicalOr:
         {
-            OrFunction(inShape0, inShape1, outShape, *m_Input0, *m_Input1, *m_Output);
+            Compute(std::logical_or<bool>());
             break;
         }
         default:
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "BaseIterator.hpp"
+#include "Broadcast.hpp"
 
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadData.hpp>
@@ -26,9 +27,14 @@ private:
     using InType  = bool;
     using OutType = bool;
 
+    template <typename Functor>
+    void Compute(Functor operation) const;
+
     std::unique_ptr<Decoder<InType>>  m_Input0;
     std::unique_ptr<Decoder<InType>>  m_Input1;
     std::unique_ptr<Encoder<OutType>> m_Output;
+    std::unique_ptr<BroadcastLoop>    m_Broadcast;
+    bool                              m_UseTypedData = false;
 };
 
 } // namespace armnn
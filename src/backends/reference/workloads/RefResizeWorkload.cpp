@@ -17,6 +17,33 @@
 namespace armnn
 {
 
+void RefResizeWorkload::PostAllocationConfigure()
+{
+    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
+    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+    const ResizeDescriptor& descriptor = m_Data.m_Parameters;
+
+    m_UseLookup = IsResizeLookupSupported(inputInfo, outputInfo, descriptor.m_Method);
+    if (!m_UseLookup)
+    {
+        return;
+    }
+
+    const armnnUtils::DataLayoutIndexed dataLayout(descriptor.m_DataLayout);
+
+    m_RowLookup = CalculateResizeAxisLookup(inputInfo.GetShape()[dataLayout.GetHeightIndex()],
+                                            outputInfo.GetShape()[dataLayout.GetHeightIndex()],
+                                            descriptor.m_Method,
+                                            descriptor.m_AlignCorners,
+                                            descriptor.m_HalfPixelCenters);
+    m_ColumnLookup = CalculateResizeAxisLookup(inputInfo.GetShape()[dataLayout.GetWidthIndex()],
+                                               outputInfo.GetShape()[dataLayout.GetWidthIndex()],
+                                               descriptor.m_Method,
+                                               descriptor.m_AlignCorners,
+                                               descriptor.m_HalfPixelCenters);
+    m_Scratch.resize(GetResizeLookupScratchSize(outputInfo, dataLayout, descriptor.m_Method));
+}
+
 void RefResizeWorkload::Execute() const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefResizeWorkload_Execute");
@@ -24,6 +51,20 @@ void RefResizeWorkload::Execute() const
     const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
     const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
 
+    if (m_UseLookup)
+    {
+        Resize(m_Data.m_Inputs[0]->Map(),
+               inputInfo,
+               m_Data.m_Outputs[0]->Map(),
+               outputInfo,
+               m_Data.m_Parameters.m_DataLayout,
+               m_Data.m_Parameters.m_Method,
+               m_RowLookup,
+               m_ColumnLookup,
+               m_Scratch);
+        return;
+    }
+
     std::unique_ptr<Decoder<float>> decoderPtr = MakeDecoder<float>(inputInfo, m_Data.m_Inputs[0]->Map());
     Decoder<float> &decoder = *decoderPtr;
     std::unique_ptr<Encoder<float>> encoderPtr = MakeEncoder<float>(outputInfo, m_Data.m_Outputs[0]->Map());
@@ -8,6 +8,8 @@
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadData.hpp>
 
+#include "Resize.hpp"
+
 namespace armnn
 {
 
@@ -15,7 +17,15 @@ class RefResizeWorkload : public BaseWorkload<ResizeQueueDescriptor>
 {
 public:
     using BaseWorkload<ResizeQueueDescriptor>::BaseWorkload;
+    void PostAllocationConfigure() override;
     virtual void Execute() const override;
+
+private:
+    // Shapes are static once the network is loaded, so the source coordinates and weights are computed once.
+    bool m_UseLookup = false;
+    ResizeAxisLookup m_RowLookup;
+    ResizeAxisLookup m_ColumnLookup;
+    mutable std::vector<float> m_Scratch;
 };
 
 } //namespace armnn
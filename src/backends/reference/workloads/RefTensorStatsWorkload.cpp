@@ -0,0 +1,49 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "RefTensorStatsWorkload.hpp"
+#include "TensorStats.hpp"
+
+#include "Decoders.hpp"
+#include "RefWorkloadUtils.hpp"
+#include "Profiling.hpp"
+
+namespace armnn
+{
+
+void RefTensorStatsWorkload::Execute() const
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefTensorStatsWorkload_Execute");
+
+    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
+    const unsigned int numElements = inputInfo.GetNumElements();
+
+    // The input is read in place, Float32 directly and the other types through a decoder
+    if (inputInfo.GetDataType() == DataType::Float32)
+    {
+        ComputeTensorStats(GetInputTensorDataFloat(0, m_Data), numElements, m_Data.m_Parameters, m_Stats);
+    }
+    else
+    {
+        std::unique_ptr<Decoder<float>> decoder = MakeDecoder<float>(inputInfo, m_Data.m_Inputs[0]->Map());
+        ComputeTensorStats(*decoder, numElements, m_Data.m_Parameters, m_Stats);
+    }
+
+    if (m_Callback)
+    {
+        m_Callback(m_Data.m_Guid, m_Data.m_SlotIndex, m_Stats);
+    }
+    else
+    {
+        PrintTensorStats(m_Stats, m_Data.m_Guid, m_Data.m_LayerName, m_Data.m_SlotIndex);
+    }
+}
+
+void RefTensorStatsWorkload::RegisterTensorStatsCallback(const TensorStatsCallbackFunction& func)
+{
+    m_Callback = func;
+}
+
+} //namespace armnn
@@ -0,0 +1,30 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <backendsCommon/Workload.hpp>
+#include <backendsCommon/WorkloadData.hpp>
+
+namespace armnn
+{
+
+class RefTensorStatsWorkload : public BaseWorkload<TensorStatsQueueDescriptor>
+{
+public:
+    using BaseWorkload<TensorStatsQueueDescriptor>::BaseWorkload;
+
+    void Execute() const override;
+
+    void RegisterTensorStatsCallback(const TensorStatsCallbackFunction& func) override;
+
+private:
+    TensorStatsCallbackFunction m_Callback;
+
+    /// Kept between executions so that the histogram is only allocated once.
+    mutable TensorStats m_Stats;
+};
+
+} //namespace armnn
@@ -7,9 +7,11 @@
 
 #include "TensorBufferArrayView.hpp"
 
+#include <armnn/TypesUtils.hpp>
 #include <armnn/utility/NumericCast.hpp>
 
 #include <cmath>
+#include <cstring>
 #include <algorithm>
 
 using namespace armnnUtils;
@@ -60,8 +62,249 @@ inline float PixelScaler(const unsigned int& Pixel,
     }
 }
 
+// Describes the tensors of a lookup based Resize as a sequence of planes. For NHWC a plane is one batch and the
+// channels are interleaved in every texel; for NCHW a plane is a single channel of one batch.
+struct ResizePlanes
+{
+    unsigned int m_NumPlanes;
+    unsigned int m_TexelSize;
+    unsigned int m_InputHeight;
+    unsigned int m_InputWidth;
+    unsigned int m_OutputHeight;
+    unsigned int m_OutputWidth;
+};
+
+ResizePlanes GetResizePlanes(const TensorShape& inputShape,
+                             const TensorShape& outputShape,
+                             const DataLayoutIndexed& dataLayout)
+{
+    const unsigned int batchSize    = inputShape[0];
+    const unsigned int channelCount = inputShape[dataLayout.GetChannelsIndex()];
+    const bool isNhwc = dataLayout.GetDataLayout() == DataLayout::NHWC;
+
+    ResizePlanes planes;
+    planes.m_NumPlanes    = isNhwc ? batchSize : batchSize * channelCount;
+    planes.m_TexelSize    = isNhwc ? channelCount : 1u;
+    planes.m_InputHeight  = inputShape[dataLayout.GetHeightIndex()];
+    planes.m_InputWidth   = inputShape[dataLayout.GetWidthIndex()];
+    planes.m_OutputHeight = outputShape[dataLayout.GetHeightIndex()];
+    planes.m_OutputWidth  = outputShape[dataLayout.GetWidthIndex()];
+    return planes;
+}
+
+// Nearest neighbour only moves texels around, so it works on raw bytes for every data type.
+void ResizeNearestNeighbor(const unsigned char* in,
+                           unsigned char* out,
+                           unsigned int elementSize,
+                           const ResizePlanes& planes,
+                           const ResizeAxisLookup& rowLookup,
+                           const ResizeAxisLookup& columnLookup)
+{
+    const size_t texelBytes     = planes.m_TexelSize * elementSize;
+    const size_t inputRowBytes  = planes.m_InputWidth * texelBytes;
+    const size_t outputRowBytes = planes.m_OutputWidth * texelBytes;
+
+    for (unsigned int p = 0; p < planes.m_NumPlanes; ++p)
+    {
+        const unsigned char* inPlane = in + p * planes.m_InputHeight * inputRowBytes;
+        unsigned char* outPlane      = out + p * planes.m_OutputHeight * outputRowBytes;
+
+        for (unsigned int y = 0; y < planes.m_OutputHeight; ++y)
+        {
+            unsigned char* outRow = outPlane + y * outputRowBytes;
+
+            // Upsampling by an integer factor maps consecutive output rows to the same input row.
+            if (y > 0 && rowLookup.m_Lower[y] == rowLookup.m_Lower[y - 1])
+            {
+                std::memcpy(outRow, outRow - outputRowBytes, outputRowBytes);
+                continue;
+            }
+
+            const unsigned char* inRow = inPlane + rowLookup.m_Lower[y] * inputRowBytes;
+            for (unsigned int x = 0; x < planes.m_OutputWidth; ++x)
+            {
+                std::memcpy(outRow + x * texelBytes, inRow + columnLookup.m_Lower[x] * texelBytes, texelBytes);
+            }
+        }
+    }
+}
+
+void ResizeBilinear(const float* in,
+                    float* out,
+                    const ResizePlanes& planes,
+                    const ResizeAxisLookup& rowLookup,
+                    const ResizeAxisLookup& columnLookup,
+                    float* rowCache)
+{
+    const unsigned int texelSize      = planes.m_TexelSize;
+    const unsigned int inputRowSize   = planes.m_InputWidth * texelSize;
+    const unsigned int outputRowSize  = planes.m_OutputWidth * texelSize;
+
+    // Input rows interpolated along the width. Each one only depends on the source row, so consecutive output
+    // rows sharing a source row (e.g. when upsampling by an integer factor) reuse it instead of recomputing it.
+    float* cachedRows[2] = { rowCache, rowCache + outputRowSize };
+
+    for (unsigned int p = 0; p < planes.m_NumPlanes; ++p)
+    {
+        const float* inPlane = in + p * planes.m_InputHeight * inputRowSize;
+        float* outPlane      = out + p * planes.m_OutputHeight * outputRowSize;
+
+        unsigned int cachedRowIndices[2] = { planes.m_InputHeight, planes.m_InputHeight };
+
+        auto getInterpolatedRow = [&](unsigned int sourceRow, unsigned int rowToKeep) -> const float*
+        {
+            for (unsigned int slot = 0; slot < 2; ++slot)
+            {
+                if (cachedRowIndices[slot] == sourceRow)
+                {
+                    return cachedRows[slot];
+                }
+            }
+
+            const unsigned int slot = cachedRowIndices[0] == rowToKeep ? 1u : 0u;
+            const float* inRow = inPlane + sourceRow * inputRowSize;
+            float* interpolated = cachedRows[slot];
+
+            for (unsigned int x = 0; x < planes.m_OutputWidth; ++x)
+            {
+                const float* left  = inRow + columnLookup.m_Lower[x] * texelSize;
+                const float* right = inRow + columnLookup.m_Upper[x] * texelSize;
+                const float weight = columnLookup.m_Weight[x];
+                float* dst = interpolated + x * texelSize;
+
+                for (unsigned int c = 0; c < texelSize; ++c)
+                {
+                    dst[c] = Lerp(left[c], right[c], weight);
+                }
+            }
+
+            cachedRowIndices[slot] = sourceRow;
+            return interpolated;
+        };
+
+        for (unsigned int y = 0; y < planes.m_OutputHeight; ++y)
+        {
+            const float* top    = getInterpolatedRow(rowLookup.m_Lower[y], rowLookup.m_Upper[y]);
+            const float* bottom = getInterpolatedRow(rowLookup.m_Upper[y], rowLookup.m_Lower[y]);
+            const float weight  = rowLookup.m_Weight[y];
+            float* outRow = outPlane + y * outputRowSize;
+
+            for (unsigned int i = 0; i < outputRowSize; ++i)
+            {
+                outRow[i] = Lerp(top[i], bottom[i], weight);
+            }
+        }
+    }
+}
+
 }// anonymous namespace
 
+ResizeAxisLookup CalculateResizeAxisLookup(unsigned int inputSize,
+                                           unsigned int outputSize,
+                                           ResizeMethod resizeMethod,
+                                           bool alignCorners,
+                                           bool halfPixelCenters)
+{
+    // alignCorners and halfPixelCenters cannot both be true
+    ARMNN_ASSERT(!(alignCorners && halfPixelCenters));
+
+    ResizeAxisLookup lookup;
+    lookup.m_Lower.resize(outputSize);
+    lookup.m_Upper.resize(outputSize);
+    lookup.m_Weight.resize(outputSize);
+
+    const float scale = CalculateResizeScale(inputSize, outputSize, alignCorners);
+
+    // The same coordinate calculations as the Decoder based Resize below, done once per axis instead of once
+    // per output element.
+    for (unsigned int i = 0; i < outputSize; ++i)
+    {
+        const float coord = PixelScaler(i, scale, halfPixelCenters, resizeMethod);
+
+        const float floored = (resizeMethod == armnn::ResizeMethod::NearestNeighbor && alignCorners) ?
+                              roundf(coord) : floorf(coord);
+        const unsigned int lower = static_cast<unsigned int>(std::max(floored, 0.0f));
+
+        lookup.m_Lower[i]  = lower;
+        lookup.m_Upper[i]  = halfPixelCenters ?
+                             std::min(static_cast<unsigned int>(std::ceil(coord)), inputSize - 1u) :
+                             std::min(lower + 1, inputSize - 1u);
+        lookup.m_Weight[i] = coord - floored;
+    }
+
+    return lookup;
+}
+
+bool IsResizeLookupSupported(const TensorInfo& inputInfo,
+                             const TensorInfo& outputInfo,
+                             ResizeMethod resizeMethod)
+{
+    switch (resizeMethod)
+    {
+        case ResizeMethod::NearestNeighbor:
+            return inputInfo.IsTypeSpaceMatch(outputInfo) && !inputInfo.HasPerAxisQuantization();
+        case ResizeMethod::Bilinear:
+            return inputInfo.GetDataType() == DataType::Float32 && outputInfo.GetDataType() == DataType::Float32;
+        default:
+            return false;
+    }
+}
+
+unsigned int GetResizeLookupScratchSize(const TensorInfo& outputInfo,
+                                        DataLayoutIndexed dataLayout,
+                                        ResizeMethod resizeMethod)
+{
+    if (resizeMethod != ResizeMethod::Bilinear)
+    {
+        return 0;
+    }
+
+    // Two output rows interpolated along the width.
+    const TensorShape& outputShape = outputInfo.GetShape();
+    const unsigned int texelSize = dataLayout.GetDataLayout() == DataLayout::NHWC ?
+                                   outputShape[dataLayout.GetChannelsIndex()] : 1u;
+    return 2 * outputShape[dataLayout.GetWidthIndex()] * texelSize;
+}
+
+void Resize(const void* in,
+            const TensorInfo& inputInfo,
+            void* out,
+            const TensorInfo& outputInfo,
+            DataLayoutIndexed dataLayout,
+            ResizeMethod resizeMethod,
+            const ResizeAxisLookup& rowLookup,
+            const ResizeAxisLookup& columnLookup,
+            std::vector<float>& scratch)
+{
+    ARMNN_ASSERT(IsResizeLookupSupported(inputInfo, outputInfo, resizeMethod));
+
+    const ResizePlanes planes = GetResizePlanes(inputInfo.GetShape(), outputInfo.GetShape(), dataLayout);
+
+    ARMNN_ASSERT(rowLookup.m_Lower.size() == planes.m_OutputHeight);
+    ARMNN_ASSERT(columnLookup.m_Lower.size() == planes.m_OutputWidth);
+
+    if (resizeMethod == ResizeMethod::NearestNeighbor)
+    {
+        ResizeNearestNeighbor(static_cast<const unsigned char*>(in),
+                              static_cast<unsigned char*>(out),
+                              GetDataTypeSize(inputInfo.GetDataType()),
+                              planes,
+                              rowLookup,
+                              columnLookup);
+    }
+    else
+    {
+        ARMNN_ASSERT(scratch.size() >= GetResizeLookupScratchSize(outputInfo, dataLayout, resizeMethod));
+
+        ResizeBilinear(static_cast<const float*>(in),
+                       static_cast<float*>(out),
+                       planes,
+                       rowLookup,
+                       columnLookup,
+                       scratch.data());
+    }
+}
+
 void Resize(Decoder<float>&   in,
             const TensorInfo& inputInfo,
             Encoder<float>&   out,
@@ -11,9 +11,49 @@
 
 #include <armnnUtils/DataLayoutIndexed.hpp>
 
+#include <vector>
+
 namespace armnn
 {
 
+/// Source texel coordinates and interpolation weights along one spatial axis of a Resize.
+/// For NearestNeighbor only m_Lower is meaningful and holds the selected texel.
+struct ResizeAxisLookup
+{
+    std::vector<unsigned int> m_Lower;
+    std::vector<unsigned int> m_Upper;
+    std::vector<float>        m_Weight;
+};
+
+ResizeAxisLookup CalculateResizeAxisLookup(unsigned int inputSize,
+                                           unsigned int outputSize,
+                                           ResizeMethod resizeMethod,
+                                           bool         alignCorners,
+                                           bool         halfPixelCenters);
+
+/// Returns true if the lookup-table based Resize below can handle the given tensors.
+bool IsResizeLookupSupported(const TensorInfo& inputInfo,
+                             const TensorInfo& outputInfo,
+                             ResizeMethod      resizeMethod);
+
+/// Returns the number of floats of scratch memory the lookup-table based Resize needs for the given output.
+unsigned int GetResizeLookupScratchSize(const TensorInfo&             outputInfo,
+                                        armnnUtils::DataLayoutIndexed dataLayout,
+                                        ResizeMethod                  resizeMethod);
+
+/// Resize using per-row and per-column lookups precomputed with CalculateResizeAxisLookup.
+/// Works directly on the mapped tensor memory, so it must only be used if IsResizeLookupSupported returns true.
+/// scratch must hold at least GetResizeLookupScratchSize floats.
+void Resize(const void*                   in,
+            const TensorInfo&             inputInfo,
+            void*                         out,
+            const TensorInfo&             outputInfo,
+            armnnUtils::DataLayoutIndexed dataLayout,
+            ResizeMethod                  resizeMethod,
+            const ResizeAxisLookup&       rowLookup,
+            const ResizeAxisLookup&       columnLookup,
+            std::vector<float>&           scratch);
+
 void Resize(Decoder<float>&               in,
             const TensorInfo&             inputInfo,
             Encoder<float>&               out,
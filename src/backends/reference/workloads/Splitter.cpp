@@ -14,6 +14,9 @@
 
 #include "Decoders.hpp"
 #include "Encoders.hpp"
+#include "TensorViewCopy.hpp"
+
+#include <algorithm>
 
 namespace armnn
 {
@@ -22,6 +25,32 @@ void Split(const SplitterQueueDescriptor& data)
 {
     const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[0]);
 
+    const bool canCopyRaw = std::all_of(data.m_Outputs.begin(), data.m_Outputs.end(),
+                                        [&inputInfo](const ITensorHandle* output)
+                                        {
+                                            return IsRawCopyCompatible(inputInfo, GetTensorInfo(output));
+                                        });
+    if (canCopyRaw)
+    {
+        const unsigned int elementSize = GetDataTypeSize(inputInfo.GetDataType());
+        for (unsigned int viewIdx = 0; viewIdx < data.m_ViewOrigins.size(); ++viewIdx)
+        {
+            // Nothing to copy for views that already alias the input tensor
+            if (data.m_Outputs[viewIdx]->GetParent() == data.m_Inputs[0])
+            {
+                continue;
+            }
+
+            CopyTensorToView(inputInfo.GetShape(),
+                             GetTensorInfo(data.m_Outputs[viewIdx]).GetShape(),
+                             data.m_ViewOrigins[viewIdx].m_Origin,
+                             elementSize,
+                             data.m_Inputs[0]->Map(),
+                             data.m_Outputs[viewIdx]->Map());
+        }
+        return;
+    }
+
     std::unique_ptr<Decoder<float>> decoderPtr =
         MakeDecoder<float>(inputInfo, data.m_Inputs[0]->Map());
     Decoder<float>& decoder = *decoderPtr;
@@ -0,0 +1,127 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "TensorStats.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+namespace armnn
+{
+
+namespace
+{
+
+template <typename GetValue>
+void ComputeTensorStatsImpl(GetValue&& getValue,
+                            unsigned int numElements,
+                            const TensorStatsDescriptor& descriptor,
+                            TensorStats& stats)
+{
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    float min = nan;
+    float max = nan;
+    double sum = 0.0;
+    unsigned int numNaNs = 0;
+    unsigned int numInfs = 0;
+
+    stats.m_Histogram.assign(descriptor.m_NumBins, 0);
+    const unsigned int lastBin = descriptor.m_NumBins > 0 ? descriptor.m_NumBins - 1 : 0;
+    const float binScale = descriptor.m_NumBins > 0 ?
+        static_cast<float>(descriptor.m_NumBins) / (descriptor.m_HistogramMax - descriptor.m_HistogramMin) : 0.0f;
+
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        const float value = getValue(i);
+        if (std::isnan(value))
+        {
+            ++numNaNs;
+            continue;
+        }
+
+        // NaN compares false, so the first value that is not a NaN sets both bounds
+        min = value < min || std::isnan(min) ? value : min;
+        max = value > max || std::isnan(max) ? value : max;
+
+        if (std::isinf(value))
+        {
+            ++numInfs;
+            continue;
+        }
+
+        sum += value;
+        if (descriptor.m_NumBins > 0)
+        {
+            const float position = (value - descriptor.m_HistogramMin) * binScale;
+            const unsigned int bin = position <= 0.0f ? 0 :
+                std::min(static_cast<unsigned int>(position), lastBin);
+            ++stats.m_Histogram[bin];
+        }
+    }
+
+    const unsigned int numFinite = numElements - numNaNs - numInfs;
+    stats.m_Min = min;
+    stats.m_Max = max;
+    stats.m_Mean = numFinite > 0 ? static_cast<float>(sum / numFinite) : 0.0f;
+    stats.m_NumElements = numElements;
+    stats.m_NumNaNs = numNaNs;
+    stats.m_NumInfs = numInfs;
+}
+
+} // anonymous namespace
+
+void ComputeTensorStats(Decoder<float>& decoder,
+                        unsigned int numElements,
+                        const TensorStatsDescriptor& descriptor,
+                        TensorStats& stats)
+{
+    auto getValue = [&decoder](unsigned int i)
+    {
+        decoder[i];
+        return decoder.Get();
+    };
+    ComputeTensorStatsImpl(getValue, numElements, descriptor, stats);
+}
+
+void ComputeTensorStats(const float* data,
+                        unsigned int numElements,
+                        const TensorStatsDescriptor& descriptor,
+                        TensorStats& stats)
+{
+    ComputeTensorStatsImpl([data](unsigned int i) { return data[i]; }, numElements, descriptor, stats);
+}
+
+void PrintTensorStats(const TensorStats& stats,
+                      LayerGuid guid,
+                      const std::string& layerName,
+                      unsigned int slotIndex)
+{
+    std::cout << "{ ";
+    std::cout << "\"layerGuid\": " << guid << ", ";
+    std::cout << "\"layerName\": \"" << layerName << "\", ";
+    std::cout << "\"outputSlot\": " << slotIndex << ", ";
+    std::cout << "\"numElements\": " << stats.m_NumElements << ", ";
+    std::cout << "\"min\": " << stats.m_Min << ", ";
+    std::cout << "\"max\": " << stats.m_Max << ", ";
+    std::cout << "\"mean\": " << stats.m_Mean << ", ";
+    std::cout << "\"numNaNs\": " << stats.m_NumNaNs << ", ";
+    std::cout << "\"numInfs\": " << stats.m_NumInfs;
+
+    if (!stats.m_Histogram.empty())
+    {
+        std::cout << ", \"histogram\": [";
+        for (unsigned int i = 0; i < stats.m_Histogram.size(); ++i)
+        {
+            std::cout << (i > 0 ? ", " : "") << stats.m_Histogram[i];
+        }
+        std::cout << "]";
+    }
+
+    std::cout << " }" << std::endl;
+}
+
+} //namespace armnn
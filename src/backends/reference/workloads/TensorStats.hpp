@@ -0,0 +1,36 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "BaseIterator.hpp"
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/Types.hpp>
+
+#include <string>
+
+namespace armnn
+{
+
+/// Computes the stats of the numElements values read by decoder in a single pass.
+/// The histogram of stats is resized rather than reallocated, so that a workload can reuse stats between calls.
+void ComputeTensorStats(Decoder<float>& decoder,
+                        unsigned int numElements,
+                        const TensorStatsDescriptor& descriptor,
+                        TensorStats& stats);
+
+/// Same as above, reading the values directly, for Float32 tensors.
+void ComputeTensorStats(const float* data,
+                        unsigned int numElements,
+                        const TensorStatsDescriptor& descriptor,
+                        TensorStats& stats);
+
+/// Prints the stats as a line of JSON.
+void PrintTensorStats(const TensorStats& stats,
+                      LayerGuid guid,
+                      const std::string& layerName,
+                      unsigned int slotIndex);
+
+} //namespace armnn
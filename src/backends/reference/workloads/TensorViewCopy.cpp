@@ -0,0 +1,127 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "TensorViewCopy.hpp"
+
+#include <armnn/utility/Assert.hpp>
+
+#include <cstring>
+
+namespace armnn
+{
+
+namespace
+{
+
+// Calls copyRun(tensorOffset, viewOffset, runLength) for every run of elements of the view that is contiguous in
+// both tensors. Offsets and lengths are in elements.
+template <typename CopyRun>
+void ForEachContiguousRun(const TensorShape& tensorShape,
+                          const TensorShape& viewShape,
+                          const std::vector<unsigned int>& viewOrigin,
+                          CopyRun copyRun)
+{
+    const unsigned int numDims = tensorShape.GetNumDimensions();
+    ARMNN_ASSERT(viewShape.GetNumDimensions() == numDims);
+    ARMNN_ASSERT(viewOrigin.size() == numDims);
+
+    if (viewShape.GetNumElements() == 0)
+    {
+        return;
+    }
+
+    // The trailing dimensions the view covers completely are contiguous in the tensor as well, so a run spans them
+    // together with the innermost dimension the view only covers partially.
+    unsigned int firstRunDim = numDims;
+    while (firstRunDim > 0 && viewShape[firstRunDim - 1] == tensorShape[firstRunDim - 1])
+    {
+        --firstRunDim;
+    }
+    if (firstRunDim > 0)
+    {
+        --firstRunDim;
+    }
+
+    std::vector<unsigned int> tensorStrides(numDims, 1);
+    for (unsigned int d = numDims; d-- > 1;)
+    {
+        tensorStrides[d - 1] = tensorStrides[d] * tensorShape[d];
+    }
+
+    unsigned int runLength = 1;
+    for (unsigned int d = firstRunDim; d < numDims; ++d)
+    {
+        runLength *= viewShape[d];
+    }
+
+    unsigned int runOrigin = 0;
+    for (unsigned int d = firstRunDim; d < numDims; ++d)
+    {
+        runOrigin += viewOrigin[d] * tensorStrides[d];
+    }
+
+    const unsigned int numRuns = viewShape.GetNumElements() / runLength;
+    for (unsigned int run = 0; run < numRuns; ++run)
+    {
+        // Position of the run in the leading dimensions of the view.
+        unsigned int remainder    = run;
+        unsigned int tensorOffset = runOrigin;
+        for (unsigned int d = firstRunDim; d-- > 0;)
+        {
+            const unsigned int index = remainder % viewShape[d];
+            remainder /= viewShape[d];
+            tensorOffset += (viewOrigin[d] + index) * tensorStrides[d];
+        }
+
+        copyRun(tensorOffset, run * runLength, runLength);
+    }
+}
+
+} // anonymous namespace
+
+bool IsRawCopyCompatible(const TensorInfo& info0, const TensorInfo& info1)
+{
+    return info0.IsTypeSpaceMatch(info1) && !info0.HasPerAxisQuantization() && !info1.HasPerAxisQuantization();
+}
+
+void CopyViewToTensor(const TensorShape& tensorShape,
+                      const TensorShape& viewShape,
+                      const std::vector<unsigned int>& viewOrigin,
+                      unsigned int elementSize,
+                      const void* viewData,
+                      void* tensorData)
+{
+    const unsigned char* src = static_cast<const unsigned char*>(viewData);
+    unsigned char* dst = static_cast<unsigned char*>(tensorData);
+
+    ForEachContiguousRun(tensorShape, viewShape, viewOrigin,
+                         [&](unsigned int tensorOffset, unsigned int viewOffset, unsigned int runLength)
+                         {
+                             std::memcpy(dst + tensorOffset * elementSize,
+                                         src + viewOffset * elementSize,
+                                         runLength * elementSize);
+                         });
+}
+
+void CopyTensorToView(const TensorShape& tensorShape,
+                      const TensorShape& viewShape,
+                      const std::vector<unsigned int>& viewOrigin,
+                      unsigned int elementSize,
+                      const void* tensorData,
+                      void* viewData)
+{
+    const unsigned char* src = static_cast<const unsigned char*>(tensorData);
+    unsigned char* dst = static_cast<unsigned char*>(viewData);
+
+    ForEachContiguousRun(tensorShape, viewShape, viewOrigin,
+                         [&](unsigned int tensorOffset, unsigned int viewOffset, unsigned int runLength)
+                         {
+                             std::memcpy(dst + viewOffset * elementSize,
+                                         src + tensorOffset * elementSize,
+                                         runLength * elementSize);
+                         });
+}
+
+} //namespace armnn
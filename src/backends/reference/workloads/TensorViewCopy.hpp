@@ -0,0 +1,36 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/Tensor.hpp>
+
+#include <vector>
+
+namespace armnn
+{
+
+/// Returns true if data can be moved between the two tensors as raw bytes, i.e. they hold the same data type with
+/// the same quantization.
+bool IsRawCopyCompatible(const TensorInfo& info0, const TensorInfo& info1);
+
+/// Copies a tensor into the region of a larger tensor starting at viewOrigin, as done by Concat. Runs of elements
+/// that are contiguous in both tensors are moved with a single memcpy.
+void CopyViewToTensor(const TensorShape& tensorShape,
+                      const TensorShape& viewShape,
+                      const std::vector<unsigned int>& viewOrigin,
+                      unsigned int elementSize,
+                      const void* viewData,
+                      void* tensorData);
+
+/// Copies the region of a tensor starting at viewOrigin into a smaller tensor, as done by Splitter.
+void CopyTensorToView(const TensorShape& tensorShape,
+                      const TensorShape& viewShape,
+                      const std::vector<unsigned int>& viewOrigin,
+                      unsigned int elementSize,
+                      const void* tensorData,
+                      void* viewData);
+
+} //namespace armnn
@@ -5,8 +5,10 @@
 
 #include "NetworkExecutionUtils/NetworkExecutionUtils.hpp"
 #include "ExecuteNetworkProgramOptions.hpp"
+#include "ThroughputBenchmark.hpp"
 
 #include <armnn/Logging.hpp>
+#include <armnn/utility/Timer.hpp>
 #include <Filesystem.hpp>
 #include <InferenceTest.hpp>
 
@@ -56,6 +58,8 @@ int TfLiteDelegateMainImpl(const ExecuteNetworkParams& params,
 
     // Create the Armnn Delegate
     armnnDelegate::DelegateOptions delegateOptions(params.m_ComputeDevices);
+    delegateOptions.SetImportEnabled(params.m_EnableDelegateImport);
+    delegateOptions.SetExportEnabled(params.m_EnableDelegateExport);
     std::unique_ptr<TfLiteDelegate, decltype(&armnnDelegate::TfLiteArmnnDelegateDelete)>
             theArmnnDelegate(armnnDelegate::TfLiteArmnnDelegateCreate(delegateOptions),
                              armnnDelegate::TfLiteArmnnDelegateDelete);
@@ -143,7 +147,9 @@ int TfLiteDelegateMainImpl(const ExecuteNetworkParams& params,
     for (size_t x = 0; x < params.m_Iterations; x++)
     {
         // Run the inference
+        const auto start_time = armnn::GetTimeNow();
         tfLiteInterpreter->Invoke();
+        const auto inference_duration = armnn::GetTimeDuration(start_time);
 
         // Print out the output
         for (unsigned int outputIndex = 0; outputIndex < params.m_OutputNames.size(); ++outputIndex)
@@ -243,6 +249,9 @@ int TfLiteDelegateMainImpl(const ExecuteNetworkParams& params,
             }
             std::cout << std::endl;
         }
+
+        ARMNN_LOG(info) << "\nInference time: " << std::setprecision(2)
+                        << std::fixed << inference_duration.count() << " ms\n";
     }
 
     return status;
@@ -349,6 +358,28 @@ int MainImpl(const ExecuteNetworkParams& params,
             }
         }
 
+        if (params.m_ThroughputThreads > 0)
+        {
+            // Additional copies of the network are loaded into the same runtime
+            std::vector<std::unique_ptr<InferenceModel<TParser, TDataType>>> modelCopies;
+            std::vector<InferenceModel<TParser, TDataType>*> models = { &model };
+            for (size_t i = 1; i < params.m_NetworkCopies; ++i)
+            {
+                modelCopies.push_back(std::make_unique<InferenceModel<TParser, TDataType>>(
+                    inferenceModelParams, params.m_EnableProfiling, params.m_DynamicBackendsPath, runtime));
+                models.push_back(modelCopies.back().get());
+            }
+
+            ThroughputBenchmarkOptions throughputOptions;
+            throughputOptions.m_Threads          = params.m_ThroughputThreads;
+            throughputOptions.m_Inferences       = params.m_Iterations;
+            throughputOptions.m_WarmupIterations = params.m_WarmupIterations;
+            throughputOptions.m_RequestRate      = params.m_RequestRate;
+
+            RunThroughputBenchmark(models, inputDataContainers, outputDataContainers, throughputOptions, std::cout);
+            return EXIT_SUCCESS;
+        }
+
         for (size_t x = 0; x < params.m_Iterations; x++)
         {
             // model.Run returns the inference time elapsed in EnqueueWorkload (in milliseconds)
@@ -206,6 +206,29 @@ void ExecuteNetworkParams::ValidateParams()
         {
             ARMNN_LOG(fatal) << "Threshold time supplied as a command line argument is less than zero.";
         }
+
+        if (m_ThroughputThreads == 0)
+        {
+            if (m_NetworkCopies != 1 || m_RequestRate != 0.0 || m_WarmupIterations != 0)
+            {
+                ARMNN_LOG(fatal) << "network-copies, request-rate and warmup-iterations require throughput-threads.";
+            }
+        }
+        else
+        {
+            if (m_NetworkCopies == 0 || m_NetworkCopies > m_ThroughputThreads)
+            {
+                ARMNN_LOG(fatal) << "network-copies must be between 1 and the number of throughput-threads.";
+            }
+            if (m_RequestRate < 0)
+            {
+                ARMNN_LOG(fatal) << "The request rate supplied as a command line argument is less than zero.";
+            }
+            if (m_EnableDelegate)
+            {
+                ARMNN_LOG(fatal) << "The throughput mode is not supported with the Arm NN TfLite delegate.";
+            }
+        }
     }
     catch (std::string& exc)
     {
@@ -25,12 +25,15 @@ struct ExecuteNetworkParams
     bool                          m_GenerateTensorData;
     bool                          m_InferOutputShape = false;
     bool                          m_EnableDelegate = false;
+    bool                          m_EnableDelegateImport = false;
+    bool                          m_EnableDelegateExport = false;
     std::vector<std::string>      m_InputNames;
     std::vector<std::string>      m_InputTensorDataFilePaths;
     std::vector<TensorShapePtr>   m_InputTensorShapes;
     std::vector<std::string>      m_InputTypes;
     bool                          m_IsModelBinary;
     size_t                        m_Iterations;
+    size_t                        m_NetworkCopies = 1;
     std::string                   m_ModelFormat;
     std::string                   m_ModelPath;
     std::vector<std::string>      m_OutputNames;
@@ -39,10 +42,13 @@ struct ExecuteNetworkParams
     bool                          m_ParseUnsupported = false;
     bool                          m_PrintIntermediate;
     bool                          m_QuantizeInput;
+    double                        m_RequestRate = 0.0;
     size_t                        m_SubgraphId;
     double                        m_ThresholdTime;
+    size_t                        m_ThroughputThreads = 0;
     int                           m_TuningLevel;
     std::string                   m_TuningPath;
+    size_t                        m_WarmupIterations = 0;
 
     // Ensures that the parameters for ExecuteNetwork fit together
     void ValidateParams();
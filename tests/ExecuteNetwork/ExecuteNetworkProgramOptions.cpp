@@ -172,6 +172,18 @@ ProgramOptions::ProgramOptions() : m_CxxOptions{"ExecuteNetwork",
                  "enable Arm NN TfLite delegate",
                  cxxopts::value<bool>(m_ExNetParams.m_EnableDelegate)->default_value("false")->implicit_value("true"))
 
+                ("delegate-import",
+                 "Lets the Arm NN TfLite delegate import its inputs from the TfLite buffers instead of copying them. "
+                 "Only used with armnn-tflite-delegate.",
+                 cxxopts::value<bool>(m_ExNetParams.m_EnableDelegateImport)
+                 ->default_value("false")->implicit_value("true"))
+
+                ("delegate-export",
+                 "Lets the Arm NN TfLite delegate export its outputs to the TfLite buffers instead of copying them. "
+                 "Only used with armnn-tflite-delegate.",
+                 cxxopts::value<bool>(m_ExNetParams.m_EnableDelegateExport)
+                 ->default_value("false")->implicit_value("true"))
+
                 ("m,model-path",
                  "Path to model file, e.g. .armnn, .caffemodel, .prototxt, .tflite, .onnx",
                  cxxopts::value<std::string>(m_ExNetParams.m_ModelPath))
@@ -327,6 +339,29 @@ ProgramOptions::ProgramOptions() : m_CxxOptions{"ExecuteNetwork",
                 ("u,counter-capture-period",
                  "If profiling is enabled in 'file-only' mode this is the capture period that will be used in the test",
                  cxxopts::value<uint32_t>(m_RuntimeOptions.m_ProfilingOptions.m_CapturePeriod)->default_value("150"));
+
+        m_CxxOptions.add_options("e) Throughput")
+                ("throughput-threads",
+                 "Enables the throughput mode: runs 'iterations' inferences in total from this many concurrent client "
+                 "threads and prints the throughput and a latency histogram (p50, p90, p99, p99.9) instead of the "
+                 "outputs. Defaults to 0 (throughput mode off).",
+                 cxxopts::value<size_t>(m_ExNetParams.m_ThroughputThreads)->default_value("0"))
+
+                ("network-copies",
+                 "Number of copies of the network loaded into the runtime in throughput mode. Thread i uses copy "
+                 "i % network-copies and a copy runs one inference at a time. Defaults to 1.",
+                 cxxopts::value<size_t>(m_ExNetParams.m_NetworkCopies)->default_value("1"))
+
+                ("request-rate",
+                 "Requests per second issued by an open-loop load generator in throughput mode. Latencies are "
+                 "measured from the time each request was scheduled, so they include queueing. Defaults to 0, "
+                 "where each thread issues its next request as soon as the previous one completes.",
+                 cxxopts::value<double>(m_ExNetParams.m_RequestRate)->default_value("0.0"))
+
+                ("warmup-iterations",
+                 "Number of inferences run on each network copy before the throughput run is measured. "
+                 "Defaults to 0.",
+                 cxxopts::value<size_t>(m_ExNetParams.m_WarmupIterations)->default_value("0"));
     }
     catch (const std::exception& e)
     {
@@ -0,0 +1,74 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "LatencyStatistics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <numeric>
+
+LatencyStatistics::LatencyStatistics(size_t expectedCount)
+    : m_Sorted(true)
+{
+    m_Latencies.reserve(expectedCount);
+}
+
+void LatencyStatistics::Add(Duration latency)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Latencies.push_back(latency.count());
+    m_Sorted = false;
+}
+
+size_t LatencyStatistics::GetCount() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Latencies.size();
+}
+
+LatencyStatistics::Duration LatencyStatistics::GetPercentile(double percentile) const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (m_Latencies.empty())
+    {
+        return Duration(0.0);
+    }
+    if (!m_Sorted)
+    {
+        std::sort(m_Latencies.begin(), m_Latencies.end());
+        m_Sorted = true;
+    }
+
+    const double clamped = std::min(std::max(percentile, 0.0), 100.0);
+    const size_t rank = static_cast<size_t>(std::ceil(clamped / 100.0 * static_cast<double>(m_Latencies.size())));
+    return Duration(m_Latencies[rank == 0 ? 0 : rank - 1]);
+}
+
+void LatencyStatistics::Print(std::ostream& os, Duration wallTime) const
+{
+    const size_t count = GetCount();
+    double mean = 0.0;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (count != 0)
+        {
+            mean = std::accumulate(m_Latencies.begin(), m_Latencies.end(), 0.0) / static_cast<double>(count);
+        }
+    }
+
+    const double seconds = wallTime.count() / 1000.0;
+    os << std::fixed << std::setprecision(3);
+    os << "Inferences: " << count << " in " << wallTime.count() << " ms\n";
+    os << "Throughput: " << (seconds > 0.0 ? static_cast<double>(count) / seconds : 0.0) << " inferences/s\n";
+    os << "Latency (ms):\n";
+    os << "  min    " << GetPercentile(0.0).count() << "\n";
+    os << "  mean   " << mean << "\n";
+    os << "  p50    " << GetPercentile(50.0).count() << "\n";
+    os << "  p90    " << GetPercentile(90.0).count() << "\n";
+    os << "  p99    " << GetPercentile(99.0).count() << "\n";
+    os << "  p99.9  " << GetPercentile(99.9).count() << "\n";
+    os << "  max    " << GetPercentile(100.0).count() << std::endl;
+}
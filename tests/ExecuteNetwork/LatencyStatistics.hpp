@@ -0,0 +1,37 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+/// Collects the latency of every inference of a throughput run, from any number of threads, and summarises them as
+/// a histogram of percentiles.
+class LatencyStatistics
+{
+public:
+    using Duration = std::chrono::duration<double, std::milli>;
+
+    explicit LatencyStatistics(size_t expectedCount = 0);
+
+    /// Thread safe
+    void Add(Duration latency);
+
+    size_t GetCount() const;
+
+    /// Nearest-rank percentile, percentile being in [0, 100]. Returns zero if nothing was recorded.
+    Duration GetPercentile(double percentile) const;
+
+    /// Prints the count, min, mean, p50, p90, p99, p99.9, max and the throughput over the given wall time.
+    void Print(std::ostream& os, Duration wallTime) const;
+
+private:
+    mutable std::mutex m_Mutex;
+    mutable std::vector<double> m_Latencies;
+    mutable bool m_Sorted;
+};
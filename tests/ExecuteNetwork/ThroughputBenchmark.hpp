@@ -0,0 +1,186 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "LatencyStatistics.hpp"
+
+#include <armnn/Exceptions.hpp>
+#include <armnn/Logging.hpp>
+
+#include <fmt/format.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+struct ThroughputBenchmarkOptions
+{
+    /// Number of client threads issuing inferences
+    size_t m_Threads = 1;
+
+    /// Number of measured inferences, across all threads
+    size_t m_Inferences = 1;
+
+    /// Number of inferences run on each network copy before measuring
+    size_t m_WarmupIterations = 0;
+
+    /// Requests per second issued by the open-loop load generator. With 0, every thread starts its next inference as
+    /// soon as the previous one completes (closed loop).
+    double m_RequestRate = 0.0;
+};
+
+/// Runs inferences from several client threads on one or several loaded copies of a network and prints the
+/// throughput and latency percentiles.
+///
+/// Client thread i uses copy i % models.size(). A loaded network executes one inference at a time, so the threads
+/// sharing a copy queue on it. In open-loop mode the latency of a request is measured from the time it was scheduled,
+/// so time spent waiting for a free thread or copy is included.
+template <typename TModel>
+void RunThroughputBenchmark(const std::vector<TModel*>& models,
+                            const std::vector<typename TModel::TContainer>& inputContainers,
+                            const std::vector<typename TModel::TContainer>& outputContainers,
+                            const ThroughputBenchmarkOptions& options,
+                            std::ostream& os)
+{
+    using Clock = std::chrono::steady_clock;
+    using TContainer = typename TModel::TContainer;
+
+    if (models.empty() || options.m_Threads == 0)
+    {
+        throw armnn::InvalidArgumentException("A throughput run needs at least one network and one thread");
+    }
+
+    std::vector<std::mutex> modelMutexes(models.size());
+    std::vector<std::vector<TContainer>> threadOutputs(options.m_Threads, outputContainers);
+
+    for (size_t i = 0; i < models.size(); ++i)
+    {
+        for (size_t j = 0; j < options.m_WarmupIterations; ++j)
+        {
+            models[i]->Run(inputContainers, threadOutputs[0]);
+        }
+    }
+
+    LatencyStatistics statistics(options.m_Inferences);
+    std::atomic<size_t> failures(0);
+
+    auto runInference = [&](size_t threadIndex)
+    {
+        const size_t modelIndex = threadIndex % models.size();
+        try
+        {
+            std::lock_guard<std::mutex> lock(modelMutexes[modelIndex]);
+            models[modelIndex]->Run(inputContainers, threadOutputs[threadIndex]);
+        }
+        catch (const armnn::Exception& e)
+        {
+            ARMNN_LOG(error) << "Inference failed on thread " << threadIndex << ": " << e.what();
+            ++failures;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(options.m_Threads);
+    const Clock::time_point start = Clock::now();
+
+    if (options.m_RequestRate <= 0.0)
+    {
+        std::atomic<size_t> nextInference(0);
+        for (size_t t = 0; t < options.m_Threads; ++t)
+        {
+            threads.emplace_back([&, t]()
+            {
+                while (nextInference++ < options.m_Inferences)
+                {
+                    const Clock::time_point issued = Clock::now();
+                    runInference(t);
+                    statistics.Add(Clock::now() - issued);
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+    else
+    {
+        std::mutex queueMutex;
+        std::condition_variable queueCondition;
+        std::queue<Clock::time_point> requests;
+        bool generatorDone = false;
+
+        for (size_t t = 0; t < options.m_Threads; ++t)
+        {
+            threads.emplace_back([&, t]()
+            {
+                while (true)
+                {
+                    Clock::time_point scheduled;
+                    {
+                        std::unique_lock<std::mutex> lock(queueMutex);
+                        queueCondition.wait(lock, [&]() { return !requests.empty() || generatorDone; });
+                        if (requests.empty())
+                        {
+                            return;
+                        }
+                        scheduled = requests.front();
+                        requests.pop();
+                    }
+                    runInference(t);
+                    statistics.Add(Clock::now() - scheduled);
+                }
+            });
+        }
+
+        // Requests are scheduled at a fixed rate whatever the state of the clients, so a backlog shows up as latency
+        const std::chrono::duration<double> interval(1.0 / options.m_RequestRate);
+        for (size_t i = 0; i < options.m_Inferences; ++i)
+        {
+            const Clock::time_point scheduled =
+                start + std::chrono::duration_cast<Clock::duration>(interval * static_cast<double>(i));
+            std::this_thread::sleep_until(scheduled);
+            {
+                std::lock_guard<std::mutex> lock(queueMutex);
+                requests.push(scheduled);
+            }
+            queueCondition.notify_one();
+        }
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            generatorDone = true;
+        }
+        queueCondition.notify_all();
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    const LatencyStatistics::Duration wallTime = Clock::now() - start;
+
+    if (failures > 0)
+    {
+        throw armnn::Exception(fmt::format("{} of {} inferences failed during the throughput run",
+                                           failures.load(), options.m_Inferences));
+    }
+
+    os << "Throughput run: " << options.m_Threads << " thread(s), " << models.size() << " network copy(ies), ";
+    if (options.m_RequestRate > 0.0)
+    {
+        os << "open loop at " << options.m_RequestRate << " requests/s\n";
+    }
+    else
+    {
+        os << "closed loop\n";
+    }
+    statistics.Print(os, wallTime);
+}
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: MIT
 //
 #include "InferenceTest.hpp"
+#include "PrefetchQueue.hpp"
 
 #include <armnn/utility/Assert.hpp>
 #include <Filesystem.hpp>
@@ -43,7 +44,14 @@ bool ParseCommandLine(int argc, char** argv, IInferenceTestCaseProvider& testCas
                  "If non-empty, each individual inference time will be recorded and output to this file",
                  cxxopts::value<std::string>(outParams.m_InferenceTimesFile)->default_value(""))
                 ("e,event-based-profiling", "Enables built in profiler. If unset, defaults to off.",
-                 cxxopts::value<bool>(outParams.m_EnableProfiling)->default_value("0"));
+                 cxxopts::value<bool>(outParams.m_EnableProfiling)->default_value("0"))
+                ("prefetch-threads",
+                 "Number of threads loading and preprocessing the next test cases while the current one runs. "
+                 "If unset, defaults to 0 and test cases are loaded one at a time.",
+                 cxxopts::value<unsigned int>(outParams.m_PrefetchThreadCount)->default_value("0"))
+                ("prefetch-queue-size",
+                 "Maximum number of test cases loaded ahead of the one running when prefetch-threads is set.",
+                 cxxopts::value<unsigned int>(outParams.m_PrefetchQueueSize)->default_value("8"));
 
         std::vector<std::string> required; //to be passed as reference to derived inference tests
 
@@ -169,10 +177,28 @@ bool InferenceTest(const InferenceTestOptions& params,
     const unsigned int nbTotalToProcess = params.m_IterationCount > 0 ? params.m_IterationCount
         : static_cast<unsigned int>(defaultTestCaseIds.size());
 
+    auto getTestCaseId = [&](unsigned int index)
+    {
+        return params.m_IterationCount > 0 ? index : defaultTestCaseIds[index];
+    };
+
+    // Loading a test case usually means decoding and preprocessing an image, which can be done for the next test
+    // cases while the current one runs. The provider's GetTestCase is then called from several threads.
+    std::unique_ptr<PrefetchQueue<std::unique_ptr<IInferenceTestCase>>> prefetchQueue;
+    if (params.m_PrefetchThreadCount > 0 && nbTotalToProcess > 0)
+    {
+        prefetchQueue = std::make_unique<PrefetchQueue<std::unique_ptr<IInferenceTestCase>>>(
+            nbTotalToProcess,
+            [&](unsigned int index) { return testCaseProvider.GetTestCase(getTestCaseId(index)); },
+            params.m_PrefetchThreadCount,
+            params.m_PrefetchQueueSize);
+    }
+
     for (; nbProcessed < nbTotalToProcess; nbProcessed++)
     {
-        const unsigned int testCaseId = params.m_IterationCount > 0 ? nbProcessed : defaultTestCaseIds[nbProcessed];
-        std::unique_ptr<IInferenceTestCase> testCase = testCaseProvider.GetTestCase(testCaseId);
+        const unsigned int testCaseId = getTestCaseId(nbProcessed);
+        std::unique_ptr<IInferenceTestCase> testCase = prefetchQueue ? prefetchQueue->Next()
+                                                                     : testCaseProvider.GetTestCase(testCaseId);
 
         if (testCase == nullptr)
         {
@@ -60,11 +60,15 @@ struct InferenceTestOptions
     std::string m_InferenceTimesFile;
     bool m_EnableProfiling;
     std::string m_DynamicBackendsPath;
+    unsigned int m_PrefetchThreadCount;
+    unsigned int m_PrefetchQueueSize;
 
     InferenceTestOptions()
         : m_IterationCount(0)
         , m_EnableProfiling(0)
         , m_DynamicBackendsPath()
+        , m_PrefetchThreadCount(0)
+        , m_PrefetchQueueSize(8)
     {}
 };
 
@@ -5,6 +5,7 @@
 
 #include "../ImageTensorGenerator/ImageTensorGenerator.hpp"
 #include "../InferenceTest.hpp"
+#include "../PrefetchQueue.hpp"
 #include "ModelAccuracyChecker.hpp"
 #include "armnnDeserializer/IDeserializer.hpp"
 #include <Filesystem.hpp>
@@ -62,6 +63,8 @@ int main(int argc, char* argv[])
         std::vector<armnn::BackendId> computeDevice;
         std::string validationRange;
         std::string blacklistPath;
+        unsigned int prefetchThreads;
+        unsigned int prefetchQueueSize;
 
         const std::string backendsMessage = "Which device to run layers on by default. Possible choices: "
                                             + armnn::BackendRegistryInstance().GetBackendIdsAsString();
@@ -107,7 +110,14 @@ int main(int argc, char* argv[])
                 ("b,blacklist-path",
                     "Path to a blacklist file where each line denotes the index of an image to be "
                     "excluded from evaluation.",
-                    cxxopts::value<std::string>(blacklistPath)->default_value(""));
+                    cxxopts::value<std::string>(blacklistPath)->default_value(""))
+                ("prefetch-threads",
+                    "Number of threads loading and preprocessing the next images while the current ones run "
+                    "through the network. Default: 1",
+                    cxxopts::value<unsigned int>(prefetchThreads)->default_value("1"))
+                ("prefetch-queue-size",
+                    "Maximum number of preprocessed images waiting to run through the network. Default: 16",
+                    cxxopts::value<unsigned int>(prefetchQueueSize)->default_value("16"));
 
             auto result = options.parse(argc, argv);
 
@@ -299,8 +309,10 @@ int main(int argc, char* argv[])
                 inputTensorDataLayout == armnn::DataLayout::NCHW ? inputTensorShape[3] : inputTensorShape[2];
             const unsigned int inputTensorHeight =
                 inputTensorDataLayout == armnn::DataLayout::NCHW ? inputTensorShape[2] : inputTensorShape[1];
+            // The images are run through the network as many at a time as its batch dimension holds
+            const unsigned int batchSize = inputTensorShape[0];
             // Get output tensor info
-            const unsigned int outputNumElements = model.GetOutputSize();
+            const unsigned int outputNumElements = model.GetOutputSize() / batchSize;
             // Check output tensor shape is valid
             if (modelOutputLabels.size() != outputNumElements)
             {
@@ -309,7 +321,6 @@ int main(int argc, char* argv[])
                 return EXIT_FAILURE;
             }
 
-            const unsigned int batchSize = 1;
             // Get normalisation parameters
             SupportedFrontend modelFrontend;
             if (modelFormat == "caffe")
@@ -330,44 +341,77 @@ int main(int argc, char* argv[])
                 return EXIT_FAILURE;
             }
             const NormalizationParameters& normParams = GetNormalizationParameters(modelFrontend, inputTensorDataType);
+            std::vector<std::string> imageNames;
             for (const auto& imageEntry : imageNameToLabel)
             {
-                const std::string imageName = imageEntry.first;
-                std::cout << "Processing image: " << imageName << "\n";
+                imageNames.push_back(imageEntry.first);
+            }
 
-                vector<TContainer> inputDataContainers;
-                vector<TContainer> outputDataContainers;
+            // Decoding and preprocessing the images is done ahead on worker threads, overlapped with the inferences
+            auto prepareImage = [&](unsigned int imageIndex) -> TContainer
+            {
+                auto imagePath = pathToDataDir / fs::path(imageNames[imageIndex]);
+                switch (inputTensorDataType)
+                {
+                    case armnn::DataType::Signed32:
+                        return PrepareImageTensor<int>(imagePath.string(),
+                                                       inputTensorWidth, inputTensorHeight,
+                                                       normParams,
+                                                       1,
+                                                       inputTensorDataLayout);
+                    case armnn::DataType::QAsymmU8:
+                        return PrepareImageTensor<uint8_t>(imagePath.string(),
+                                                           inputTensorWidth, inputTensorHeight,
+                                                           normParams,
+                                                           1,
+                                                           inputTensorDataLayout);
+                    case armnn::DataType::Float32:
+                    default:
+                        return PrepareImageTensor<float>(imagePath.string(),
+                                                         inputTensorWidth, inputTensorHeight,
+                                                         normParams,
+                                                         1,
+                                                         inputTensorDataLayout);
+                }
+            };
+            const unsigned int numImages = armnn::numeric_cast<unsigned int>(imageNames.size());
+            PrefetchQueue<TContainer> preparedImages(numImages, prepareImage, prefetchThreads, prefetchQueueSize);
+
+            for (unsigned int batchBegin = 0; batchBegin < numImages; batchBegin += batchSize)
+            {
+                const unsigned int numImagesInBatch = std::min(batchSize, numImages - batchBegin);
+
+                // The images are concatenated along the batch dimension. A last incomplete batch is filled up with
+                // copies of its last image, whose results are ignored.
+                vector<TContainer> inputDataContainers = { preparedImages.Next() };
+                TContainer lastImage = inputDataContainers[0];
+                for (unsigned int i = 1; i < batchSize; ++i)
+                {
+                    if (i < numImagesInBatch)
+                    {
+                        lastImage = preparedImages.Next();
+                    }
+                    mapbox::util::apply_visitor([&lastImage](auto&& batchData)
+                    {
+                        using ValueType = typename std::decay_t<decltype(batchData)>::value_type;
+                        const auto& imageData = lastImage.template get<std::vector<ValueType>>();
+                        batchData.insert(batchData.end(), imageData.begin(), imageData.end());
+                    },
+                    inputDataContainers[0]);
+                }
 
-                auto imagePath = pathToDataDir / fs::path(imageName);
+                vector<TContainer> outputDataContainers;
                 switch (inputTensorDataType)
                 {
                     case armnn::DataType::Signed32:
-                        inputDataContainers.push_back(
-                            PrepareImageTensor<int>(imagePath.string(),
-                            inputTensorWidth, inputTensorHeight,
-                            normParams,
-                            batchSize,
-                            inputTensorDataLayout));
-                        outputDataContainers = { vector<int>(outputNumElements) };
+                        outputDataContainers = { vector<int>(outputNumElements * batchSize) };
                         break;
                     case armnn::DataType::QAsymmU8:
-                        inputDataContainers.push_back(
-                            PrepareImageTensor<uint8_t>(imagePath.string(),
-                            inputTensorWidth, inputTensorHeight,
-                            normParams,
-                            batchSize,
-                            inputTensorDataLayout));
-                        outputDataContainers = { vector<uint8_t>(outputNumElements) };
+                        outputDataContainers = { vector<uint8_t>(outputNumElements * batchSize) };
                         break;
                     case armnn::DataType::Float32:
                     default:
-                        inputDataContainers.push_back(
-                            PrepareImageTensor<float>(imagePath.string(),
-                            inputTensorWidth, inputTensorHeight,
-                            normParams,
-                            batchSize,
-                            inputTensorDataLayout));
-                        outputDataContainers = { vector<float>(outputNumElements) };
+                        outputDataContainers = { vector<float>(outputNumElements * batchSize) };
                         break;
                 }
 
@@ -375,12 +419,26 @@ int main(int argc, char* argv[])
                                                   armnnUtils::MakeInputTensors(inputBindings, inputDataContainers),
                                                   armnnUtils::MakeOutputTensors(outputBindings, outputDataContainers));
 
-                if (status == armnn::Status::Failure)
+                for (unsigned int i = 0; i < numImagesInBatch; ++i)
                 {
-                    ARMNN_LOG(fatal) << "armnn::IRuntime: Failed to enqueue workload for image: " << imageName;
+                    const std::string& imageName = imageNames[batchBegin + i];
+                    std::cout << "Processing image: " << imageName << "\n";
+
+                    if (status == armnn::Status::Failure)
+                    {
+                        ARMNN_LOG(fatal) << "armnn::IRuntime: Failed to enqueue workload for image: " << imageName;
+                    }
+
+                    vector<TContainer> imageOutput;
+                    mapbox::util::apply_visitor([&](auto&& batchOutput)
+                    {
+                        using OutputType = typename std::decay_t<decltype(batchOutput)>;
+                        imageOutput.push_back(OutputType(batchOutput.begin() + i * outputNumElements,
+                                                         batchOutput.begin() + (i + 1) * outputNumElements));
+                    },
+                    outputDataContainers[0]);
+                    checker.AddImageResult<TContainer>(imageName, imageOutput);
                 }
-
-                checker.AddImageResult<TContainer>(imageName, outputDataContainers);
             }
         }
         else
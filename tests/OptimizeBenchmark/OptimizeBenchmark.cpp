@@ -0,0 +1,112 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <armnn/ArmNN.hpp>
+
+#include <LayerSupportCache.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+// Times Optimize on a synthetic network of repeated convolution blocks, with the layer support cache cleared before
+// every iteration (cold) and with the results of the previous iteration kept (warm).
+// Usage: OptimizeBenchmark [numBlocks] [numIterations]
+
+namespace
+{
+
+armnn::INetworkPtr CreateNetwork(unsigned int numBlocks)
+{
+    using namespace armnn;
+
+    const TensorInfo info({ 1, 16, 16, 8 }, DataType::Float32);
+    const TensorInfo weightsInfo({ 8, 3, 3, 8 }, DataType::Float32);
+    const TensorInfo biasInfo({ 8 }, DataType::Float32);
+    const std::vector<float> weightsData(weightsInfo.GetNumElements(), 0.01f);
+    const std::vector<float> biasData(biasInfo.GetNumElements(), 0.0f);
+
+    Convolution2dDescriptor convDescriptor;
+    convDescriptor.m_PadLeft = convDescriptor.m_PadRight = convDescriptor.m_PadTop = convDescriptor.m_PadBottom = 1;
+    convDescriptor.m_StrideX = convDescriptor.m_StrideY = 1;
+    convDescriptor.m_BiasEnabled = true;
+    convDescriptor.m_DataLayout = DataLayout::NHWC;
+
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::BoundedReLu;
+    activationDescriptor.m_A = 6.0f;
+
+    INetworkPtr net(INetwork::Create());
+    IConnectableLayer* previous = net->AddInputLayer(0);
+    previous->GetOutputSlot(0).SetTensorInfo(info);
+
+    for (unsigned int i = 0; i < numBlocks; ++i)
+    {
+        IConnectableLayer* conv = net->AddConvolution2dLayer(convDescriptor,
+                                                             ConstTensor(weightsInfo, weightsData),
+                                                             Optional<ConstTensor>(ConstTensor(biasInfo, biasData)));
+        IConnectableLayer* activation = net->AddActivationLayer(activationDescriptor);
+        IConnectableLayer* addition = net->AddAdditionLayer();
+
+        previous->GetOutputSlot(0).Connect(conv->GetInputSlot(0));
+        conv->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+        activation->GetOutputSlot(0).Connect(addition->GetInputSlot(0));
+        previous->GetOutputSlot(0).Connect(addition->GetInputSlot(1));
+
+        conv->GetOutputSlot(0).SetTensorInfo(info);
+        activation->GetOutputSlot(0).SetTensorInfo(info);
+        addition->GetOutputSlot(0).SetTensorInfo(info);
+        previous = addition;
+    }
+
+    previous->GetOutputSlot(0).Connect(net->AddOutputLayer(0)->GetInputSlot(0));
+    return net;
+}
+
+double TimeOptimize(const armnn::INetwork& net, const armnn::IRuntime& runtime, bool clearCache)
+{
+    if (clearCache)
+    {
+        armnn::LayerSupportCache::GetInstance().Clear();
+    }
+
+    const std::vector<armnn::BackendId> backends = { armnn::Compute::CpuRef };
+    const auto start = std::chrono::steady_clock::now();
+    armnn::IOptimizedNetworkPtr optNet = armnn::Optimize(net, backends, runtime.GetDeviceSpec());
+    const auto end = std::chrono::steady_clock::now();
+
+    if (!optNet)
+    {
+        std::cerr << "Optimize failed" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+    const unsigned int numBlocks = argc > 1 ? static_cast<unsigned int>(std::atoi(argv[1])) : 500;
+    const unsigned int numIterations = argc > 2 ? static_cast<unsigned int>(std::atoi(argv[2])) : 10;
+
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(armnn::IRuntime::CreationOptions()));
+    armnn::INetworkPtr net = CreateNetwork(numBlocks);
+
+    double coldTotal = 0.0;
+    double warmTotal = 0.0;
+    for (unsigned int i = 0; i < numIterations; ++i)
+    {
+        coldTotal += TimeOptimize(*net, *runtime, true);
+        warmTotal += TimeOptimize(*net, *runtime, false);
+    }
+
+    std::cout << "Optimize of " << numBlocks * 3 + 2 << " layers, average of " << numIterations << " iterations"
+              << std::endl;
+    std::cout << "  layer support cache cleared: " << coldTotal / numIterations << " ms" << std::endl;
+    std::cout << "  layer support cache warm:    " << warmTotal / numIterations << " ms" << std::endl;
+    return EXIT_SUCCESS;
+}
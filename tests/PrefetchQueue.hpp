@@ -0,0 +1,161 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/Exceptions.hpp>
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace armnn
+{
+namespace test
+{
+
+/// Produces the items 0 to numItems - 1 of a dataset on worker threads, so that loading and preprocessing them
+/// overlaps with whatever the consumer does with the previous ones. Items are handed out in order by Next() and the
+/// workers never run more than queueSize items ahead of the consumer, which bounds the memory used.
+///
+/// The produce function is called concurrently from the worker threads, with distinct indices.
+template <typename TItem>
+class PrefetchQueue
+{
+public:
+    PrefetchQueue(unsigned int numItems,
+                  std::function<TItem(unsigned int)> produce,
+                  unsigned int numThreads,
+                  unsigned int queueSize)
+        : m_NumItems(numItems)
+        , m_Produce(std::move(produce))
+        , m_Slots(queueSize)
+        , m_NextToProduce(0)
+        , m_NextToConsume(0)
+        , m_Stop(false)
+    {
+        if (numThreads == 0 || queueSize == 0)
+        {
+            throw InvalidArgumentException("A prefetch queue needs at least one thread and one slot");
+        }
+
+        m_Threads.reserve(numThreads);
+        for (unsigned int i = 0; i < numThreads; ++i)
+        {
+            m_Threads.emplace_back(&PrefetchQueue::Work, this);
+        }
+    }
+
+    ~PrefetchQueue()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Stop = true;
+        }
+        m_Condition.notify_all();
+        for (std::thread& thread : m_Threads)
+        {
+            thread.join();
+        }
+    }
+
+    PrefetchQueue(const PrefetchQueue&) = delete;
+    PrefetchQueue& operator=(const PrefetchQueue&) = delete;
+
+    /// Returns the next item once it is ready, rethrowing any exception thrown while producing it.
+    TItem Next()
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        if (m_NextToConsume >= m_NumItems)
+        {
+            throw InvalidArgumentException("All the items of the prefetch queue have been consumed");
+        }
+
+        Slot& slot = m_Slots[m_NextToConsume % m_Slots.size()];
+        m_Condition.wait(lock, [&slot]() { return slot.m_Ready; });
+
+        std::exception_ptr error = slot.m_Error;
+        TItem item = std::move(slot.m_Item);
+        slot = Slot();
+        ++m_NextToConsume;
+        lock.unlock();
+
+        // A slot was freed, so a worker can start on a new item
+        m_Condition.notify_all();
+
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+        return item;
+    }
+
+private:
+    struct Slot
+    {
+        Slot() : m_Ready(false) {}
+
+        TItem              m_Item;
+        std::exception_ptr m_Error;
+        bool               m_Ready;
+    };
+
+    void Work()
+    {
+        while (true)
+        {
+            unsigned int index;
+            {
+                std::unique_lock<std::mutex> lock(m_Mutex);
+                m_Condition.wait(lock, [this]()
+                {
+                    return m_Stop || m_NextToProduce >= m_NumItems ||
+                           m_NextToProduce < m_NextToConsume + m_Slots.size();
+                });
+                if (m_Stop || m_NextToProduce >= m_NumItems)
+                {
+                    return;
+                }
+                index = m_NextToProduce++;
+            }
+
+            TItem item;
+            std::exception_ptr error;
+            try
+            {
+                item = m_Produce(index);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                Slot& slot = m_Slots[index % m_Slots.size()];
+                slot.m_Item = std::move(item);
+                slot.m_Error = error;
+                slot.m_Ready = true;
+            }
+            m_Condition.notify_all();
+        }
+    }
+
+    const unsigned int m_NumItems;
+    std::function<TItem(unsigned int)> m_Produce;
+    std::vector<Slot> m_Slots;
+    std::vector<std::thread> m_Threads;
+
+    std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    unsigned int m_NextToProduce;
+    unsigned int m_NextToConsume;
+    bool m_Stop;
+};
+
+} // namespace test
+} // namespace armnn
@@ -0,0 +1,564 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <armnn/Logging.hpp>
+#include <armnn/TypesUtils.hpp>
+#include <armnnUtils/TensorUtils.hpp>
+
+#include <Half.hpp>
+
+#include <backendsCommon/CpuTensorHandle.hpp>
+#include <backendsCommon/test/TensorCopyUtils.hpp>
+#include <backendsCommon/test/WorkloadTestUtils.hpp>
+#include <reference/test/RefWorkloadFactoryHelper.hpp>
+
+#include <cxxopts/cxxopts.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Times the Execute() of individual reference workloads across data types, data layouts and tensor sizes, and writes
+// one CSV row per configuration so that kernel regressions and improvements can be tracked over time.
+//
+// The workloads are set up the way the layer tests in backendsCommon/test/layerTests do it: tensor infos come from
+// armnnUtils::GetTensorInfo, handles from the RefTensorHandleFactory and queue descriptors are filled with
+// AddInputToWorkload/AddOutputToWorkload. Only the inputs are random and large enough to be worth timing.
+
+namespace
+{
+
+using namespace armnn;
+
+struct TensorSize
+{
+    const char*  m_Name;
+    unsigned int m_Batches;
+    unsigned int m_Channels;
+    unsigned int m_Height;
+    unsigned int m_Width;
+};
+
+const std::vector<TensorSize> g_TensorSizes =
+{
+    { "small",  1, 16, 28, 28 },
+    { "medium", 1, 32, 56, 56 },
+};
+
+const std::vector<DataType> g_DataTypes = { DataType::Float32, DataType::Float16, DataType::QAsymmU8 };
+
+const std::vector<DataLayout> g_DataLayouts = { DataLayout::NCHW, DataLayout::NHWC };
+
+/// Creates the tensors of a workload and keeps them alive for as long as the workload runs.
+class WorkloadTensors
+{
+public:
+    WorkloadTensors(DataType dataType, std::mt19937& generator)
+        : m_DataType(dataType)
+        , m_Generator(generator)
+        , m_MemoryManager(RefWorkloadFactoryHelper::GetMemoryManager())
+        , m_TensorHandleFactory(RefWorkloadFactoryHelper::GetTensorHandleFactory(m_MemoryManager))
+    {}
+
+    /// Tensor info of the data type being benchmarked, with the quantization used for all activations.
+    TensorInfo MakeInfo(const TensorShape& shape) const
+    {
+        return MakeInfo(shape, m_DataType);
+    }
+
+    /// 4D tensor info shaped for the data layout, as the layer tests get it.
+    TensorInfo MakeInfo(const TensorSize& size, DataLayout dataLayout) const
+    {
+        TensorInfo info = armnnUtils::GetTensorInfo(size.m_Batches, size.m_Channels, size.m_Height, size.m_Width,
+                                                    dataLayout, m_DataType);
+        return MakeInfo(info.GetShape());
+    }
+
+    /// Bias of a layer whose input and weights are of the data type being benchmarked.
+    TensorInfo MakeBiasInfo(const TensorShape& shape) const
+    {
+        TensorInfo info = MakeInfo(shape, IsQuantizedType(m_DataType) ? DataType::Signed32 : m_DataType);
+        if (IsQuantizedType(m_DataType))
+        {
+            info.SetQuantizationScale(ms_QuantizationScale * ms_QuantizationScale);
+            info.SetQuantizationOffset(0);
+        }
+        return info;
+    }
+
+    ITensorHandle* AddInput(const TensorInfo& info)
+    {
+        std::unique_ptr<ITensorHandle> handle = m_TensorHandleFactory.CreateTensorHandle(info);
+        handle->Allocate();
+        CopyDataToITensorHandle(handle.get(), RandomData(info).data());
+        m_TensorHandles.push_back(std::move(handle));
+        return m_TensorHandles.back().get();
+    }
+
+    ITensorHandle* AddOutput(const TensorInfo& info)
+    {
+        std::unique_ptr<ITensorHandle> handle = m_TensorHandleFactory.CreateTensorHandle(info);
+        handle->Allocate();
+        m_TensorHandles.push_back(std::move(handle));
+        return m_TensorHandles.back().get();
+    }
+
+    const ScopedCpuTensorHandle* AddConstant(const TensorInfo& info)
+    {
+        m_Constants.push_back(std::make_unique<ScopedCpuTensorHandle>(info));
+        AllocateAndCopyDataToITensorHandle(m_Constants.back().get(), RandomData(info).data());
+        return m_Constants.back().get();
+    }
+
+    RefWorkloadFactory& GetFactory()
+    {
+        return m_Factory;
+    }
+
+private:
+    static TensorInfo MakeInfo(const TensorShape& shape, DataType dataType)
+    {
+        TensorInfo info(shape, dataType);
+        if (IsQuantizedType(dataType))
+        {
+            info.SetQuantizationScale(ms_QuantizationScale);
+            info.SetQuantizationOffset(dataType == DataType::QAsymmU8 ? 128 : 0);
+        }
+        return info;
+    }
+
+    std::vector<uint8_t> RandomData(const TensorInfo& info)
+    {
+        std::vector<uint8_t> data(info.GetNumBytes());
+        const unsigned int numElements = info.GetNumElements();
+        switch (info.GetDataType())
+        {
+            case DataType::Float32:
+                Fill<float>(data, numElements, [](float value) { return value; });
+                break;
+            case DataType::Float16:
+                Fill<Half>(data, numElements, [](float value) { return Half(value); });
+                break;
+            case DataType::Signed32:
+                Fill<int32_t>(data, numElements, [](float value) { return static_cast<int32_t>(value * 100.0f); });
+                break;
+            default:
+                std::uniform_int_distribution<int> distribution(0, 255);
+                std::generate(data.begin(), data.end(),
+                              [&]() { return static_cast<uint8_t>(distribution(m_Generator)); });
+                break;
+        }
+        return data;
+    }
+
+    template <typename T>
+    void Fill(std::vector<uint8_t>& data, unsigned int numElements, const std::function<T(float)>& convert)
+    {
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+        T* elements = reinterpret_cast<T*>(data.data());
+        for (unsigned int i = 0; i < numElements; ++i)
+        {
+            elements[i] = convert(distribution(m_Generator));
+        }
+    }
+
+    static constexpr float ms_QuantizationScale = 0.05f;
+
+    DataType m_DataType;
+    std::mt19937& m_Generator;
+    IBackendInternal::IMemoryManagerSharedPtr m_MemoryManager;
+    RefTensorHandleFactory m_TensorHandleFactory;
+    RefWorkloadFactory m_Factory;
+    std::vector<std::unique_ptr<ITensorHandle>> m_TensorHandles;
+    std::vector<std::unique_ptr<ScopedCpuTensorHandle>> m_Constants;
+};
+
+using WorkloadCreator =
+    std::function<std::unique_ptr<IWorkload>(WorkloadTensors&, const TensorSize&, DataLayout, TensorShape&)>;
+
+struct WorkloadBenchmark
+{
+    std::string     m_Name;
+    bool            m_IsLayoutDependent;
+    WorkloadCreator m_Create;
+};
+
+template <typename QueueDescriptor>
+void AddInput(QueueDescriptor& descriptor, WorkloadInfo& info, WorkloadTensors& tensors, const TensorInfo& tensorInfo)
+{
+    AddInputToWorkload(descriptor, info, tensorInfo, tensors.AddInput(tensorInfo));
+}
+
+template <typename QueueDescriptor>
+void AddOutput(QueueDescriptor& descriptor, WorkloadInfo& info, WorkloadTensors& tensors, const TensorInfo& tensorInfo)
+{
+    AddOutputToWorkload(descriptor, info, tensorInfo, tensors.AddOutput(tensorInfo));
+}
+
+std::unique_ptr<IWorkload> CreatePooling2d(PoolingAlgorithm algorithm,
+                                           WorkloadTensors& tensors,
+                                           const TensorSize& size,
+                                           DataLayout dataLayout,
+                                           TensorShape& inputShape)
+{
+    const TensorInfo inputInfo = tensors.MakeInfo(size, dataLayout);
+    TensorSize outputSize = size;
+    outputSize.m_Height = (size.m_Height - 3) / 2 + 1;
+    outputSize.m_Width = (size.m_Width - 3) / 2 + 1;
+
+    Pooling2dQueueDescriptor descriptor;
+    WorkloadInfo info;
+    AddInput(descriptor, info, tensors, inputInfo);
+    AddOutput(descriptor, info, tensors, tensors.MakeInfo(outputSize, dataLayout));
+    descriptor.m_Parameters.m_PoolType = algorithm;
+    descriptor.m_Parameters.m_PoolWidth = descriptor.m_Parameters.m_PoolHeight = 3;
+    descriptor.m_Parameters.m_StrideX = descriptor.m_Parameters.m_StrideY = 2;
+    descriptor.m_Parameters.m_DataLayout = dataLayout;
+
+    inputShape = inputInfo.GetShape();
+    return tensors.GetFactory().CreatePooling2d(descriptor, info);
+}
+
+const std::vector<WorkloadBenchmark>& GetWorkloadBenchmarks()
+{
+    static const std::vector<WorkloadBenchmark> benchmarks =
+    {
+        {
+            "Activation", false,
+            [](WorkloadTensors& tensors, const TensorSize& size, DataLayout dataLayout, TensorShape& inputShape)
+            {
+                const TensorInfo tensorInfo = tensors.MakeInfo(size, dataLayout);
+                ActivationQueueDescriptor descriptor;
+                WorkloadInfo info;
+                AddInput(descriptor, info, tensors, tensorInfo);
+                AddOutput(descriptor, info, tensors, tensorInfo);
+                descriptor.m_Parameters.m_Function = ActivationFunction::ReLu;
+
+                inputShape = tensorInfo.GetShape();
+                return tensors.GetFactory().CreateActivation(descriptor, info);
+            }
+        },
+        {
+            "Addition", false,
+            [](WorkloadTensors& tensors, const TensorSize& size, DataLayout dataLayout, TensorShape& inputShape)
+            {
+                const TensorInfo tensorInfo = tensors.MakeInfo(size, dataLayout);
+                AdditionQueueDescriptor descriptor;
+                WorkloadInfo info;
+                AddInput(descriptor, info, tensors, tensorInfo);
+                AddInput(descriptor, info, tensors, tensorInfo);
+                AddOutput(descriptor, info, tensors, tensorInfo);
+
+                inputShape = tensorInfo.GetShape();
+                return tensors.GetFactory().CreateAddition(descriptor, info);
+            }
+        },
+        {
+            "BatchNormalization", true,
+            [](WorkloadTensors& tensors, const TensorSize& size, DataLayout dataLayout, TensorShape& inputShape)
+            {
+                const TensorInfo tensorInfo = tensors.MakeInfo(size, dataLayout);
+                const TensorInfo paramsInfo = tensors.MakeInfo(TensorShape({ size.m_Channels }));
+                BatchNormalizationQueueDescriptor descriptor;
+                WorkloadInfo info;
+                AddInput(descriptor, info, tensors, tensorInfo);
+                AddOutput(descriptor, info, tensors, tensorInfo);
+                descriptor.m_Mean = tensors.AddConstant(paramsInfo);
+                descriptor.m_Variance = tensors.AddConstant(paramsInfo);
+                descriptor.m_Beta = tensors.AddConstant(paramsInfo);
+                descriptor.m_Gamma = tensors.AddConstant(paramsInfo);
+                descriptor.m_Parameters.m_DataLayout = dataLayout;
+
+                inputShape = tensorInfo.GetShape();
+                return tensors.GetFactory().CreateBatchNormalization(descriptor, info);
+            }
+        },
+        {
+            "Convolution2d", true,
+            [](WorkloadTensors& tensors, const TensorSize& size, DataLayout dataLayout, TensorShape& inputShape)
+            {
+                // 3x3 kernel with the same number of output channels, padded to keep the size. The weights are
+                // shaped like a tensor with one batch per output channel.
+                const TensorInfo tensorInfo = tensors.MakeInfo(size, dataLayout);
+                const TensorInfo weightsInfo =
+                    tensors.MakeInfo(TensorSize{ "", size.m_Channels, size.m_Channels, 3, 3 }, dataLayout);
+                Convolution2dQueueDescriptor descriptor;
+                WorkloadInfo info;
+                AddInput(descriptor, info, tensors, tensorInfo);
+                AddOutput(descriptor, info, tensors, tensorInfo);
+                descriptor.m_Weight = tensors.AddConstant(weightsInfo);
+                descriptor.m_Bias = tensors.AddConstant(tensors.MakeBiasInfo(TensorShape({ size.m_Channels })));
+                descriptor.m_Parameters.m_PadLeft = descriptor.m_Parameters.m_PadRight = 1;
+                descriptor.m_Parameters.m_PadTop = descriptor.m_Parameters.m_PadBottom = 1;
+                descriptor.m_Parameters.m_StrideX = descriptor.m_Parameters.m_StrideY = 1;
+                descriptor.m_Parameters.m_BiasEnabled = true;
+                descriptor.m_Parameters.m_DataLayout = dataLayout;
+
+                inputShape = tensorInfo.GetShape();
+                return tensors.GetFactory().CreateConvolution2d(descriptor, info);
+            }
+        },
+        {
+            "DepthwiseConvolution2d", true,
+            [](WorkloadTensors& tensors, const TensorSize& size, DataLayout dataLayout, TensorShape& inputShape)
+            {
+                // Depthwise weights are [M, I, H, W] whatever the data layout
+                const TensorInfo tensorInfo = tensors.MakeInfo(size, dataLayout);
+                const TensorInfo weightsInfo = tensors.MakeInfo(TensorShape({ 1, size.m_Channels, 3, 3 }));
+                DepthwiseConvolution2dQueueDescriptor descriptor;
+                WorkloadInfo info;
+                AddInput(descriptor, info, tensors, tensorInfo);
+                AddOutput(descriptor, info, tensors, tensorInfo);
+                descriptor.m_Weight = tensors.AddConstant(weightsInfo);
+                descriptor.m_Bias = tensors.AddConstant(tensors.MakeBiasInfo(TensorShape({ size.m_Channels })));
+                descriptor.m_Parameters.m_PadLeft = descriptor.m_Parameters.m_PadRight = 1;
+                descriptor.m_Parameters.m_PadTop = descriptor.m_Parameters.m_PadBottom = 1;
+                descriptor.m_Parameters.m_StrideX = descriptor.m_Parameters.m_StrideY = 1;
+                descriptor.m_Parameters.m_BiasEnabled = true;
+                descriptor.m_Parameters.m_DataLayout = dataLayout;
+
+                inputShape = tensorInfo.GetShape();
+                return tensors.GetFactory().CreateDepthwiseConvolution2d(descriptor, info);
+            }
+        },
+        {
+            "FullyConnected", false,
+            [](WorkloadTensors& tensors, const TensorSize& size, DataLayout, TensorShape& inputShape)
+            {
+                const unsigned int inputSize = size.m_Channels * size.m_Height * size.m_Width;
+                const unsigned int outputSize = size.m_Channels;
+                const TensorInfo inputInfo = tensors.MakeInfo(TensorShape({ size.m_Batches, inputSize }));
+                FullyConnectedQueueDescriptor descriptor;
+                WorkloadInfo info;
+                AddInput(descriptor, info, tensors, inputInfo);
+                AddOutput(descriptor, info, tensors, tensors.MakeInfo(TensorShape({ size.m_Batches, outputSize })));
+                descriptor.m_Weight = tensors.AddConstant(tensors.MakeInfo(TensorShape({ inputSize, outputSize })));
+                descriptor.m_Bias = tensors.AddConstant(tensors.MakeBiasInfo(TensorShape({ outputSize })));
+                descriptor.m_Parameters.m_BiasEnabled = true;
+
+                inputShape = inputInfo.GetShape();
+                return tensors.GetFactory().CreateFullyConnected(descriptor, info);
+            }
+        },
+        {
+            "Pooling2dAverage", true,
+            [](WorkloadTensors& tensors, const TensorSize& size, DataLayout dataLayout, TensorShape& inputShape)
+            {
+                return CreatePooling2d(PoolingAlgorithm::Average, tensors, size, dataLayout, inputShape);
+            }
+        },
+        {
+            "Pooling2dMax", true,
+            [](WorkloadTensors& tensors, const TensorSize& size, DataLayout dataLayout, TensorShape& inputShape)
+            {
+                return CreatePooling2d(PoolingAlgorithm::Max, tensors, size, dataLayout, inputShape);
+            }
+        },
+        {
+            "ResizeBilinear", true,
+            [](WorkloadTensors& tensors, const TensorSize& size, DataLayout dataLayout, TensorShape& inputShape)
+            {
+                const TensorInfo inputInfo = tensors.MakeInfo(size, dataLayout);
+                TensorSize outputSize = size;
+                outputSize.m_Height *= 2;
+                outputSize.m_Width *= 2;
+                ResizeQueueDescriptor descriptor;
+                WorkloadInfo info;
+                AddInput(descriptor, info, tensors, inputInfo);
+                AddOutput(descriptor, info, tensors, tensors.MakeInfo(outputSize, dataLayout));
+                descriptor.m_Parameters.m_Method = ResizeMethod::Bilinear;
+                descriptor.m_Parameters.m_TargetHeight = outputSize.m_Height;
+                descriptor.m_Parameters.m_TargetWidth = outputSize.m_Width;
+                descriptor.m_Parameters.m_DataLayout = dataLayout;
+
+                inputShape = inputInfo.GetShape();
+                return tensors.GetFactory().CreateResize(descriptor, info);
+            }
+        },
+        {
+            "Softmax", false,
+            [](WorkloadTensors& tensors, const TensorSize& size, DataLayout, TensorShape& inputShape)
+            {
+                // Softmax over the channels of every element of the batches
+                const TensorInfo tensorInfo = tensors.MakeInfo(
+                    TensorShape({ size.m_Batches * size.m_Height * size.m_Width, size.m_Channels }));
+                TensorInfo outputInfo = tensorInfo;
+                if (IsQuantizedType(outputInfo.GetDataType()))
+                {
+                    // Softmax outputs of quantized types must have a scale of 1/256 and an offset of 0
+                    outputInfo.SetQuantizationScale(1.0f / 256.0f);
+                    outputInfo.SetQuantizationOffset(0);
+                }
+                SoftmaxQueueDescriptor descriptor;
+                WorkloadInfo info;
+                AddInput(descriptor, info, tensors, tensorInfo);
+                AddOutput(descriptor, info, tensors, outputInfo);
+
+                inputShape = tensorInfo.GetShape();
+                return tensors.GetFactory().CreateSoftmax(descriptor, info);
+            }
+        },
+    };
+    return benchmarks;
+}
+
+struct BenchmarkResult
+{
+    double m_Min;
+    double m_Median;
+    double m_Mean;
+};
+
+BenchmarkResult TimeWorkload(IWorkload& workload, unsigned int warmupIterations, unsigned int iterations)
+{
+    workload.PostAllocationConfigure();
+    for (unsigned int i = 0; i < warmupIterations; ++i)
+    {
+        workload.Execute();
+    }
+
+    std::vector<double> times;
+    times.reserve(iterations);
+    for (unsigned int i = 0; i < iterations; ++i)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        workload.Execute();
+        const auto end = std::chrono::steady_clock::now();
+        times.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+    }
+
+    std::sort(times.begin(), times.end());
+    return { times.front(),
+             times[times.size() / 2],
+             std::accumulate(times.begin(), times.end(), 0.0) / static_cast<double>(times.size()) };
+}
+
+std::string ShapeToString(const TensorShape& shape)
+{
+    std::stringstream ss;
+    for (unsigned int i = 0; i < shape.GetNumDimensions(); ++i)
+    {
+        ss << (i == 0 ? "" : "x") << shape[i];
+    }
+    return ss.str();
+}
+
+} // anonymous namespace
+
+int main(int argc, const char* argv[])
+{
+    armnn::ConfigureLogging(true, true, armnn::LogSeverity::Warning);
+
+    unsigned int iterations;
+    unsigned int warmupIterations;
+    std::string outputPath;
+    std::string filter;
+
+    cxxopts::Options options("RefWorkloadBenchmark",
+                             "Times the reference workloads across data types, data layouts and tensor sizes.");
+    try
+    {
+        options.add_options()
+            ("h,help", "Display usage information")
+            ("i,iterations", "Number of timed executions of each workload",
+             cxxopts::value<unsigned int>(iterations)->default_value("20"))
+            ("w,warmup-iterations", "Number of executions of each workload before timing",
+             cxxopts::value<unsigned int>(warmupIterations)->default_value("2"))
+            ("o,output", "Path of the CSV file to write the results to. Defaults to the standard output",
+             cxxopts::value<std::string>(outputPath)->default_value(""))
+            ("f,filter", "Only runs the workloads whose name contains this string",
+             cxxopts::value<std::string>(filter)->default_value(""));
+
+        auto result = options.parse(argc, argv);
+        if (result.count("help"))
+        {
+            std::cout << options.help() << std::endl;
+            return EXIT_SUCCESS;
+        }
+        if (iterations == 0)
+        {
+            throw cxxopts::OptionParseException("iterations must be greater than zero");
+        }
+    }
+    catch (const cxxopts::OptionException& e)
+    {
+        std::cerr << e.what() << std::endl << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::ofstream outputFile;
+    if (!outputPath.empty())
+    {
+        outputFile.open(outputPath);
+        if (!outputFile)
+        {
+            std::cerr << "Cannot open " << outputPath << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    std::ostream& output = outputPath.empty() ? std::cout : outputFile;
+
+    output << "workload,data_type,data_layout,size,input_shape,iterations,min_us,median_us,mean_us" << std::endl;
+
+    // Fixed seed so that every run times the same data
+    std::mt19937 generator(0);
+    for (const WorkloadBenchmark& benchmark : GetWorkloadBenchmarks())
+    {
+        if (benchmark.m_Name.find(filter) == std::string::npos)
+        {
+            continue;
+        }
+
+        for (const TensorSize& size : g_TensorSizes)
+        {
+            for (DataType dataType : g_DataTypes)
+            {
+                for (DataLayout dataLayout : g_DataLayouts)
+                {
+                    // Layout independent workloads only run once
+                    if (!benchmark.m_IsLayoutDependent && dataLayout != g_DataLayouts.front())
+                    {
+                        continue;
+                    }
+
+                    WorkloadTensors tensors(dataType, generator);
+                    TensorShape inputShape;
+                    std::unique_ptr<IWorkload> workload;
+                    try
+                    {
+                        workload = benchmark.m_Create(tensors, size, dataLayout, inputShape);
+                    }
+                    catch (const armnn::Exception& e)
+                    {
+                        ARMNN_LOG(warning) << "Skipping " << benchmark.m_Name << " " << GetDataTypeName(dataType)
+                                           << ": " << e.what();
+                        continue;
+                    }
+
+                    const BenchmarkResult result = TimeWorkload(*workload, warmupIterations, iterations);
+                    output << benchmark.m_Name << ","
+                           << GetDataTypeName(dataType) << ","
+                           << (benchmark.m_IsLayoutDependent ? GetDataLayoutName(dataLayout) : "") << ","
+                           << size.m_Name << ","
+                           << ShapeToString(inputShape) << ","
+                           << iterations << ","
+                           << result.m_Min << ","
+                           << result.m_Median << ","
+                           << result.m_Mean << std::endl;
+                }
+            }
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
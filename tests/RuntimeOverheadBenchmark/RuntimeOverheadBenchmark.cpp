@@ -0,0 +1,138 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <armnn/ArmNN.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+// Times the fixed costs of the runtime that do not depend on the work of the layers: building and optimizing a long
+// chain of tiny quantized layers, copying per-axis quantized tensor infos, and running a one-layer network on CpuRef
+// through EnqueueWorkload and through tensors bound once by RegisterTensors.
+// Usage: RuntimeOverheadBenchmark [numLayers] [numIterations]
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+armnn::INetworkPtr CreateNetwork(unsigned int numLayers)
+{
+    using namespace armnn;
+
+    const TensorInfo info({ 1, 4 }, DataType::QAsymmU8, 0.1f, 128);
+
+    ActivationDescriptor descriptor;
+    descriptor.m_Function = ActivationFunction::ReLu;
+
+    INetworkPtr net(INetwork::Create());
+    IConnectableLayer* previous = net->AddInputLayer(0);
+    previous->GetOutputSlot(0).SetTensorInfo(info);
+
+    for (unsigned int i = 0; i < numLayers; ++i)
+    {
+        IConnectableLayer* activation = net->AddActivationLayer(descriptor);
+        previous->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+        activation->GetOutputSlot(0).SetTensorInfo(info);
+        previous = activation;
+    }
+
+    previous->GetOutputSlot(0).Connect(net->AddOutputLayer(0)->GetInputSlot(0));
+    return net;
+}
+
+double TimeConstruction(armnn::IRuntime& runtime, unsigned int numLayers)
+{
+    const std::vector<armnn::BackendId> backends = { armnn::Compute::CpuRef };
+    const auto start = Clock::now();
+    armnn::IOptimizedNetworkPtr optNet = armnn::Optimize(*CreateNetwork(numLayers), backends, runtime.GetDeviceSpec());
+    const double elapsed = ElapsedMs(start);
+
+    if (!optNet)
+    {
+        std::cerr << "Optimize failed" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    return elapsed;
+}
+
+double TimeTensorInfoCopies(unsigned int numCopies)
+{
+    const std::vector<float> scales(64, 0.5f);
+    const armnn::TensorInfo perAxisInfo({ 64, 3, 3, 16 }, armnn::DataType::QSymmS8, scales, 0);
+
+    const auto start = Clock::now();
+    std::vector<armnn::TensorInfo> copies(numCopies, perAxisInfo);
+    const double elapsed = ElapsedMs(start);
+
+    if (copies.back() != perAxisInfo)
+    {
+        std::cerr << "Copied tensor info differs" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    return elapsed;
+}
+
+void CheckStatus(armnn::Status status, const char* what)
+{
+    if (status != armnn::Status::Success)
+    {
+        std::cerr << what << " failed" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+    using namespace armnn;
+
+    const unsigned int numLayers = argc > 1 ? static_cast<unsigned int>(std::atoi(argv[1])) : 1000;
+    const unsigned int numIterations = argc > 2 ? static_cast<unsigned int>(std::atoi(argv[2])) : 10000;
+
+    IRuntimePtr runtime(IRuntime::Create(IRuntime::CreationOptions()));
+
+    const double constructionMs = TimeConstruction(*runtime, numLayers);
+    const double copyMs = TimeTensorInfoCopies(numIterations);
+
+    IOptimizedNetworkPtr optNet = Optimize(*CreateNetwork(1), { Compute::CpuRef }, runtime->GetDeviceSpec());
+    NetworkId networkId;
+    CheckStatus(runtime->LoadNetwork(networkId, std::move(optNet)), "LoadNetwork");
+
+    std::vector<uint8_t> inputData(4, 130);
+    std::vector<uint8_t> outputData(4);
+    const InputTensors inputTensors{ { 0, ConstTensor(runtime->GetInputTensorInfo(networkId, 0), inputData.data()) } };
+    const OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(networkId, 0), outputData.data()) } };
+
+    auto start = Clock::now();
+    for (unsigned int i = 0; i < numIterations; ++i)
+    {
+        CheckStatus(runtime->EnqueueWorkload(networkId, inputTensors, outputTensors), "EnqueueWorkload");
+    }
+    const double enqueueMs = ElapsedMs(start);
+
+    BoundTensorsId boundTensorsId;
+    CheckStatus(runtime->RegisterTensors(networkId, inputTensors, outputTensors, boundTensorsId), "RegisterTensors");
+    start = Clock::now();
+    for (unsigned int i = 0; i < numIterations; ++i)
+    {
+        CheckStatus(runtime->Execute(boundTensorsId), "Execute");
+    }
+    const double executeMs = ElapsedMs(start);
+
+    std::cout << "Build and optimize " << numLayers + 2 << " layers: " << constructionMs << " ms" << std::endl;
+    std::cout << "Per-axis tensor info copy:     " << copyMs * 1000.0 / numIterations << " us" << std::endl;
+    std::cout << "EnqueueWorkload, one layer:    " << enqueueMs * 1000.0 / numIterations << " us" << std::endl;
+    std::cout << "Execute bound tensors:         " << executeMs * 1000.0 / numIterations << " us" << std::endl;
+    return EXIT_SUCCESS;
+}